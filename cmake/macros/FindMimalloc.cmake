@@ -0,0 +1,23 @@
+#
+# This file is part of Project SkyFire https://www.projectskyfire.org. 
+# See COPYRIGHT file for Copyright information
+#
+
+# find mimalloc (memory allocator) includes and library
+#
+# MIMALLOC_INCLUDE_DIR - where the directory containing mimalloc.h can be found
+# MIMALLOC_LIBRARY     - full path to the mimalloc library
+# MIMALLOC_FOUND       - TRUE if mimalloc was found
+
+FIND_PATH(MIMALLOC_INCLUDE_DIR mimalloc.h PATH_SUFFIXES mimalloc)
+FIND_LIBRARY(MIMALLOC_LIBRARY NAMES mimalloc)
+
+IF (MIMALLOC_INCLUDE_DIR AND MIMALLOC_LIBRARY)
+    SET(MIMALLOC_FOUND TRUE)
+    MESSAGE(STATUS "Found mimalloc library: ${MIMALLOC_LIBRARY}")
+    MESSAGE(STATUS "Include dir is: ${MIMALLOC_INCLUDE_DIR}")
+    INCLUDE_DIRECTORIES(${MIMALLOC_INCLUDE_DIR})
+ELSE (MIMALLOC_INCLUDE_DIR AND MIMALLOC_LIBRARY)
+    SET(MIMALLOC_FOUND FALSE)
+    MESSAGE(FATAL_ERROR "** mimalloc library not found, install it or choose another MEMORY_ALLOCATOR!\n**")
+ENDIF (MIMALLOC_INCLUDE_DIR AND MIMALLOC_LIBRARY)
@@ -13,4 +13,5 @@ option(WITH_COREDEBUG     "Include additional debug-code in core"
 option(WITHOUT_GIT        "Disable the GIT testing routines"                            0)
 option(WITH_CXX_23_STD    "Use c++23 standard"                                          1)
 option(WITH_CXX_DRAFT_STD "Use c++ draft standard"                                      0)
+set(MEMORY_ALLOCATOR "jemalloc" CACHE STRING "Allocator of the worldserver: jemalloc (Linux only), mimalloc or system")
 
@@ -5,7 +5,7 @@
 
 # Package overloads - Linux
 if(CMAKE_SYSTEM_NAME MATCHES "Linux")
-  if (NOT NOJEM)
+  if (NOT NOJEM AND MEMORY_ALLOCATOR STREQUAL "jemalloc")
     set(JEMALLOC_LIBRARY "jemalloc")
     message(STATUS "UNIX: Using jemalloc")
   endif()
@@ -90,6 +90,16 @@ else()
   message("* Use GIT revision hash  : Yes")
 endif()
 
+if( JEMALLOC_LIBRARY )
+  message("* Memory allocator       : jemalloc (default)")
+  add_definitions(-DSF_ALLOCATOR_JEMALLOC)
+elseif( MEMORY_ALLOCATOR STREQUAL "mimalloc" )
+  message("* Memory allocator       : mimalloc")
+  add_definitions(-DSF_ALLOCATOR_MIMALLOC)
+else()
+  message("* Memory allocator       : system")
+endif()
+
 if ( NOJEM )
   message("")
   message(" *** NOJEM - WARNING!")
@@ -0,0 +1,11 @@
+DELETE FROM `rbac_permissions` WHERE `id` IN (808, 809, 810);
+INSERT INTO `rbac_permissions` (`id`, `name`) VALUES
+(808, 'Command: server profile'),
+(809, 'Command: server profile reset'),
+(810, 'Command: server profile slow');
+
+DELETE FROM `rbac_linked_permissions` WHERE `id` = 196 AND `linkedId` IN (808, 809, 810);
+INSERT INTO `rbac_linked_permissions` (`id`, `linkedId`) VALUES
+(196, 808),
+(196, 809),
+(196, 810);
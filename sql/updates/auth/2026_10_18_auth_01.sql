@@ -0,0 +1,11 @@
+DELETE FROM `rbac_permissions` WHERE `id` IN (811, 812, 813);
+INSERT INTO `rbac_permissions` (`id`, `name`) VALUES
+(811, 'Command: server opcodes'),
+(812, 'Command: server opcodes player'),
+(813, 'Command: server opcodes reset');
+
+DELETE FROM `rbac_linked_permissions` WHERE `id` = 196 AND `linkedId` IN (811, 812, 813);
+INSERT INTO `rbac_linked_permissions` (`id`, `linkedId`) VALUES
+(196, 811),
+(196, 812),
+(196, 813);
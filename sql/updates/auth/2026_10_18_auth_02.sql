@@ -0,0 +1,7 @@
+DELETE FROM `rbac_permissions` WHERE `id` = 814;
+INSERT INTO `rbac_permissions` (`id`, `name`) VALUES
+(814, 'Command: server memory');
+
+DELETE FROM `rbac_linked_permissions` WHERE `id` = 196 AND `linkedId` = 814;
+INSERT INTO `rbac_linked_permissions` (`id`, `linkedId`) VALUES
+(196, 814);
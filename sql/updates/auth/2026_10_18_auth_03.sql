@@ -0,0 +1,7 @@
+DELETE FROM `rbac_permissions` WHERE `id` = 815;
+INSERT INTO `rbac_permissions` (`id`, `name`) VALUES
+(815, 'Command: server memory purge');
+
+DELETE FROM `rbac_linked_permissions` WHERE `id` = 196 AND `linkedId` = 815;
+INSERT INTO `rbac_linked_permissions` (`id`, `linkedId`) VALUES
+(196, 815);
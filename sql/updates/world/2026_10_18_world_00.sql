@@ -0,0 +1,5 @@
+DELETE FROM `command` WHERE `permission` IN (808, 809, 810);
+INSERT INTO `command` (`name`, `permission`, `help`) VALUES
+('server profile', 808, 'Syntax: .server profile [$count]\r\n\r\nShow the tick profiler histograms collected since the last dump or reset, with the $count maps and opcodes that took the most time (5 by default).'),
+('server profile reset', 809, 'Syntax: .server profile reset\r\n\r\nClear the tick profiler histograms.'),
+('server profile slow', 810, 'Syntax: .server profile slow\r\n\r\nShow the breakdown of the last tick that took longer than Profiler.SlowTickThreshold.');
@@ -0,0 +1,5 @@
+DELETE FROM `command` WHERE `permission` IN (811, 812, 813);
+INSERT INTO `command` (`name`, `permission`, `help`) VALUES
+('server opcodes', 811, 'Syntax: .server opcodes [$count]\r\n\r\nShow count, handler time, received bytes and rate limited packets of the $count client opcodes with the highest total handler time over all sessions (10 by default).'),
+('server opcodes player', 812, 'Syntax: .server opcodes player [$playername] [$count]\r\n\r\nShow the same table for the session of an online player.'),
+('server opcodes reset', 813, 'Syntax: .server opcodes reset\r\n\r\nClear the server wide opcode costs.');
@@ -0,0 +1,3 @@
+DELETE FROM `command` WHERE `permission` = 814;
+INSERT INTO `command` (`name`, `permission`, `help`) VALUES
+('server memory', 814, 'Syntax: .server memory\r\n\r\nShow allocations, share served from the thread caches, live and cached objects of the pooled spell and aura types.');
@@ -0,0 +1,5 @@
+UPDATE `command` SET `help` = 'Syntax: .server memory\r\n\r\nShow the pooled spell and aura types with their allocations, share served from the thread caches, live and cached objects, followed by the usage of the allocator: allocated, active, dirty, mapped and resident memory, fragmentation and the usage of every arena.' WHERE `name` = 'server memory';
+
+DELETE FROM `command` WHERE `permission` = 815;
+INSERT INTO `command` (`name`, `permission`, `help`) VALUES
+('server memory purge', 815, 'Syntax: .server memory purge\r\n\r\nGive the unused dirty pages of all allocator arenas back to the system now.');
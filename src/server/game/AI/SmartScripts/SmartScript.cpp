@@ -24,6 +24,7 @@
 #include "SmartScript.h"
 #include "SpellMgr.h"
 #include "Vehicle.h"
+#include <functional>
 
 class SkyFireStringTextBuilder
 {
@@ -65,6 +66,25 @@ public:
     uint64 _targetGUID;
 };
 
+// orders mEvents indexes by event type, keeping script order for events of the same type
+struct SmartEventTypeOrder
+{
+    explicit SmartEventTypeOrder(SmartAIEventList const& events) : _events(events) { }
+
+    bool operator()(uint32 left, uint32 right) const
+    {
+        uint32 leftType = _events[left].GetEventType();
+        uint32 rightType = _events[right].GetEventType();
+        return leftType < rightType || (leftType == rightType && left < right);
+    }
+
+    // used by equal_range, comparing an index against a bare event type
+    bool operator()(uint32 index, SMART_EVENT type) const { return _events[index].GetEventType() < uint32(type); }
+    bool operator()(SMART_EVENT type, uint32 index) const { return uint32(type) < _events[index].GetEventType(); }
+
+    SmartAIEventList const& _events;
+};
+
 SmartScript::SmartScript() : go(NULL), me(NULL), trigger(NULL), mScriptType(SMART_SCRIPT_TYPE_CREATURE), mEventPhase(0),
 mPathId(0), mTextTimer(0), mLastTextID(0), mTalkerEntry(0), mUseTextTimer(false),
 mTemplate(SMARTAI_TEMPLATE_BASIC), meOrigGUID(0), goOrigGUID(0), mLastInvoker(0)
@@ -120,20 +140,21 @@ void SmartScript::ResetBaseObject()
 
 void SmartScript::ProcessEventsFor(SMART_EVENT e, Unit* unit, uint32 var0, uint32 var1, bool bvar, const SpellInfo* spell, GameObject* gob)
 {
-    for (SmartAIEventList::iterator i = mEvents.begin(); i != mEvents.end(); ++i)
+    if (e == SMART_EVENT_LINK || uint32(e) >= SMART_EVENT_END || !mEventTypeMask.test(e))//links are special handled, see FindLinkedEvent
+        return;
+
+    std::pair<std::vector<uint32>::const_iterator, std::vector<uint32>::const_iterator> bounds =
+        std::equal_range(mEventsByType.begin(), mEventsByType.end(), e, SmartEventTypeOrder(mEvents));
+
+    for (std::vector<uint32>::const_iterator i = bounds.first; i != bounds.second; ++i)
     {
-        SMART_EVENT eventType = SMART_EVENT((*i).GetEventType());
-        if (eventType == SMART_EVENT_LINK)//special handling
-            continue;
+        SmartScriptHolder& holder = mEvents[*i];
 
-        if (eventType == e/* && (!(*i).event.event_phase_mask || IsInPhase((*i).event.event_phase_mask)) && !((*i).event.event_flags & SMART_EVENT_FLAG_NOT_REPEATABLE && (*i).runOnce)*/)
-        {
-            ConditionList conds = sConditionMgr->GetConditionsForSmartEvent((*i).entryOrGuid, (*i).event_id, (*i).source_type);
-            ConditionSourceInfo info = ConditionSourceInfo(unit, GetBaseObject());
+        ConditionList conds = sConditionMgr->GetConditionsForSmartEvent(holder.entryOrGuid, holder.event_id, holder.source_type);
+        ConditionSourceInfo info = ConditionSourceInfo(unit, GetBaseObject());
 
-            if (sConditionMgr->IsObjectMeetToConditions(info, conds))
-                ProcessEvent(*i, unit, var0, var1, bvar, spell, gob);
-        }
+        if (sConditionMgr->IsObjectMeetToConditions(info, conds))
+            ProcessEvent(holder, unit, var0, var1, bvar, spell, gob);
     }
 }
 
@@ -3229,6 +3250,80 @@ void SmartScript::RecalcTimer(SmartScriptHolder& e, uint32 min, uint32 max)
     // min/max was checked at loading!
     e.timer = urand(uint32(min), uint32(max));
     e.active = e.timer ? false : true;
+    ArmEventTimer(e);
+}
+
+bool SmartScript::IsTimedEvent(uint32 eventType)
+{
+    switch (eventType)//events processed by UpdateTimer every time their timer expires
+    {
+        case SMART_EVENT_UPDATE:
+        case SMART_EVENT_UPDATE_OOC:
+        case SMART_EVENT_UPDATE_IC:
+        case SMART_EVENT_HEALT_PCT:
+        case SMART_EVENT_TARGET_HEALTH_PCT:
+        case SMART_EVENT_MANA_PCT:
+        case SMART_EVENT_TARGET_MANA_PCT:
+        case SMART_EVENT_RANGE:
+        case SMART_EVENT_VICTIM_CASTING:
+        case SMART_EVENT_FRIENDLY_HEALTH:
+        case SMART_EVENT_FRIENDLY_IS_CC:
+        case SMART_EVENT_FRIENDLY_MISSING_BUFF:
+        case SMART_EVENT_HAS_AURA:
+        case SMART_EVENT_TARGET_BUFFED:
+        case SMART_EVENT_IS_BEHIND_TARGET:
+        case SMART_EVENT_FRIENDLY_HEALTH_PCT:
+            return true;
+        default:
+            return false;
+    }
+}
+
+void SmartScript::ArmEventTimer(SmartScriptHolder const& e)
+{
+    // timed events are always ticked, others only while their cooldown is running
+    if (e.active || mEvents.empty() || IsTimedEvent(e.GetEventType()))
+        return;
+
+    // stored events and timed action lists are ticked directly by OnUpdate, they live in other containers
+    // so the addresses are only ordered through std::less
+    std::less<SmartScriptHolder const*> before;
+    if (before(&e, &mEvents.front()) || before(&mEvents.back(), &e))
+        return;
+
+    mArmedEvents.push_back(uint32(&e - &mEvents.front()));
+}
+
+void SmartScript::MergeArmedEvents()
+{
+    mUpdateEvents.insert(mUpdateEvents.end(), mArmedEvents.begin(), mArmedEvents.end());
+    mArmedEvents.clear();
+
+    std::sort(mUpdateEvents.begin(), mUpdateEvents.end());
+    mUpdateEvents.erase(std::unique(mUpdateEvents.begin(), mUpdateEvents.end()), mUpdateEvents.end());
+}
+
+void SmartScript::BuildEventIndex()
+{
+    mEventsByType.clear();
+    mEventTypeMask.reset();
+    mUpdateEvents.clear();
+    mArmedEvents.clear();
+
+    for (uint32 i = 0; i < mEvents.size(); ++i)
+    {
+        uint32 eventType = mEvents[i].GetEventType();
+        if (eventType == SMART_EVENT_LINK || eventType >= SMART_EVENT_END)//links are only reached through FindLinkedEvent
+            continue;
+
+        mEventsByType.push_back(i);
+        mEventTypeMask.set(eventType);
+
+        if (IsTimedEvent(eventType) || !mEvents[i].active)
+            mUpdateEvents.push_back(i);
+    }
+
+    std::sort(mEventsByType.begin(), mEventsByType.end(), SmartEventTypeOrder(mEvents));
 }
 
 void SmartScript::UpdateTimer(SmartScriptHolder& e, uint32 const diff)
@@ -3261,40 +3356,21 @@ void SmartScript::UpdateTimer(SmartScriptHolder& e, uint32 const diff)
         }
 
         e.active = true;//activate events with cooldown
-        switch (e.GetEventType())//process ONLY timed events
-        {
-            case SMART_EVENT_UPDATE:
-            case SMART_EVENT_UPDATE_OOC:
-            case SMART_EVENT_UPDATE_IC:
-            case SMART_EVENT_HEALT_PCT:
-            case SMART_EVENT_TARGET_HEALTH_PCT:
-            case SMART_EVENT_MANA_PCT:
-            case SMART_EVENT_TARGET_MANA_PCT:
-            case SMART_EVENT_RANGE:
-            case SMART_EVENT_VICTIM_CASTING:
-            case SMART_EVENT_FRIENDLY_HEALTH:
-            case SMART_EVENT_FRIENDLY_IS_CC:
-            case SMART_EVENT_FRIENDLY_MISSING_BUFF:
-            case SMART_EVENT_HAS_AURA:
-            case SMART_EVENT_TARGET_BUFFED:
-            case SMART_EVENT_IS_BEHIND_TARGET:
-            case SMART_EVENT_FRIENDLY_HEALTH_PCT:
-            {
-                ProcessEvent(e);
-                if (e.GetScriptType() == SMART_SCRIPT_TYPE_TIMED_ACTIONLIST)
+        if (IsTimedEvent(e.GetEventType()))//process ONLY timed events
+        {
+            ProcessEvent(e);
+            if (e.GetScriptType() == SMART_SCRIPT_TYPE_TIMED_ACTIONLIST)
+            {
+                e.enableTimed = false;//disable event if it is in an ActionList and was processed once
+                for (SmartAIEventList::iterator i = mTimedActionList.begin(); i != mTimedActionList.end(); ++i)
                 {
-                    e.enableTimed = false;//disable event if it is in an ActionList and was processed once
-                    for (SmartAIEventList::iterator i = mTimedActionList.begin(); i != mTimedActionList.end(); ++i)
+                    //find the first event which is not the current one and enable it
+                    if (i->event_id > e.event_id)
                     {
-                        //find the first event which is not the current one and enable it
-                        if (i->event_id > e.event_id)
-                        {
-                            i->enableTimed = true;
-                            break;
-                        }
+                        i->enableTimed = true;
+                        break;
                     }
                 }
-                break;
             }
         }
     }
@@ -3315,6 +3391,7 @@ void SmartScript::InstallEvents()
             mEvents.push_back(*i);//must be before UpdateTimers
 
         mInstallEvents.clear();
+        BuildEventIndex();
     }
 }
 
@@ -3340,8 +3417,24 @@ void SmartScript::OnUpdate(uint32 const diff)
 
     InstallEvents();//before UpdateTimers
 
-    for (SmartAIEventList::iterator i = mEvents.begin(); i != mEvents.end(); ++i)
-        UpdateTimer(*i, diff);
+    if (!mArmedEvents.empty())
+        MergeArmedEvents();
+
+    // idle scripts have nothing here: only timed events and running cooldowns are ticked
+    if (!mUpdateEvents.empty())
+    {
+        std::vector<uint32>::iterator keep = mUpdateEvents.begin();
+        for (std::vector<uint32>::iterator i = mUpdateEvents.begin(); i != mUpdateEvents.end(); ++i)
+        {
+            SmartScriptHolder& holder = mEvents[*i];
+            UpdateTimer(holder, diff);
+
+            // expired cooldowns are dropped, RecalcTimer arms them again
+            if (IsTimedEvent(holder.GetEventType()) || !holder.active)
+                *keep++ = *i;
+        }
+        mUpdateEvents.erase(keep, mUpdateEvents.end());
+    }
 
     if (!mStoredEvents.empty())
         for (SmartAIEventList::iterator i = mStoredEvents.begin(); i != mStoredEvents.end(); ++i)
@@ -3483,6 +3576,8 @@ void SmartScript::OnInitialize(WorldObject* obj, AreaTriggerEntry const* at)
     for (SmartAIEventList::iterator i = mEvents.begin(); i != mEvents.end(); ++i)
         InitTimer((*i));//calculate timers for first time use
 
+    BuildEventIndex();
+
     ProcessEventsFor(SMART_EVENT_AI_INIT);
     InstallEvents();
     ProcessEventsFor(SMART_EVENT_JUST_CREATED);
@@ -15,6 +15,8 @@
 
 #include "SmartScriptMgr.h"
 
+#include <bitset>
+
 class SmartScript
 {
 public:
@@ -195,6 +197,19 @@ private:
     SMARTAI_TEMPLATE mTemplate;
     void InstallEvents();
 
+    // mEvents indexes grouped by event type, so ProcessEventsFor only visits matching events
+    std::vector<uint32> mEventsByType;
+    std::bitset<SMART_EVENT_END> mEventTypeMask;
+    // mEvents indexes which still need UpdateTimer: timed events and running cooldowns
+    std::vector<uint32> mUpdateEvents;
+    // cooldowns started since the last OnUpdate, merged into mUpdateEvents before ticking
+    std::vector<uint32> mArmedEvents;
+
+    void BuildEventIndex();
+    void ArmEventTimer(SmartScriptHolder const& e);
+    void MergeArmedEvents();
+    static bool IsTimedEvent(uint32 eventType);
+
     void RemoveStoredEvent(uint32 id);
 
     SmartScriptHolder FindLinkedEvent(uint32 link)
@@ -693,6 +693,15 @@ namespace rbac
         RBAC_PERM_COMMAND_ACCOUNT_BOOST_ADD = 806,
         RBAC_PERM_COMMAND_ACCOUNT_BOOST_DEL = 807,
 
+        RBAC_PERM_COMMAND_SERVER_PROFILE = 808,
+        RBAC_PERM_COMMAND_SERVER_PROFILE_RESET = 809,
+        RBAC_PERM_COMMAND_SERVER_PROFILE_SLOW = 810,
+        RBAC_PERM_COMMAND_SERVER_OPCODES = 811,
+        RBAC_PERM_COMMAND_SERVER_OPCODES_PLAYER = 812,
+        RBAC_PERM_COMMAND_SERVER_OPCODES_RESET = 813,
+        RBAC_PERM_COMMAND_SERVER_MEMORY = 814,
+        RBAC_PERM_COMMAND_SERVER_MEMORY_PURGE = 815,
+
         // custom permissions 1000+
         RBAC_PERM_MAX
     };
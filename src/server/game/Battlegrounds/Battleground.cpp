@@ -152,6 +152,9 @@ m_PrematureCountDown(false), m_PrematureCountDownTimer(0), m_HonorMode(BGHonorMo
 
 Battleground::~Battleground()
 {
+    // raid groups and arena ratings still have to be settled
+    ProcessDeferredActions();
+
     // remove objects and creatures
     // (this is done automatically in mapmanager update, when the instance is reset after the reset time)
     uint32 size = uint32(BgCreatures.size());
@@ -534,7 +537,7 @@ inline void Battleground::_ProcessJoin(uint32 diff)
                 }
             // Announce BG starting
             if (sWorld->GetBoolConfig(WorldBoolConfigs::CONFIG_BATTLEGROUND_QUEUE_ANNOUNCER_ENABLE))
-                sWorld->SendWorldText(LANG_BG_STARTED_ANNOUNCE_WORLD, GetName(), GetMinLevel(), GetMaxLevel());
+                DeferAction(BG_DEFERRED_ANNOUNCE_START);
         }
     }
 
@@ -705,18 +708,6 @@ void Battleground::EndBattleground(uint32 winner)
 {
     RemoveFromBGFreeSlotQueue();
 
-    ArenaTeam* winnerArenaTeam = NULL;
-    ArenaTeam* loserArenaTeam = NULL;
-
-    uint32 loserTeamRating = 0;
-    uint32 loserMatchmakerRating = 0;
-    int32  loserChange = 0;
-    int32  loserMatchmakerChange = 0;
-    uint32 winnerTeamRating = 0;
-    uint32 winnerMatchmakerRating = 0;
-    int32  winnerChange = 0;
-    int32  winnerMatchmakerChange = 0;
-
     int32 winmsg_id = 0;
 
     if (winner == ALLIANCE)
@@ -744,52 +735,12 @@ void Battleground::EndBattleground(uint32 winner)
     //we must set it this way, because end time is sent in packet!
     SetRemainingTime(TIME_AUTOCLOSE_BATTLEGROUND);
 
-    // arena rating calculation
+    // arena rating calculation, arena teams are shared by all maps so it is done by ProcessDeferredActions
     if (isArena() && isRated())
     {
-        winnerArenaTeam = sArenaTeamMgr->GetArenaTeamById(GetArenaTeamIdForTeam(winner));
-        loserArenaTeam = sArenaTeamMgr->GetArenaTeamById(GetArenaTeamIdForTeam(GetOtherTeam(winner)));
-
-        if (winnerArenaTeam && loserArenaTeam && winnerArenaTeam != loserArenaTeam)
-        {
-            if (winner != WINNER_NONE)
-            {
-                loserTeamRating = loserArenaTeam->GetRating();
-                loserMatchmakerRating = GetArenaMatchmakerRating(GetOtherTeam(winner));
-                winnerTeamRating = winnerArenaTeam->GetRating();
-                winnerMatchmakerRating = GetArenaMatchmakerRating(winner);
-                winnerMatchmakerChange = winnerArenaTeam->WonAgainst(winnerMatchmakerRating, loserMatchmakerRating, winnerChange);
-                loserMatchmakerChange = loserArenaTeam->LostAgainst(loserMatchmakerRating, winnerMatchmakerRating, loserChange);
-                SF_LOG_DEBUG("bg.arena", "match Type: %u --- Winner: old rating: %u, rating gain: %d, old MMR: %u, MMR gain: %d --- Loser: old rating: %u, rating loss: %d, old MMR: %u, MMR loss: %d ---", m_ArenaType, winnerTeamRating, winnerChange, winnerMatchmakerRating,
-                    winnerMatchmakerChange, loserTeamRating, loserChange, loserMatchmakerRating, loserMatchmakerChange);
-                SetArenaMatchmakerRating(winner, winnerMatchmakerRating + winnerMatchmakerChange);
-                SetArenaMatchmakerRating(GetOtherTeam(winner), loserMatchmakerRating + loserMatchmakerChange);
-                SetArenaTeamRatingChangeForTeam(winner, winnerChange);
-                SetArenaTeamRatingChangeForTeam(GetOtherTeam(winner), loserChange);
-                SF_LOG_DEBUG("bg.arena", "Arena match Type: %u for Team1Id: %u - Team2Id: %u ended. WinnerTeamId: %u. Winner rating: +%d, Loser rating: %d", m_ArenaType, m_ArenaTeamIds[TEAM_ALLIANCE], m_ArenaTeamIds[TEAM_HORDE], winnerArenaTeam->GetId(), winnerChange, loserChange);
-                if (sWorld->GetBoolConfig(WorldBoolConfigs::CONFIG_ARENA_LOG_EXTENDED_INFO))
-                    for (Battleground::BattlegroundScoreMap::const_iterator itr = GetPlayerScoresBegin(); itr != GetPlayerScoresEnd(); ++itr)
-                        if (Player* player = ObjectAccessor::FindPlayer(itr->first))
-                        {
-                            SF_LOG_DEBUG("bg.arena", "Statistics match Type: %u for %s (GUID: " UI64FMTD ", IP: %s): %u damage, %u healing, %u killing blows",
-                                m_ArenaType, player->GetName().c_str(), itr->first, player->GetSession()->GetRemoteAddress().c_str(), itr->second->DamageDone, itr->second->HealingDone,
-                                itr->second->KillingBlows);
-                        }
-            }
-            // Deduct 16 points from each teams arena-rating if there are no winners after 45+2 minutes
-            else
-            {
-                SetArenaTeamRatingChangeForTeam(ALLIANCE, ARENA_TIMELIMIT_POINTS_LOSS);
-                SetArenaTeamRatingChangeForTeam(HORDE, ARENA_TIMELIMIT_POINTS_LOSS);
-                winnerArenaTeam->FinishGame(ARENA_TIMELIMIT_POINTS_LOSS);
-                loserArenaTeam->FinishGame(ARENA_TIMELIMIT_POINTS_LOSS);
-            }
-        }
-        else
-        {
-            SetArenaTeamRatingChangeForTeam(ALLIANCE, 0);
-            SetArenaTeamRatingChangeForTeam(HORDE, 0);
-        }
+        DeferAction(BG_DEFERRED_ARENA_RESULT, 0, winner);
+        for (BattlegroundPlayerMap::const_iterator itr = m_Players.begin(); itr != m_Players.end(); ++itr)
+            DeferAction(BG_DEFERRED_ARENA_MEMBER, itr->first, itr->second.Team);
     }
 
     bool guildAwarded = false;
@@ -804,17 +755,7 @@ void Battleground::EndBattleground(uint32 winner)
         uint32 team = itr->second.Team;
 
         if (itr->second.OfflineRemoveTime)
-        {
-            //if rated arena match - make member lost!
-            if (isArena() && isRated() && winnerArenaTeam && loserArenaTeam && winnerArenaTeam != loserArenaTeam)
-            {
-                if (team == winner)
-                    winnerArenaTeam->OfflineMemberLost(itr->first, loserMatchmakerRating, winnerMatchmakerChange);
-                else
-                    loserArenaTeam->OfflineMemberLost(itr->first, winnerMatchmakerRating, loserMatchmakerChange);
-            }
             continue;
-        }
 
         Player* player = _GetPlayer(itr, "EndBattleground");
         if (!player)
@@ -840,28 +781,6 @@ void Battleground::EndBattleground(uint32 winner)
             player->getHostileRefManager().deleteReferences();
         }
 
-        // per player calculation
-        if (isArena() && isRated() && winnerArenaTeam && loserArenaTeam && winnerArenaTeam != loserArenaTeam)
-        {
-            if (team == winner)
-            {
-                // update achievement BEFORE personal rating update
-                uint32 rating = player->GetArenaPersonalRating(winnerArenaTeam->GetSlot());
-                player->UpdateAchievementCriteria(ACHIEVEMENT_CRITERIA_TYPE_WIN_RATED_ARENA, rating ? rating : 1);
-                player->UpdateAchievementCriteria(ACHIEVEMENT_CRITERIA_TYPE_WIN_ARENA, GetMapId());
-                player->ModifyCurrency(CURRENCY_TYPE_CONQUEST_META_ARENA, sWorld->getIntConfig(WorldIntConfigs::CONFIG_CURRENCY_CONQUEST_POINTS_ARENA_REWARD));
-
-                winnerArenaTeam->MemberWon(player, loserMatchmakerRating, winnerMatchmakerChange);
-            }
-            else
-            {
-                loserArenaTeam->MemberLost(player, winnerMatchmakerRating, loserMatchmakerChange);
-
-                // Arena lost => reset the win_rated_arena having the "no_lose" condition
-                player->ResetAchievementCriteria(ACHIEVEMENT_CRITERIA_TYPE_WIN_RATED_ARENA, ACHIEVEMENT_CRITERIA_CONDITION_NO_LOSE);
-            }
-        }
-
         uint32 winnerKills = player->GetRandomWinner() ? sWorld->getIntConfig(WorldIntConfigs::CONFIG_BG_REWARD_WINNER_HONOR_LAST) : sWorld->getIntConfig(WorldIntConfigs::CONFIG_BG_REWARD_WINNER_HONOR_FIRST);
         uint32 loserKills = player->GetRandomWinner() ? sWorld->getIntConfig(WorldIntConfigs::CONFIG_BG_REWARD_LOSER_HONOR_LAST) : sWorld->getIntConfig(WorldIntConfigs::CONFIG_BG_REWARD_LOSER_HONOR_FIRST);
 
@@ -891,11 +810,7 @@ void Battleground::EndBattleground(uint32 winner)
                 guildAwarded = true;
                 if (uint32 guildId = GetBgMap()->GetOwnerGuildId(player->GetTeam()))
                     if (Guild* guild = sGuildMgr->GetGuildById(guildId))
-                    {
                         guild->UpdateAchievementCriteria(ACHIEVEMENT_CRITERIA_TYPE_WIN_BG, 1, 0, 0, NULL, player);
-                        if (isArena() && isRated() && winnerArenaTeam && loserArenaTeam && winnerArenaTeam != loserArenaTeam)
-                            guild->UpdateAchievementCriteria(ACHIEVEMENT_CRITERIA_TYPE_WIN_RATED_ARENA, std::max<uint32>(winnerArenaTeam->GetRating(), 1), 0, 0, NULL, player);
-                    }
             }
         }
         else
@@ -918,21 +833,174 @@ void Battleground::EndBattleground(uint32 winner)
         player->UpdateAchievementCriteria(ACHIEVEMENT_CRITERIA_TYPE_COMPLETE_BATTLEGROUND, 1);
     }
 
-    if (isArena() && isRated() && winnerArenaTeam && loserArenaTeam && winnerArenaTeam != loserArenaTeam)
+    if (winmsg_id)
+        SendMessageToAll(winmsg_id, ChatMsg::CHAT_MSG_BG_SYSTEM_NEUTRAL);
+}
+
+void Battleground::DeferAction(BattlegroundDeferredActionType type, uint64 guid, uint32 team)
+{
+    BattlegroundDeferredAction action = { type, guid, team };
+    m_DeferredActions.push_back(action);
+}
+
+void Battleground::ProcessDeferredActions()
+{
+    if (m_DeferredActions.empty())
+        return;
+
+    std::vector<BattlegroundDeferredAction> actions;
+    std::swap(actions, m_DeferredActions);
+
+    ArenaTeam* winnerArenaTeam = NULL;
+    ArenaTeam* loserArenaTeam = NULL;
+
+    uint32 winner = 0;
+    uint32 loserMatchmakerRating = 0;
+    int32  loserMatchmakerChange = 0;
+    uint32 winnerMatchmakerRating = 0;
+    int32  winnerMatchmakerChange = 0;
+    bool guildAwarded = false;
+
+    for (std::vector<BattlegroundDeferredAction>::const_iterator itr = actions.begin(); itr != actions.end(); ++itr)
+    {
+        switch (itr->Type)
+        {
+            case BG_DEFERRED_ANNOUNCE_START:
+                sWorld->SendWorldText(LANG_BG_STARTED_ANNOUNCE_WORLD, GetName(), GetMinLevel(), GetMaxLevel());
+                break;
+            case BG_DEFERRED_ARENA_RESULT:
+            {
+                winner = itr->Team;
+                winnerArenaTeam = sArenaTeamMgr->GetArenaTeamById(GetArenaTeamIdForTeam(winner));
+                loserArenaTeam = sArenaTeamMgr->GetArenaTeamById(GetArenaTeamIdForTeam(GetOtherTeam(winner)));
+
+                if (winnerArenaTeam && loserArenaTeam && winnerArenaTeam != loserArenaTeam)
+                {
+                    if (winner != WINNER_NONE)
+                    {
+                        int32 winnerChange = 0;
+                        int32 loserChange = 0;
+                        uint32 loserTeamRating = loserArenaTeam->GetRating();
+                        loserMatchmakerRating = GetArenaMatchmakerRating(GetOtherTeam(winner));
+                        uint32 winnerTeamRating = winnerArenaTeam->GetRating();
+                        winnerMatchmakerRating = GetArenaMatchmakerRating(winner);
+                        winnerMatchmakerChange = winnerArenaTeam->WonAgainst(winnerMatchmakerRating, loserMatchmakerRating, winnerChange);
+                        loserMatchmakerChange = loserArenaTeam->LostAgainst(loserMatchmakerRating, winnerMatchmakerRating, loserChange);
+                        SF_LOG_DEBUG("bg.arena", "match Type: %u --- Winner: old rating: %u, rating gain: %d, old MMR: %u, MMR gain: %d --- Loser: old rating: %u, rating loss: %d, old MMR: %u, MMR loss: %d ---", m_ArenaType, winnerTeamRating, winnerChange, winnerMatchmakerRating,
+                            winnerMatchmakerChange, loserTeamRating, loserChange, loserMatchmakerRating, loserMatchmakerChange);
+                        SetArenaMatchmakerRating(winner, winnerMatchmakerRating + winnerMatchmakerChange);
+                        SetArenaMatchmakerRating(GetOtherTeam(winner), loserMatchmakerRating + loserMatchmakerChange);
+                        SetArenaTeamRatingChangeForTeam(winner, winnerChange);
+                        SetArenaTeamRatingChangeForTeam(GetOtherTeam(winner), loserChange);
+                        SF_LOG_DEBUG("bg.arena", "Arena match Type: %u for Team1Id: %u - Team2Id: %u ended. WinnerTeamId: %u. Winner rating: +%d, Loser rating: %d", m_ArenaType, m_ArenaTeamIds[TEAM_ALLIANCE], m_ArenaTeamIds[TEAM_HORDE], winnerArenaTeam->GetId(), winnerChange, loserChange);
+                        if (sWorld->GetBoolConfig(WorldBoolConfigs::CONFIG_ARENA_LOG_EXTENDED_INFO))
+                            for (Battleground::BattlegroundScoreMap::const_iterator score = GetPlayerScoresBegin(); score != GetPlayerScoresEnd(); ++score)
+                                if (Player* player = ObjectAccessor::FindPlayer(score->first))
+                                {
+                                    SF_LOG_DEBUG("bg.arena", "Statistics match Type: %u for %s (GUID: " UI64FMTD ", IP: %s): %u damage, %u healing, %u killing blows",
+                                        m_ArenaType, player->GetName().c_str(), score->first, player->GetSession()->GetRemoteAddress().c_str(), score->second->DamageDone, score->second->HealingDone,
+                                        score->second->KillingBlows);
+                                }
+                    }
+                    // Deduct 16 points from each teams arena-rating if there are no winners after 45+2 minutes
+                    else
+                    {
+                        SetArenaTeamRatingChangeForTeam(ALLIANCE, ARENA_TIMELIMIT_POINTS_LOSS);
+                        SetArenaTeamRatingChangeForTeam(HORDE, ARENA_TIMELIMIT_POINTS_LOSS);
+                        winnerArenaTeam->FinishGame(ARENA_TIMELIMIT_POINTS_LOSS);
+                        loserArenaTeam->FinishGame(ARENA_TIMELIMIT_POINTS_LOSS);
+                    }
+                }
+                else
+                {
+                    SetArenaTeamRatingChangeForTeam(ALLIANCE, 0);
+                    SetArenaTeamRatingChangeForTeam(HORDE, 0);
+                    winnerArenaTeam = loserArenaTeam = NULL;
+                }
+                break;
+            }
+            case BG_DEFERRED_ARENA_MEMBER:
+            {
+                if (!winnerArenaTeam)
+                    break;
+
+                Player* player = ObjectAccessor::FindPlayer(itr->Guid);
+                // per player calculation, members who went offline lose in any case
+                if (!player)
+                {
+                    if (itr->Team == winner)
+                        winnerArenaTeam->OfflineMemberLost(itr->Guid, loserMatchmakerRating, winnerMatchmakerChange);
+                    else
+                        loserArenaTeam->OfflineMemberLost(itr->Guid, winnerMatchmakerRating, loserMatchmakerChange);
+                }
+                else if (itr->Team == winner)
+                {
+                    // update achievement BEFORE personal rating update
+                    uint32 rating = player->GetArenaPersonalRating(winnerArenaTeam->GetSlot());
+                    player->UpdateAchievementCriteria(ACHIEVEMENT_CRITERIA_TYPE_WIN_RATED_ARENA, rating ? rating : 1);
+                    player->UpdateAchievementCriteria(ACHIEVEMENT_CRITERIA_TYPE_WIN_ARENA, GetMapId());
+                    player->ModifyCurrency(CURRENCY_TYPE_CONQUEST_META_ARENA, sWorld->getIntConfig(WorldIntConfigs::CONFIG_CURRENCY_CONQUEST_POINTS_ARENA_REWARD));
+
+                    winnerArenaTeam->MemberWon(player, loserMatchmakerRating, winnerMatchmakerChange);
+
+                    if (!guildAwarded)
+                    {
+                        guildAwarded = true;
+                        if (uint32 guildId = FindBgMap() ? FindBgMap()->GetOwnerGuildId(player->GetTeam()) : 0)
+                            if (Guild* guild = sGuildMgr->GetGuildById(guildId))
+                                guild->UpdateAchievementCriteria(ACHIEVEMENT_CRITERIA_TYPE_WIN_RATED_ARENA, std::max<uint32>(winnerArenaTeam->GetRating(), 1), 0, 0, NULL, player);
+                    }
+                }
+                else
+                {
+                    loserArenaTeam->MemberLost(player, winnerMatchmakerRating, loserMatchmakerChange);
+
+                    // Arena lost => reset the win_rated_arena having the "no_lose" condition
+                    player->ResetAchievementCriteria(ACHIEVEMENT_CRITERIA_TYPE_WIN_RATED_ARENA, ACHIEVEMENT_CRITERIA_CONDITION_NO_LOSE);
+                }
+                break;
+            }
+            case BG_DEFERRED_ARENA_DESERTER:
+            {
+                //left a rated match while the encounter was in progress, consider as loser
+                ArenaTeam* others_arena_team = sArenaTeamMgr->GetArenaTeamById(GetArenaTeamIdForTeam(GetOtherTeam(itr->Team)));
+                ArenaTeam* players_arena_team = sArenaTeamMgr->GetArenaTeamById(GetArenaTeamIdForTeam(itr->Team));
+                if (!others_arena_team || !players_arena_team || others_arena_team == players_arena_team)
+                    break;
+
+                if (Player* player = ObjectAccessor::FindPlayer(itr->Guid))
+                    players_arena_team->MemberLost(player, GetArenaMatchmakerRating(GetOtherTeam(itr->Team)));
+                else
+                    players_arena_team->OfflineMemberLost(itr->Guid, GetArenaMatchmakerRating(GetOtherTeam(itr->Team)));
+                break;
+            }
+            case BG_DEFERRED_LEAVE_RAID:
+            {
+                // remove from raid group if player is member
+                if (Group* group = GetBgRaid(itr->Team))
+                {
+                    if (!group->RemoveMember(itr->Guid))        // group was disbanded
+                    {
+                        SetBgRaid(itr->Team, NULL);
+                    }
+                }
+                break;
+            }
+        }
+    }
+
+    if (winnerArenaTeam)
     {
-        /*
-        // save the stat changes
-        winnerArenaTeam->SaveToDB();
-        loserArenaTeam->SaveToDB();
-        */
         // send updated arena team stats to players
         // this way all arena team members will get notified, not only the ones who participated in this match
         winnerArenaTeam->NotifyStatsChanged();
         loserArenaTeam->NotifyStatsChanged();
-    }
 
-    if (winmsg_id)
-        SendMessageToAll(winmsg_id, ChatMsg::CHAT_MSG_BG_SYSTEM_NEUTRAL);
+        // the log sent by EndBattleground did not know the rating changes yet
+        WorldPacket pvpLogData;
+        sBattlegroundMgr->BuildPvpLogDataPacket(&pvpLogData, this);
+        SendPacketToAll(&pvpLogData);
+    }
 }
 
 uint32 Battleground::GetBonusHonorFromKill(uint32 kills) const
@@ -1007,14 +1075,9 @@ void Battleground::RemovePlayerAtLeave(uint64 guid, bool Transport, bool SendPac
                 player->RemovePet(NULL, PET_SAVE_NOT_IN_SLOT);
                 player->ResummonPetTemporaryUnSummonedIfAny();
 
+                //left a rated match while the encounter was in progress, consider as loser
                 if (isRated() && GetStatus() == STATUS_IN_PROGRESS)
-                {
-                    //left a rated match while the encounter was in progress, consider as loser
-                    ArenaTeam* winnerArenaTeam = sArenaTeamMgr->GetArenaTeamById(GetArenaTeamIdForTeam(GetOtherTeam(team)));
-                    ArenaTeam* loserArenaTeam = sArenaTeamMgr->GetArenaTeamById(GetArenaTeamIdForTeam(team));
-                    if (winnerArenaTeam && loserArenaTeam && winnerArenaTeam != loserArenaTeam)
-                        loserArenaTeam->MemberLost(player, GetArenaMatchmakerRating(GetOtherTeam(team)));
-                }
+                    DeferAction(BG_DEFERRED_ARENA_DESERTER, guid, team);
             }
             if (SendPacket)
             {
@@ -1029,24 +1092,12 @@ void Battleground::RemovePlayerAtLeave(uint64 guid, bool Transport, bool SendPac
         else
             // removing offline participant
         {
+            //left a rated match while the encounter was in progress, consider as loser
             if (isRated() && GetStatus() == STATUS_IN_PROGRESS)
-            {
-                //left a rated match while the encounter was in progress, consider as loser
-                ArenaTeam* others_arena_team = sArenaTeamMgr->GetArenaTeamById(GetArenaTeamIdForTeam(GetOtherTeam(team)));
-                ArenaTeam* players_arena_team = sArenaTeamMgr->GetArenaTeamById(GetArenaTeamIdForTeam(team));
-                if (others_arena_team && players_arena_team)
-                    players_arena_team->OfflineMemberLost(guid, GetArenaMatchmakerRating(GetOtherTeam(team)));
-            }
+                DeferAction(BG_DEFERRED_ARENA_DESERTER, guid, team);
         }
 
-        // remove from raid group if player is member
-        if (Group* group = GetBgRaid(team))
-        {
-            if (!group->RemoveMember(guid))                // group was disbanded
-            {
-                SetBgRaid(team, NULL);
-            }
-        }
+        DeferAction(BG_DEFERRED_LEAVE_RAID, guid, team);
         DecreaseInvitedCount(team);
         //we should update battleground queue, but only if bg isn't ending
         if (isBattleground() && GetStatus() < STATUS_WAIT_LEAVE)
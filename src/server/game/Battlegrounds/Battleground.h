@@ -156,6 +156,23 @@ struct BattlegroundPlayer
     int32   ActiveSpec;                                     // Player's active spec
 };
 
+// changes to state shared by all maps, made while the battleground runs in its map thread
+enum BattlegroundDeferredActionType
+{
+    BG_DEFERRED_ANNOUNCE_START = 0,                         // world announcement of the battleground start
+    BG_DEFERRED_ARENA_RESULT = 1,                           // rated arena ended, Team is the winner
+    BG_DEFERRED_ARENA_MEMBER = 2,                           // rating of a participant, follows BG_DEFERRED_ARENA_RESULT
+    BG_DEFERRED_ARENA_DESERTER = 3,                         // participant left a rated arena in progress
+    BG_DEFERRED_LEAVE_RAID = 4                              // participant left, remove from the battleground raid
+};
+
+struct BattlegroundDeferredAction
+{
+    BattlegroundDeferredActionType Type;
+    uint64  Guid;
+    uint32  Team;
+};
+
 struct BattlegroundObjectInfo
 {
     BattlegroundObjectInfo() : object(NULL), timer(0), spellid(0) { }
@@ -278,6 +295,8 @@ public:
     virtual ~Battleground();
 
     void Update(uint32 diff);
+    // applies the deferred actions, only called from the world thread by BattlegroundMgr::Update
+    void ProcessDeferredActions();
 
     virtual bool SetupBattleground()                    // must be implemented in BG subclass
     {
@@ -650,6 +669,10 @@ private:
     // Raid Group
     Group* m_BgRaids[BG_TEAMS_COUNT];                   // 0 - alliance, 1 - horde
 
+    // arena teams, groups and the world session list are not owned by the map, see ProcessDeferredActions
+    void DeferAction(BattlegroundDeferredActionType type, uint64 guid = 0, uint32 team = 0);
+    std::vector<BattlegroundDeferredAction> m_DeferredActions;
+
     // Players count by team
     uint32 m_PlayersCount[BG_TEAMS_COUNT];
 
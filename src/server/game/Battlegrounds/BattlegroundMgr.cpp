@@ -81,7 +81,13 @@ void BattlegroundMgr::Update(uint32 diff)
             itrDelete = itr++;
             Battleground* bg = itrDelete->second;
 
-            bg->Update(diff);
+            // once the map exists the battleground is updated by BattlegroundMap::Update
+            if (!bg->FindBgMap())
+                bg->Update(diff);
+
+            // map jobs are done, side effects on state shared between maps are safe to apply now
+            bg->ProcessDeferredActions();
+
             if (bg->ToBeDeleted())
             {
                 itrDelete->second = NULL;
@@ -1338,8 +1344,8 @@ void BattlegroundMgr::SetHolidayWeekends(uint32 mask)
 
 void BattlegroundMgr::ScheduleQueueUpdate(uint32 arenaMatchmakerRating, uint8 arenaType, BattlegroundQueueTypeId bgQueueTypeId, BattlegroundTypeId bgTypeId, BattlegroundBracketId bracket_id)
 {
-    //This method must be atomic, @todo add mutex
     //we will use only 1 number created of bgTypeId and bracket_id
+    std::lock_guard<std::mutex> guard(m_QueueUpdateLock);
     ScheduledQueueUpdate scheduleId = { arenaMatchmakerRating, arenaType, bgQueueTypeId, bgTypeId, bracket_id };
     if (std::find(m_QueueUpdateScheduler.begin(), m_QueueUpdateScheduler.end(), scheduleId) == m_QueueUpdateScheduler.end())
         m_QueueUpdateScheduler.push_back(scheduleId);
@@ -1499,11 +1505,13 @@ BGFreeSlotQueueContainer& BattlegroundMgr::GetBGFreeSlotQueueStore(BattlegroundT
 
 void BattlegroundMgr::AddToBGFreeSlotQueue(BattlegroundTypeId bgTypeId, Battleground* bg)
 {
+    std::lock_guard<std::mutex> guard(m_QueueUpdateLock);
     bgDataStore[bgTypeId].BGFreeSlotQueue.push_front(bg);
 }
 
 void BattlegroundMgr::RemoveFromBGFreeSlotQueue(BattlegroundTypeId bgTypeId, uint32 instanceId)
 {
+    std::lock_guard<std::mutex> guard(m_QueueUpdateLock);
     BGFreeSlotQueueContainer& queues = bgDataStore[bgTypeId].BGFreeSlotQueue;
     for (BGFreeSlotQueueContainer::iterator itr = queues.begin(); itr != queues.end(); ++itr)
         if ((*itr)->GetInstanceID() == instanceId)
@@ -11,6 +11,7 @@
 #include "Common.h"
 #include "DBCEnums.h"
 #include <ace/Singleton.h>
+#include <mutex>
 
 typedef std::map<uint32, Battleground*> BattlegroundContainer;
 typedef std::set<uint32> BattlegroundClientIdsContainer;
@@ -148,6 +149,7 @@ private:
     BattlegroundSelectionWeightMap m_ArenaSelectionWeights;
     BattlegroundSelectionWeightMap m_BGSelectionWeights;
     std::vector<ScheduledQueueUpdate> m_QueueUpdateScheduler;
+    std::mutex m_QueueUpdateLock;                           // battlegrounds with a map are updated in map threads
     uint32 m_NextRatedArenaUpdate;
     bool   m_ArenaTesting;
     bool   m_Testing;
@@ -187,8 +187,10 @@ void Channel::JoinChannel(Player* player, std::string const& pass)
 
     PlayerInfo pinfo;
     pinfo.player = guid;
+    pinfo.plr = player;
     pinfo.flags = MEMBER_FLAG_NONE;
     playersStore[guid] = pinfo;
+    ApplyMemberIgnores(player, true);
 
     WorldPacket data;
     MakeYouJoined(&data);
@@ -238,6 +240,7 @@ void Channel::LeaveChannel(Player* player, bool send)
     bool changeowner = playersStore[guid].IsOwner();
 
     playersStore.erase(guid);
+    ApplyMemberIgnores(player, false);
 
     if (_announce && !player->GetSession()->HasPermission(rbac::RBAC_PERM_SILENTLY_JOIN_CHANNEL))
     {
@@ -323,6 +326,7 @@ void Channel::KickOrBan(Player const* player, std::string const& badname, bool b
     }
 
     playersStore.erase(victim);
+    ApplyMemberIgnores(bad, false);
     bad->LeftChannel(this);
 
     if (changeowner && _ownership && !playersStore.empty())
@@ -530,7 +534,9 @@ void Channel::List(Player const* player)
     uint32 count = 0;
     for (PlayerContainer::const_iterator i = playersStore.begin(); i != playersStore.end(); ++i)
     {
-        Player* member = ObjectAccessor::FindPlayer(i->first);
+        Player* member = i->second.plr;
+        if (member && !member->IsInWorld())
+            member = NULL;
 
         // PLAYER can't see MODERATOR, GAME MASTER, ADMINISTRATOR characters
         // MODERATOR, GAME MASTER, ADMINISTRATOR can see all
@@ -714,26 +720,61 @@ void Channel::SetOwner(uint64 guid, bool exclaim)
 
 void Channel::SendToAll(WorldPacket* data, uint64 guid)
 {
+    // only look at social lists when some member actually ignores the sender
+    bool checkIgnore = guid && ignoreStore.find(GUID_LOPART(guid)) != ignoreStore.end();
+
     for (PlayerContainer::const_iterator i = playersStore.begin(); i != playersStore.end(); ++i)
-        if (Player* player = ObjectAccessor::FindPlayer(i->first))
-            if (!guid || !player->GetSocial()->HasIgnore(GUID_LOPART(guid)))
-                player->GetSession()->SendPacket(data);
+    {
+        Player* player = i->second.plr;
+        if (!player || !player->IsInWorld())
+            continue;
+
+        if (checkIgnore && player->GetSocial()->HasIgnore(GUID_LOPART(guid)))
+            continue;
+
+        player->GetSession()->SendPacket(data);
+    }
 }
 
 void Channel::SendToAllButOne(WorldPacket* data, uint64 who)
 {
     for (PlayerContainer::const_iterator i = playersStore.begin(); i != playersStore.end(); ++i)
         if (i->first != who)
-            if (Player* player = ObjectAccessor::FindPlayer(i->first))
-                player->GetSession()->SendPacket(data);
+            if (Player* player = i->second.plr)
+                if (player->IsInWorld())
+                    player->GetSession()->SendPacket(data);
 }
 
 void Channel::SendToOne(WorldPacket* data, uint64 who)
 {
-    if (Player* player = ObjectAccessor::FindPlayer(who))
+    PlayerContainer::const_iterator itr = playersStore.find(who);
+    Player* player = itr != playersStore.end() ? itr->second.plr : ObjectAccessor::FindPlayer(who);
+    if (player && player->IsInWorld())
         player->GetSession()->SendPacket(data);
 }
 
+void Channel::ApplyMemberIgnores(Player* player, bool apply)
+{
+    std::vector<uint32> ignored;
+    player->GetSocial()->GetIgnoredGUIDs(ignored);
+
+    for (std::vector<uint32>::const_iterator itr = ignored.begin(); itr != ignored.end(); ++itr)
+        SetIgnore(*itr, apply);
+}
+
+void Channel::SetIgnore(uint32 ignoredGuid, bool apply)
+{
+    if (apply)
+    {
+        ++ignoreStore[ignoredGuid];
+        return;
+    }
+
+    IgnoreContainer::iterator itr = ignoreStore.find(ignoredGuid);
+    if (itr != ignoreStore.end() && --itr->second == 0)
+        ignoreStore.erase(itr);
+}
+
 void Channel::Voice(uint64 /*guid1*/, uint64 /*guid2*/) { }
 
 void Channel::DeVoice(uint64 /*guid1*/, uint64 /*guid2*/) { }
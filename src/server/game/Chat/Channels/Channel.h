@@ -12,6 +12,7 @@
 #include <list>
 #include <map>
 #include <string>
+#include <vector>
 
 class Player;
 
@@ -107,8 +108,9 @@ class Channel
 {
     struct PlayerInfo
     {
-        PlayerInfo() : player(0), flags(0) { }
+        PlayerInfo() : player(0), plr(NULL), flags(0) { }
         uint64 player;
+        Player* plr;                                        // valid while member, players leave all channels on logout
         uint8 flags;
 
         bool HasFlag(uint8 flag) const { return flags & flag; }
@@ -171,6 +173,7 @@ public:
     void JoinNotify(ObjectGuid UserGUID, uint32 ChannelID, uint8 ChannelFlags, uint8 UserFlags, std::string const& ChannelName); // invisible notify                                          // invisible notify
     void LeaveNotify(ObjectGuid UserGUID, uint32 ChannelID, uint8 ChannelFlags, std::string const& ChannelName);                 // invisible notify  
     void SetOwnership(bool ownership) { _ownership = ownership; };
+    void SetIgnore(uint32 ignoredGuid, bool apply);
     static void CleanOldChannelsInDB();
 
 private:
@@ -216,6 +219,8 @@ private:
     void SendToAllButOne(WorldPacket* data, uint64 who);
     void SendToOne(WorldPacket* data, uint64 who);
 
+    void ApplyMemberIgnores(Player* player, bool apply);
+
     bool IsOn(uint64 who) const { return playersStore.find(who) != playersStore.end(); }
     bool IsBanned(uint64 guid) const { return bannedStore.find(guid) != bannedStore.end(); }
 
@@ -256,6 +261,7 @@ private:
 
     typedef std::map<uint64, PlayerInfo> PlayerContainer;
     typedef std::set<uint64> BannedContainer;
+    typedef UNORDERED_MAP<uint32, uint32> IgnoreContainer;  // ignored low guid -> number of members ignoring it
 
     bool _announce;
     bool _ownership;
@@ -268,5 +274,6 @@ private:
     std::string _password;
     PlayerContainer playersStore;
     BannedContainer bannedStore;
+    IgnoreContainer ignoreStore;
 };
 #endif
@@ -14,6 +14,7 @@
 
 namespace lfg
 {
+    static_assert(LFG_COMPATIBILITY_KEY_SIZE == MAXGROUPSIZE, "LfgCompatibilityKey must hold a full group");
 
     /**
        Given a list of guids returns the concatenation using | as delimiter
@@ -39,6 +40,39 @@ namespace lfg
         return o.str();
     }
 
+    LfgCompatibilityKey::LfgCompatibilityKey(LfgGuidList const& check) : size(0)
+    {
+        for (LfgGuidList::const_iterator it = check.begin(); it != check.end() && size < LFG_COMPATIBILITY_KEY_SIZE; ++it)
+            guids[size++] = *it;
+
+        // need the guids in order to avoid duplicates
+        std::sort(guids, guids + size);
+        size = uint8(std::unique(guids, guids + size) - guids);
+    }
+
+    bool LfgCompatibilityKey::Contains(uint64 guid) const
+    {
+        return std::find(guids, guids + size, guid) != guids + size;
+    }
+
+    std::string LfgCompatibilityKey::ToString() const
+    {
+        return ConcatenateGuids(LfgGuidList(guids, guids + size));
+    }
+
+    bool LfgCompatibilityKey::operator==(LfgCompatibilityKey const& right) const
+    {
+        return size == right.size && std::equal(guids, guids + size, right.guids);
+    }
+
+    size_t LfgCompatibilityKeyHash::operator()(LfgCompatibilityKey const& key) const
+    {
+        uint64 hash = key.size;
+        for (uint8 i = 0; i < key.size; ++i)
+            hash = hash * 0x100000001B3ULL ^ key.guids[i];
+        return size_t(hash ^ (hash >> 32));
+    }
+
     char const* GetCompatibleString(LfgCompatibility compatibles)
     {
         switch (compatibles)
@@ -89,17 +123,13 @@ namespace lfg
         RemoveFromCurrentQueue(guid);
         RemoveFromCompatibles(guid);
 
-        std::ostringstream o;
-        o << guid;
-        std::string sguid = o.str();
-
         LfgQueueDataContainer::iterator itDelete = QueueDataStore.end();
         for (LfgQueueDataContainer::iterator itr = QueueDataStore.begin(); itr != QueueDataStore.end(); ++itr)
             if (itr->first != guid)
             {
-                if (std::string::npos != itr->second.bestCompatible.find(sguid))
+                if (itr->second.bestCompatible.Contains(guid))
                 {
-                    itr->second.bestCompatible.clear();
+                    itr->second.bestCompatible = LfgCompatibilityKey();
                     FindBestCompatibleInQueue(itr);
                 }
             }
@@ -178,43 +208,76 @@ namespace lfg
     */
     void LFGQueue::RemoveFromCompatibles(uint64 guid)
     {
-        std::stringstream out;
-        out << guid;
-        std::string strGuid = out.str();
-
         SF_LOG_DEBUG("lfg.queue.data.compatibles.remove", "Removing [%u]", GUID_LOPART(guid));
-        for (LfgCompatibleContainer::iterator itNext = CompatibleMapStore.begin(); itNext != CompatibleMapStore.end();)
+
+        LfgCompatibleKeysContainer::iterator itKeys = CompatibleKeysStore.find(guid);
+        if (itKeys == CompatibleKeysStore.end())
+            return;
+
+        std::vector<LfgCompatibilityKey> keys;
+        keys.swap(itKeys->second);
+        CompatibleKeysStore.erase(itKeys);
+
+        for (std::vector<LfgCompatibilityKey>::const_iterator itr = keys.begin(); itr != keys.end(); ++itr)
         {
-            LfgCompatibleContainer::iterator it = itNext++;
-            if (std::string::npos != it->first.find(strGuid))
-                CompatibleMapStore.erase(it);
+            CompatibleMapStore.erase(*itr);
+
+            // drop the key from the other guids of the combination too
+            for (uint8 i = 0; i < itr->size; ++i)
+            {
+                if (itr->guids[i] == guid)
+                    continue;
+
+                LfgCompatibleKeysContainer::iterator itOther = CompatibleKeysStore.find(itr->guids[i]);
+                if (itOther == CompatibleKeysStore.end())
+                    continue;
+
+                std::vector<LfgCompatibilityKey>& otherKeys = itOther->second;
+                otherKeys.erase(std::remove(otherKeys.begin(), otherKeys.end(), *itr), otherKeys.end());
+            }
         }
     }
 
+    /**
+       Returns the cached data of a list of guids, creating it (and indexing the key
+       by each of its guids) if needed
+
+       @param[in]     key Sorted guids of the combination
+    */
+    LfgCompatibilityData& LFGQueue::InsertCompatibilityData(LfgCompatibilityKey const& key)
+    {
+        std::pair<LfgCompatibleContainer::iterator, bool> result = CompatibleMapStore.insert(LfgCompatibleContainer::value_type(key, LfgCompatibilityData()));
+        if (result.second)
+            for (uint8 i = 0; i < key.size; ++i)
+                CompatibleKeysStore[key.guids[i]].push_back(key);
+
+        return result.first->second;
+    }
+
     /**
        Stores the compatibility of a list of guids
 
-       @param[in]     key String concatenation of guids (| used as separator)
+       @param[in]     key Sorted guids of the combination
        @param[in]     compatibles type of compatibility
     */
-    void LFGQueue::SetCompatibles(std::string const& key, LfgCompatibility compatibles)
+    void LFGQueue::SetCompatibles(LfgCompatibilityKey const& key, LfgCompatibility compatibles)
     {
-        LfgCompatibilityData& data = CompatibleMapStore[key];
+        LfgCompatibilityData& data = InsertCompatibilityData(key);
         data.compatibility = compatibles;
     }
 
-    void LFGQueue::SetCompatibilityData(std::string const& key, LfgCompatibilityData const& data)
+    void LFGQueue::SetCompatibilityData(LfgCompatibilityKey const& key, LfgCompatibilityData const& data)
     {
-        CompatibleMapStore[key] = data;
+        InsertCompatibilityData(key) = data;
     }
 
     /**
        Get the compatibility of a group of guids
 
-       @param[in]     key String concatenation of guids (| used as separator)
+       @param[in]     key Sorted guids of the combination
        @return LfgCompatibility type of compatibility
     */
-    LfgCompatibility LFGQueue::GetCompatibles(std::string const& key)
+    LfgCompatibility LFGQueue::GetCompatibles(LfgCompatibilityKey const& key)
     {
         LfgCompatibleContainer::iterator itr = CompatibleMapStore.find(key);
         if (itr != CompatibleMapStore.end())
@@ -223,7 +286,7 @@ namespace lfg
         return LFG_COMPATIBILITY_PENDING;
     }
 
-    LfgCompatibilityData* LFGQueue::GetCompatibilityData(std::string const& key)
+    LfgCompatibilityData* LFGQueue::GetCompatibilityData(LfgCompatibilityKey const& key)
     {
         LfgCompatibleContainer::iterator itr = CompatibleMapStore.find(key);
         if (itr != CompatibleMapStore.end())
@@ -264,17 +327,20 @@ namespace lfg
     */
     LfgCompatibility LFGQueue::FindNewGroups(LfgGuidList& check, LfgGuidList& all)
     {
-        std::string strGuids = ConcatenateGuids(check);
-        LfgCompatibility compatibles = GetCompatibles(strGuids);
+        if (check.size() > MAXGROUPSIZE)
+            return LFG_INCOMPATIBLES_WRONG_GROUP_SIZE;
+
+        LfgCompatibilityKey key(check);
+        LfgCompatibility compatibles = GetCompatibles(key);
 
-        SF_LOG_DEBUG("lfg.queue.match.check", "Guids: (%s): %s - all(%s)", strGuids.c_str(), GetCompatibleString(compatibles), ConcatenateGuids(all).c_str());
+        SF_LOG_DEBUG("lfg.queue.match.check", "Guids: (%s): %s - all(%s)", key.ToString().c_str(), GetCompatibleString(compatibles), ConcatenateGuids(all).c_str());
         if (compatibles == LFG_COMPATIBILITY_PENDING) // Not previously cached, calculate
             compatibles = CheckCompatibility(check);
 
         if (compatibles == LFG_COMPATIBLES_BAD_STATES && sLFGMgr->AllQueued(check))
         {
-            SF_LOG_DEBUG("lfg.queue.match.check", "Guids: (%s) compatibles (cached) changed from bad states to match", strGuids.c_str());
-            SetCompatibles(strGuids, LFG_COMPATIBLES_MATCH);
+            SF_LOG_DEBUG("lfg.queue.match.check", "Guids: (%s) compatibles (cached) changed from bad states to match", key.ToString().c_str());
+            SetCompatibles(key, LFG_COMPATIBLES_MATCH);
             return LFG_COMPATIBLES_MATCH;
         }
 
@@ -302,7 +368,7 @@ namespace lfg
     */
     LfgCompatibility LFGQueue::CheckCompatibility(LfgGuidList check)
     {
-        std::string strGuids = ConcatenateGuids(check);
+        LfgCompatibilityKey key(check);
         LfgProposal proposal;
         LfgDungeonSet proposalDungeons;
         LfgGroupsMap proposalGroups;
@@ -311,7 +377,7 @@ namespace lfg
         // Check for correct size
         if (check.size() > MAXGROUPSIZE || check.empty())
         {
-            SF_LOG_DEBUG("lfg.queue.match.compatibility.check", "Guids: (%s): Size wrong - Not compatibles", strGuids.c_str());
+            SF_LOG_DEBUG("lfg.queue.match.compatibility.check", "Guids: (%s): Size wrong - Not compatibles", key.ToString().c_str());
             return LFG_INCOMPATIBLES_WRONG_GROUP_SIZE;
         }
 
@@ -325,8 +391,8 @@ namespace lfg
             LfgCompatibility child_compatibles = CheckCompatibility(check);
             if (child_compatibles < LFG_COMPATIBLES_WITH_LESS_PLAYERS) // Group not compatible
             {
-                SF_LOG_DEBUG("lfg.queue.match.compatibility.check", "Guids: (%s) child %s not compatibles", strGuids.c_str(), ConcatenateGuids(check).c_str());
-                SetCompatibles(strGuids, child_compatibles);
+                SF_LOG_DEBUG("lfg.queue.match.compatibility.check", "Guids: (%s) child %s not compatibles", key.ToString().c_str(), ConcatenateGuids(check).c_str());
+                SetCompatibles(key, child_compatibles);
                 return child_compatibles;
             }
             check.push_front(frontGuid);
@@ -363,29 +429,29 @@ namespace lfg
         // Group with less that MAXGROUPSIZE members always compatible
         if (check.size() == 1 && numPlayers != MAXGROUPSIZE)
         {
-            SF_LOG_DEBUG("lfg.queue.match.compatibility.check", "Guids: (%s) sigle group. Compatibles", strGuids.c_str());
+            SF_LOG_DEBUG("lfg.queue.match.compatibility.check", "Guids: (%s) sigle group. Compatibles", key.ToString().c_str());
             LfgQueueDataContainer::iterator itQueue = QueueDataStore.find(check.front());
 
             LfgCompatibilityData data(LFG_COMPATIBLES_WITH_LESS_PLAYERS);
             data.roles = itQueue->second.roles;
             LFGMgr::CheckGroupRoles(data.roles);
 
-            UpdateBestCompatibleInQueue(itQueue, strGuids, data.roles);
-            SetCompatibilityData(strGuids, data);
+            UpdateBestCompatibleInQueue(itQueue, key, data.roles);
+            SetCompatibilityData(key, data);
             return LFG_COMPATIBLES_WITH_LESS_PLAYERS;
         }
 
         if (numLfgGroups > 1)
         {
-            SF_LOG_DEBUG("lfg.queue.match.compatibility.check", "Guids: (%s) More than one Lfggroup (%u)", strGuids.c_str(), numLfgGroups);
-            SetCompatibles(strGuids, LFG_INCOMPATIBLES_MULTIPLE_LFG_GROUPS);
+            SF_LOG_DEBUG("lfg.queue.match.compatibility.check", "Guids: (%s) More than one Lfggroup (%u)", key.ToString().c_str(), numLfgGroups);
+            SetCompatibles(key, LFG_INCOMPATIBLES_MULTIPLE_LFG_GROUPS);
             return LFG_INCOMPATIBLES_MULTIPLE_LFG_GROUPS;
         }
 
         if (numPlayers > MAXGROUPSIZE)
         {
-            SF_LOG_DEBUG("lfg.queue.match.compatibility.check", "Guids: (%s) Too much players (%u)", strGuids.c_str(), numPlayers);
-            SetCompatibles(strGuids, LFG_INCOMPATIBLES_TOO_MUCH_PLAYERS);
+            SF_LOG_DEBUG("lfg.queue.match.compatibility.check", "Guids: (%s) Too much players (%u)", key.ToString().c_str(), numPlayers);
+            SetCompatibles(key, LFG_INCOMPATIBLES_TOO_MUCH_PLAYERS);
             return LFG_INCOMPATIBLES_TOO_MUCH_PLAYERS;
         }
 
@@ -414,8 +480,8 @@ namespace lfg
 
             if (uint8 playersize = numPlayers - proposalRoles.size())
             {
-                SF_LOG_DEBUG("lfg.queue.match.compatibility.check", "Guids: (%s) not compatible, %u players are ignoring each other", strGuids.c_str(), playersize);
-                SetCompatibles(strGuids, LFG_INCOMPATIBLES_HAS_IGNORES);
+                SF_LOG_DEBUG("lfg.queue.match.compatibility.check", "Guids: (%s) not compatible, %u players are ignoring each other", key.ToString().c_str(), playersize);
+                SetCompatibles(key, LFG_INCOMPATIBLES_HAS_IGNORES);
                 return LFG_INCOMPATIBLES_HAS_IGNORES;
             }
 
@@ -426,8 +492,8 @@ namespace lfg
                 for (LfgRolesMap::const_iterator it = debugRoles.begin(); it != debugRoles.end(); ++it)
                     o << ", " << it->first << ": " << GetRolesString(it->second);
 
-                SF_LOG_DEBUG("lfg.queue.match.compatibility.check", "Guids: (%s) Roles not compatible%s", strGuids.c_str(), o.str().c_str());
-                SetCompatibles(strGuids, LFG_INCOMPATIBLES_NO_ROLES);
+                SF_LOG_DEBUG("lfg.queue.match.compatibility.check", "Guids: (%s) Roles not compatible%s", key.ToString().c_str(), o.str().c_str());
+                SetCompatibles(key, LFG_INCOMPATIBLES_NO_ROLES);
                 return LFG_INCOMPATIBLES_NO_ROLES;
             }
 
@@ -446,8 +512,8 @@ namespace lfg
 
             if (proposalDungeons.empty())
             {
-                SF_LOG_DEBUG("lfg.queue.match.compatibility.check", "Guids: (%s) No compatible dungeons%s", strGuids.c_str(), o.str().c_str());
-                SetCompatibles(strGuids, LFG_INCOMPATIBLES_NO_DUNGEONS);
+                SF_LOG_DEBUG("lfg.queue.match.compatibility.check", "Guids: (%s) No compatible dungeons%s", key.ToString().c_str(), o.str().c_str());
+                SetCompatibles(key, LFG_INCOMPATIBLES_NO_DUNGEONS);
                 return LFG_INCOMPATIBLES_NO_DUNGEONS;
             }
         }
@@ -463,14 +529,14 @@ namespace lfg
         // Enough players?
         if (numPlayers != MAXGROUPSIZE)
         {
-            SF_LOG_DEBUG("lfg.queue.match.compatibility.check", "Guids: (%s) Compatibles but not enough players(%u)", strGuids.c_str(), numPlayers);
+            SF_LOG_DEBUG("lfg.queue.match.compatibility.check", "Guids: (%s) Compatibles but not enough players(%u)", key.ToString().c_str(), numPlayers);
             LfgCompatibilityData data(LFG_COMPATIBLES_WITH_LESS_PLAYERS);
             data.roles = proposalRoles;
 
             for (LfgGuidList::const_iterator itr = check.begin(); itr != check.end(); ++itr)
-                UpdateBestCompatibleInQueue(QueueDataStore.find(*itr), strGuids, data.roles);
+                UpdateBestCompatibleInQueue(QueueDataStore.find(*itr), key, data.roles);
 
-            SetCompatibilityData(strGuids, data);
+            SetCompatibilityData(key, data);
             return LFG_COMPATIBLES_WITH_LESS_PLAYERS;
         }
 
@@ -480,8 +546,8 @@ namespace lfg
 
         if (!sLFGMgr->AllQueued(check))
         {
-            SF_LOG_DEBUG("lfg.queue.match.compatibility.check", "Guids: (%s) Group MATCH but can't create proposal!", strGuids.c_str());
-            SetCompatibles(strGuids, LFG_COMPATIBLES_BAD_STATES);
+            SF_LOG_DEBUG("lfg.queue.match.compatibility.check", "Guids: (%s) Group MATCH but can't create proposal!", key.ToString().c_str());
+            SetCompatibles(key, LFG_COMPATIBLES_BAD_STATES);
             return LFG_COMPATIBLES_BAD_STATES;
         }
 
@@ -522,8 +588,8 @@ namespace lfg
 
         sLFGMgr->AddProposal(proposal);
 
-        SF_LOG_DEBUG("lfg.queue.match.compatibility.check", "Guids: (%s) MATCH! Group formed", strGuids.c_str());
-        SetCompatibles(strGuids, LFG_COMPATIBLES_MATCH);
+        SF_LOG_DEBUG("lfg.queue.match.compatibility.check", "Guids: (%s) MATCH! Group formed", key.ToString().c_str());
+        SetCompatibles(key, LFG_COMPATIBLES_MATCH);
         return LFG_COMPATIBLES_MATCH;
     }
 
@@ -565,7 +631,7 @@ namespace lfg
                     break;
             }
 
-            if (queueinfo.bestCompatible.empty())
+            if (queueinfo.bestCompatible.IsEmpty())
                 FindBestCompatibleInQueue(itQueue);
 
             LfgQueueStatusData queueData(queueId, dungeonId, queueinfo.joinTime, waitTime, wtAvg, wtTank, wtHealer, wtDps, queuedTime, queueinfo.tanks, queueinfo.healers, queueinfo.dps);
@@ -618,7 +684,7 @@ namespace lfg
         o << "Compatible Map size: " << CompatibleMapStore.size() << "\n";
         if (full)
             for (LfgCompatibleContainer::const_iterator itr = CompatibleMapStore.begin(); itr != CompatibleMapStore.end(); ++itr)
-                o << "(" << itr->first << "): " << GetCompatibleString(itr->second.compatibility) << "\n";
+                o << "(" << itr->first.ToString() << "): " << GetCompatibleString(itr->second.compatibility) << "\n";
 
         return o.str();
     }
@@ -626,32 +692,28 @@ namespace lfg
     void LFGQueue::FindBestCompatibleInQueue(LfgQueueDataContainer::iterator itrQueue)
     {
         SF_LOG_DEBUG("lfg.queue.compatibles.find", "Guid: " UI64FMTD, itrQueue->first);
-        std::ostringstream o;
-        o << itrQueue->first;
-        std::string sguid = o.str();
 
-        for (LfgCompatibleContainer::const_iterator itr = CompatibleMapStore.begin(); itr != CompatibleMapStore.end(); ++itr)
-            if (itr->second.compatibility == LFG_COMPATIBLES_WITH_LESS_PLAYERS &&
-                std::string::npos != itr->first.find(sguid))
-            {
+        LfgCompatibleKeysContainer::const_iterator itKeys = CompatibleKeysStore.find(itrQueue->first);
+        if (itKeys == CompatibleKeysStore.end())
+            return;
+
+        for (std::vector<LfgCompatibilityKey>::const_iterator itKey = itKeys->second.begin(); itKey != itKeys->second.end(); ++itKey)
+        {
+            LfgCompatibleContainer::const_iterator itr = CompatibleMapStore.find(*itKey);
+            if (itr != CompatibleMapStore.end() && itr->second.compatibility == LFG_COMPATIBLES_WITH_LESS_PLAYERS)
                 UpdateBestCompatibleInQueue(itrQueue, itr->first, itr->second.roles);
-            }
+        }
     }
 
-    void LFGQueue::UpdateBestCompatibleInQueue(LfgQueueDataContainer::iterator itrQueue, std::string const& key, LfgRolesMap const& roles)
+    void LFGQueue::UpdateBestCompatibleInQueue(LfgQueueDataContainer::iterator itrQueue, LfgCompatibilityKey const& key, LfgRolesMap const& roles)
     {
         LfgQueueData& queueData = itrQueue->second;
 
-        uint8 storedSize = queueData.bestCompatible.empty() ? 0 :
-            std::count(queueData.bestCompatible.begin(), queueData.bestCompatible.end(), '|') + 1;
-
-        uint8 size = std::count(key.begin(), key.end(), '|') + 1;
-
-        if (size <= storedSize)
+        if (key.size <= queueData.bestCompatible.size)
             return;
 
         SF_LOG_DEBUG("lfg.queue.compatibles.update", "Changed (%s) to (%s) as best compatible group for " UI64FMTD,
-            queueData.bestCompatible.c_str(), key.c_str(), itrQueue->first);
+            queueData.bestCompatible.ToString().c_str(), key.ToString().c_str(), itrQueue->first);
 
         queueData.bestCompatible = key;
         queueData.tanks = LFG_TANKS_NEEDED;
@@ -25,6 +25,29 @@ namespace lfg
         LFG_COMPATIBLES_MATCH                                  // Must be the last one
     };
 
+    uint8 const LFG_COMPATIBILITY_KEY_SIZE = 5;               // MAXGROUPSIZE, checked in LFGQueue.cpp
+
+    /// Sorted guids of a combination of queued players/groups, used as compatibility cache key
+    struct LfgCompatibilityKey
+    {
+        LfgCompatibilityKey() : size(0) { }
+        explicit LfgCompatibilityKey(LfgGuidList const& check);
+
+        bool Contains(uint64 guid) const;
+        bool IsEmpty() const { return !size; }
+        std::string ToString() const;
+
+        bool operator==(LfgCompatibilityKey const& right) const;
+
+        uint64 guids[LFG_COMPATIBILITY_KEY_SIZE];
+        uint8 size;
+    };
+
+    struct LfgCompatibilityKeyHash
+    {
+        size_t operator()(LfgCompatibilityKey const& key) const;
+    };
+
     struct LfgCompatibilityData
     {
         LfgCompatibilityData() : compatibility(LFG_COMPATIBILITY_PENDING) { }
@@ -54,7 +77,7 @@ namespace lfg
         uint8 dps;                                             ///< Dps needed
         LfgDungeonSet dungeons;                                ///< Selected Player/Group Dungeon/s
         LfgRolesMap roles;                                     ///< Selected Player Role/s
-        std::string bestCompatible;                            ///< Best compatible combination of people queued
+        LfgCompatibilityKey bestCompatible;                    ///< Best compatible combination of people queued
     };
 
     struct LfgWaitTime
@@ -65,7 +88,8 @@ namespace lfg
     };
 
     typedef std::map<uint32, LfgWaitTime> LfgWaitTimesContainer;
-    typedef std::map<std::string, LfgCompatibilityData> LfgCompatibleContainer;
+    typedef UNORDERED_MAP<LfgCompatibilityKey, LfgCompatibilityData, LfgCompatibilityKeyHash> LfgCompatibleContainer;
+    typedef UNORDERED_MAP<uint64, std::vector<LfgCompatibilityKey> > LfgCompatibleKeysContainer;
     typedef std::map<uint64, LfgQueueData> LfgQueueDataContainer;
 
     /**
@@ -106,14 +130,15 @@ namespace lfg
         void RemoveFromNewQueue(uint64 guid);
         void RemoveFromCurrentQueue(uint64 guid);
 
-        void SetCompatibles(std::string const& key, LfgCompatibility compatibles);
-        LfgCompatibility GetCompatibles(std::string const& key);
+        void SetCompatibles(LfgCompatibilityKey const& key, LfgCompatibility compatibles);
+        LfgCompatibility GetCompatibles(LfgCompatibilityKey const& key);
         void RemoveFromCompatibles(uint64 guid);
 
-        void SetCompatibilityData(std::string const& key, LfgCompatibilityData const& compatibles);
-        LfgCompatibilityData* GetCompatibilityData(std::string const& key);
+        void SetCompatibilityData(LfgCompatibilityKey const& key, LfgCompatibilityData const& compatibles);
+        LfgCompatibilityData* GetCompatibilityData(LfgCompatibilityKey const& key);
+        LfgCompatibilityData& InsertCompatibilityData(LfgCompatibilityKey const& key);
         void FindBestCompatibleInQueue(LfgQueueDataContainer::iterator itrQueue);
-        void UpdateBestCompatibleInQueue(LfgQueueDataContainer::iterator itrQueue, std::string const& key, LfgRolesMap const& roles);
+        void UpdateBestCompatibleInQueue(LfgQueueDataContainer::iterator itrQueue, LfgCompatibilityKey const& key, LfgRolesMap const& roles);
 
         LfgCompatibility FindNewGroups(LfgGuidList& check, LfgGuidList& all);
         LfgCompatibility CheckCompatibility(LfgGuidList check);
@@ -121,6 +146,7 @@ namespace lfg
         // Queue
         LfgQueueDataContainer QueueDataStore;              ///< Queued groups
         LfgCompatibleContainer CompatibleMapStore;         ///< Compatible dungeons
+        LfgCompatibleKeysContainer CompatibleKeysStore;    ///< Cached keys each queued guid is part of
 
         LfgWaitTimesContainer waitTimesAvgStore;           ///< Average wait time to find a group queuing as multiple roles
         LfgWaitTimesContainer waitTimesTankStore;          ///< Average wait time to find a group queuing as tank
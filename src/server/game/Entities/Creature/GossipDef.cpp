@@ -7,6 +7,7 @@
 #include "GossipDef.h"
 #include "ObjectMgr.h"
 #include "Opcodes.h"
+#include "QueryResponseCache.h"
 #include "QuestDef.h"
 #include "WorldPacket.h"
 #include "WorldSession.h"
@@ -596,6 +597,14 @@ void PlayerMenu::SendQuestGiverQuestDetails(Quest const* quest, uint64 npcGUID,
 
 void PlayerMenu::SendQuestQueryResponse(Quest const* quest) const
 {
+    if (QueryResponsePtr response = sQueryResponseCache->Get(QUERY_RESPONSE_QUEST, quest->GetQuestId(), _session->GetSessionDbLocaleIndex()))
+    {
+        _session->SendPacket(response.get());
+        return;
+    }
+
+    uint32 cacheGeneration = sQueryResponseCache->GetGeneration(QUERY_RESPONSE_QUEST);
+
     std::string questTitle = quest->GetTitle();
     std::string questDetails = quest->GetDetails();
     std::string questObjectives = quest->GetObjectives();
@@ -765,6 +774,7 @@ void PlayerMenu::SendQuestQueryResponse(Quest const* quest) const
     data << uint32(quest->GetRewardPackageItemId());
     data << uint32(quest->GetSrcItemId());                                  // source item id
 
+    sQueryResponseCache->Add(QUERY_RESPONSE_QUEST, quest->GetQuestId(), _session->GetSessionDbLocaleIndex(), data, cacheGeneration);
     _session->SendPacket(&data);
 
     SF_LOG_DEBUG("network", "WORLD: Sent SMSG_QUEST_QUERY_RESPONSE questid=%u", quest->GetQuestId());
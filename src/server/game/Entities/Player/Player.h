@@ -2433,6 +2433,7 @@ public:
     void JoinedChannel(Channel* c);
     void LeftChannel(Channel* c);
     void CleanupChannels();
+    void UpdateChannelIgnore(uint32 ignoredGuid, bool apply);
     void UpdateLocalChannels(uint32 newZone);
     void LeaveLFGChannel();
 
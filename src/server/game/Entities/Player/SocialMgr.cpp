@@ -182,6 +182,13 @@ bool PlayerSocial::HasIgnore(uint32 ignore_guid)
     return false;
 }
 
+void PlayerSocial::GetIgnoredGUIDs(std::vector<uint32>& ignored) const
+{
+    for (PlayerSocialMap::const_iterator itr = m_playerSocialMap.begin(); itr != m_playerSocialMap.end(); ++itr)
+        if (itr->second.Flags & SOCIAL_FLAG_IGNORED)
+            ignored.push_back(itr->first);
+}
+
 void SocialMgr::GetFriendInfo(Player* player, uint32 friendGUID, FriendInfo& friendInfo)
 {
     if (!player)
@@ -100,6 +100,7 @@ public:
     // Misc
     bool HasFriend(uint32 friend_guid);
     bool HasIgnore(uint32 ignore_guid);
+    void GetIgnoredGUIDs(std::vector<uint32>& ignored) const;
     uint32 GetPlayerGUID() const { return m_playerGUID; }
     void SetPlayerGUID(uint32 guid) { m_playerGUID = guid; }
     uint32 GetNumberOfSocialsWithFlag(SocialFlag flag);
@@ -175,6 +175,7 @@ Unit::Unit(bool isWorldObject) :
     m_canDualWield = false;
 
     m_movementCounter = 0;
+    m_movementBroadcastSlot = 0;
 
     m_state = 0;
     m_deathState = DeathState::ALIVE;
@@ -2520,11 +2521,13 @@ SpellMissInfo Unit::MeleeSpellHitResult(Unit* victim, SpellInfo const* spellInfo
 /// @todo need use unit spell resistances in calculations
 SpellMissInfo Unit::MagicSpellHitResult(Unit* victim, SpellInfo const* spellInfo)
 {
+    SpellHotData const& hotData = sSpellMgr->GetSpellHotDataUnchecked(spellInfo->Id);
+
     // Can`t miss on dead target (on skinning for example)
-    if ((!victim->IsAlive() && victim->GetTypeId() != TypeID::TYPEID_PLAYER) || spellInfo->AttributesEx3 & SPELL_ATTR3_IGNORE_HIT_RESULT)
+    if ((!victim->IsAlive() && victim->GetTypeId() != TypeID::TYPEID_PLAYER) || hotData.AttributesEx3 & SPELL_ATTR3_IGNORE_HIT_RESULT)
         return SPELL_MISS_NONE;
 
-    SpellSchoolMask schoolMask = spellInfo->GetSchoolMask();
+    SpellSchoolMask schoolMask = hotData.GetSchoolMask();
     // PvP - PvE spell misschances per leveldif > 2
     int32 lchance = victim->GetTypeId() == TypeID::TYPEID_PLAYER ? 7 : 11;
     int32 thisLevel = getLevelForTarget(victim);
@@ -2544,7 +2547,7 @@ SpellMissInfo Unit::MagicSpellHitResult(Unit* victim, SpellInfo const* spellInfo
         modOwner->ApplySpellMod(spellInfo->Id, SPELLMOD_RESIST_MISS_CHANCE, modHitChance);
 
     // Spells with SPELL_ATTR3_IGNORE_HIT_RESULT will ignore target's avoidance effects
-    if (!(spellInfo->AttributesEx3 & SPELL_ATTR3_IGNORE_HIT_RESULT))
+    if (!(hotData.AttributesEx3 & SPELL_ATTR3_IGNORE_HIT_RESULT))
     {
         // Chance hit from victim SPELL_AURA_MOD_ATTACKER_SPELL_HIT_CHANCE auras
         modHitChance += victim->GetTotalAuraModifierByMiscMask(SPELL_AURA_MOD_ATTACKER_SPELL_HIT_CHANCE, schoolMask);
@@ -2597,9 +2600,11 @@ SpellMissInfo Unit::SpellHitResult(Unit* victim, SpellInfo const* spellInfo, boo
     if (victim->IsImmunedToSpell(spellInfo))
         return SPELL_MISS_IMMUNE;
 
+    SpellHotData const& hotData = sSpellMgr->GetSpellHotDataUnchecked(spellInfo->Id);
+
     // All positive spells can`t miss
     /// @todo client not show miss log for this spells - so need find info for this in dbc and use it!
-    if (spellInfo->IsPositive() && !IsHostileTo(victim)) // prevent from affecting enemy by "positive" spell
+    if (hotData.IsPositive() && !IsHostileTo(victim)) // prevent from affecting enemy by "positive" spell
         return SPELL_MISS_NONE;
 
     // Check for immune
@@ -2619,7 +2624,7 @@ SpellMissInfo Unit::SpellHitResult(Unit* victim, SpellInfo const* spellInfo, boo
         int32 reflectchance = victim->GetTotalAuraModifier(SPELL_AURA_REFLECT_SPELLS);
         Unit::AuraEffectList const& mReflectSpellsSchool = victim->GetAuraEffectsByType(SPELL_AURA_REFLECT_SPELLS_SCHOOL);
         for (Unit::AuraEffectList::const_iterator i = mReflectSpellsSchool.begin(); i != mReflectSpellsSchool.end(); ++i)
-            if ((*i)->GetMiscValue() & spellInfo->GetSchoolMask())
+            if ((*i)->GetMiscValue() & hotData.SchoolMask)
                 reflectchance += (*i)->GetAmount();
         if (reflectchance > 0 && roll_chance_i(reflectchance))
         {
@@ -2629,7 +2634,7 @@ SpellMissInfo Unit::SpellHitResult(Unit* victim, SpellInfo const* spellInfo, boo
         }
     }
 
-    switch (spellInfo->DmgClass)
+    switch (hotData.DmgClass)
     {
         case SPELL_DAMAGE_CLASS_RANGED:
         case SPELL_DAMAGE_CLASS_MELEE:
@@ -9562,16 +9567,17 @@ bool Unit::IsImmunedToDamage(SpellSchoolMask shoolMask) const
 
 bool Unit::IsImmunedToDamage(SpellInfo const* spellInfo) const
 {
-    if (spellInfo->Attributes & SPELL_ATTR0_UNAFFECTED_BY_INVULNERABILITY)
+    SpellHotData const& hotData = sSpellMgr->GetSpellHotDataUnchecked(spellInfo->Id);
+    if (hotData.Attributes & SPELL_ATTR0_UNAFFECTED_BY_INVULNERABILITY)
         return false;
 
-    uint32 shoolMask = spellInfo->GetSchoolMask();
+    uint32 shoolMask = hotData.SchoolMask;
     if (spellInfo->Id != 42292 && spellInfo->Id != 59752)
     {
         // If m_immuneToSchool type contain this school type, IMMUNE damage.
         SpellImmuneList const& schoolList = m_spellImmune[IMMUNITY_SCHOOL];
         for (SpellImmuneList::const_iterator itr = schoolList.begin(); itr != schoolList.end(); ++itr)
-            if (itr->type & shoolMask && !spellInfo->CanPierceImmuneAura(sSpellMgr->GetSpellInfo(itr->spellId)))
+            if (itr->type & shoolMask && !hotData.CanPierceImmuneAura(sSpellMgr->GetSpellHotData(itr->spellId)))
                 return true;
     }
 
@@ -9595,23 +9601,24 @@ bool Unit::IsImmunedToSpell(SpellInfo const* spellInfo) const
         if (itr->type == spellInfo->Id)
             return true;
 
-    if (spellInfo->Attributes & SPELL_ATTR0_UNAFFECTED_BY_INVULNERABILITY)
+    SpellHotData const& hotData = sSpellMgr->GetSpellHotDataUnchecked(spellInfo->Id);
+    if (hotData.Attributes & SPELL_ATTR0_UNAFFECTED_BY_INVULNERABILITY)
         return false;
 
-    if (spellInfo->Dispel)
+    if (hotData.Dispel)
     {
         SpellImmuneList const& dispelList = m_spellImmune[IMMUNITY_DISPEL];
         for (SpellImmuneList::const_iterator itr = dispelList.begin(); itr != dispelList.end(); ++itr)
-            if (itr->type == spellInfo->Dispel)
+            if (itr->type == hotData.Dispel)
                 return true;
     }
 
     // Spells that don't have effectMechanics.
-    if (spellInfo->Mechanic)
+    if (hotData.Mechanic)
     {
         SpellImmuneList const& mechanicList = m_spellImmune[IMMUNITY_MECHANIC];
         for (SpellImmuneList::const_iterator itr = mechanicList.begin(); itr != mechanicList.end(); ++itr)
-            if (itr->type == spellInfo->Mechanic)
+            if (itr->type == hotData.Mechanic)
                 return true;
     }
 
@@ -9620,7 +9627,7 @@ bool Unit::IsImmunedToSpell(SpellInfo const* spellInfo) const
     {
         // State/effect immunities applied by aura expect full spell immunity
         // Ignore effects with mechanic, they are supposed to be checked separately
-        if (!spellInfo->Effects[i].IsEffect())
+        if (!(hotData.EffectMask & (1 << i)))
             continue;
         if (!IsImmunedToSpellEffect(spellInfo, i))
         {
@@ -9637,10 +9644,10 @@ bool Unit::IsImmunedToSpell(SpellInfo const* spellInfo) const
         SpellImmuneList const& schoolList = m_spellImmune[IMMUNITY_SCHOOL];
         for (SpellImmuneList::const_iterator itr = schoolList.begin(); itr != schoolList.end(); ++itr)
         {
-            SpellInfo const* immuneSpellInfo = sSpellMgr->GetSpellInfo(itr->spellId);
-            if ((itr->type & spellInfo->GetSchoolMask())
-                && !(immuneSpellInfo && immuneSpellInfo->IsPositive() && spellInfo->IsPositive())
-                && !spellInfo->CanPierceImmuneAura(immuneSpellInfo))
+            SpellHotData const* immuneHotData = sSpellMgr->GetSpellHotData(itr->spellId);
+            if ((itr->type & hotData.SchoolMask)
+                && !(immuneHotData && immuneHotData->IsPositive() && hotData.IsPositive())
+                && !hotData.CanPierceImmuneAura(immuneHotData))
                 return true;
         }
     }
@@ -11476,20 +11483,18 @@ void Unit::ApplyDiminishingAura(DiminishingGroup group, bool apply)
 
 float Unit::GetSpellMaxRangeForTarget(Unit const* target, SpellInfo const* spellInfo) const
 {
-    if (!spellInfo->RangeEntry)
-        return 0;
-    if (spellInfo->RangeEntry->maxRangeFriend == spellInfo->RangeEntry->maxRangeHostile)
-        return spellInfo->GetMaxRange();
-    return spellInfo->GetMaxRange(!IsHostileTo(target));
+    SpellHotData const& hotData = sSpellMgr->GetSpellHotDataUnchecked(spellInfo->Id);
+    if (hotData.MaxRangeFriend == hotData.MaxRangeHostile)
+        return hotData.MaxRangeHostile;
+    return hotData.GetMaxRange(!IsHostileTo(target));
 }
 
 float Unit::GetSpellMinRangeForTarget(Unit const* target, SpellInfo const* spellInfo) const
 {
-    if (!spellInfo->RangeEntry)
-        return 0;
-    if (spellInfo->RangeEntry->minRangeFriend == spellInfo->RangeEntry->minRangeHostile)
-        return spellInfo->GetMinRange();
-    return spellInfo->GetMinRange(!IsHostileTo(target));
+    SpellHotData const& hotData = sSpellMgr->GetSpellHotDataUnchecked(spellInfo->Id);
+    if (hotData.MinRangeFriend == hotData.MinRangeHostile)
+        return hotData.MinRangeHostile;
+    return hotData.GetMinRange(!IsHostileTo(target));
 }
 
 Unit* Unit::GetUnit(WorldObject& object, uint64 guid)
@@ -12049,6 +12054,8 @@ void Unit::RemoveFromWorld()
 
         RemoveAreaAurasDueToLeaveWorld();
 
+        GetMap()->CancelMovementBroadcast(this);
+
         if (GetCharmerGUID())
         {
             SF_LOG_FATAL("entities.unit", "Unit %u has charmer guid when removed from world", GetEntry());
@@ -15971,262 +15978,44 @@ void Unit::NearTeleportTo(float x, float y, float z, float orientation, bool cas
 
 void Unit::WriteMovementInfo(WorldPacket& data, Movement::ExtraMovementStatusElement* extras /*= NULL*/)
 {
-    MovementInfo const& mi = m_movementInfo;
-
-    bool hasMountDisplayId = GetUInt32Value(UNIT_FIELD_MOUNT_DISPLAY_ID) != 0;
-    bool hasMovementFlags = GetUnitMovementFlags() != 0;
-    bool hasMovementFlags2 = GetExtraUnitMovementFlags() != 0;
-    bool hasTimestamp = mi.time;
-    bool hasOrientation = !G3D::fuzzyEq(GetOrientation(), 0.0f);
-    bool hasTransportData = GetTransGUID() != 0;
-    bool hasSpline = movespline ? IsSplineEnabled() : false;
-
-    bool hasTransportTime2 = hasTransportData && m_movementInfo.transport.time2 != 0;
-    bool hasTransportTime3 = false;
-    bool hasTransportVehicleId = hasTransportData && m_movementInfo.transport.time3 != 0;
-    bool hasPitch = HasUnitMovementFlag(MovementFlags(MOVEMENTFLAG_SWIMMING | MOVEMENTFLAG_FLYING)) || HasExtraUnitMovementFlag(MOVEMENTFLAG2_ALWAYS_ALLOW_PITCHING);
-    bool hasFallDirection = HasUnitMovementFlag(MOVEMENTFLAG_FALLING);
-    bool hasFallData = hasFallDirection || m_movementInfo.jump.fallTime != 0;
-    bool hasSplineElevation = HasUnitMovementFlag(MOVEMENTFLAG_SPLINE_ELEVATION);
-
-    MovementStatusElements const* sequence = GetMovementStatusElementsSequence(data.GetOpcode());
-    if (!sequence)
+    Movement::MovementSequenceCodec const* codec = Movement::GetMovementSequenceCodec(data.GetOpcode());
+    if (!codec)
     {
         SF_LOG_ERROR("network", "Unit::WriteMovementInfo: No movement sequence found for opcode %s", GetOpcodeNameForLogging(data.GetOpcode(), true).c_str());
         return;
     }
 
-    ObjectGuid guid = GetGUID();
-    ObjectGuid tguid = hasTransportData ? GetTransGUID() : 0;
-
-    for (; *sequence != MSEEnd; ++sequence)
-    {
-        MovementStatusElements const& element = *sequence;
-
-        switch (element)
-        {
-            case MSEHasGuidByte0:
-            case MSEHasGuidByte1:
-            case MSEHasGuidByte2:
-            case MSEHasGuidByte3:
-            case MSEHasGuidByte4:
-            case MSEHasGuidByte5:
-            case MSEHasGuidByte6:
-            case MSEHasGuidByte7:
-                data.WriteBit(guid[element - MSEHasGuidByte0]);
-                break;
-            case MSEHasTransportGuidByte0:
-            case MSEHasTransportGuidByte1:
-            case MSEHasTransportGuidByte2:
-            case MSEHasTransportGuidByte3:
-            case MSEHasTransportGuidByte4:
-            case MSEHasTransportGuidByte5:
-            case MSEHasTransportGuidByte6:
-            case MSEHasTransportGuidByte7:
-                if (hasTransportData)
-                    data.WriteBit(tguid[element - MSEHasTransportGuidByte0]);
-                break;
-            case MSEGuidByte0:
-            case MSEGuidByte1:
-            case MSEGuidByte2:
-            case MSEGuidByte3:
-            case MSEGuidByte4:
-            case MSEGuidByte5:
-            case MSEGuidByte6:
-            case MSEGuidByte7:
-                data.WriteByteSeq(guid[element - MSEGuidByte0]);
-                break;
-            case MSETransportGuidByte0:
-            case MSETransportGuidByte1:
-            case MSETransportGuidByte2:
-            case MSETransportGuidByte3:
-            case MSETransportGuidByte4:
-            case MSETransportGuidByte5:
-            case MSETransportGuidByte6:
-            case MSETransportGuidByte7:
-                if (hasTransportData)
-                    data.WriteByteSeq(tguid[element - MSETransportGuidByte0]);
-                break;
-            case MSEHasCounter:
-                data.WriteBit(!m_movementCounter);
-                break;
-            case MSEHasMovementFlags:
-                data.WriteBit(!hasMovementFlags);
-                break;
-            case MSEHasMovementFlags2:
-                data.WriteBit(!hasMovementFlags2);
-                break;
-            case MSEHasMountDisplayId:
-                data.WriteBit(!hasMountDisplayId);
-                break;
-            case MSEHasTimestamp:
-                data.WriteBit(!hasTimestamp);
-                break;
-            case MSEHasOrientation:
-                data.WriteBit(!hasOrientation);
-                break;
-            case MSEHasTransportData:
-                data.WriteBit(hasTransportData);
-                break;
-            case MSEHasTransportTime2:
-                if (hasTransportData)
-                    data.WriteBit(hasTransportTime2);
-                break;
-            case MSEHasTransportTime3:
-                if (hasTransportData)
-                    data.WriteBit(hasTransportTime3);
-                break;
-            case MSEHasPitch:
-                data.WriteBit(!hasPitch);
-                break;
-            case MSEHasFallData:
-                data.WriteBit(hasFallData);
-                break;
-            case MSEHasFallDirection:
-                if (hasFallData)
-                    data.WriteBit(hasFallDirection);
-                break;
-            case MSEHasSplineElevation:
-                data.WriteBit(!hasSplineElevation);
-                break;
-            case MSEHasSpline:
-                data.WriteBit(hasSpline);
-                break;
-            case MSEMountDisplayIdWithCheck: // Fallback here
-                if (!hasMountDisplayId)
-                    break;
-            case MSEMountDisplayIdWithoutCheck:
-                data << GetUInt32Value(UNIT_FIELD_MOUNT_DISPLAY_ID);
-                break;
-            case MSEMovementFlags:
-                if (hasMovementFlags)
-                    data.WriteBits(GetUnitMovementFlags(), 30);
-                break;
-            case MSEMovementFlags2:
-                if (hasMovementFlags2)
-                    data.WriteBits(GetExtraUnitMovementFlags(), 13);
-                break;
-            case MSETimestamp:
-                if (hasTimestamp)
-                    data << mi.time;
-                break;
-            case MSEPositionX:
-                data << GetPositionX();
-                break;
-            case MSEPositionY:
-                data << GetPositionY();
-                break;
-            case MSEPositionZ:
-                data << GetPositionZ();
-                break;
-            case MSEOrientation:
-                if (hasOrientation)
-                    data << GetOrientation();
-                break;
-            case MSETransportPositionX:
-                if (hasTransportData)
-                    data << GetTransOffsetX();
-                break;
-            case MSETransportPositionY:
-                if (hasTransportData)
-                    data << GetTransOffsetY();
-                break;
-            case MSETransportPositionZ:
-                if (hasTransportData)
-                    data << GetTransOffsetZ();
-                break;
-            case MSETransportOrientation:
-                if (hasTransportData)
-                    data << GetTransOffsetO();
-                break;
-            case MSETransportSeat:
-                if (hasTransportData)
-                    data << GetTransSeat();
-                break;
-            case MSETransportTime:
-                if (hasTransportData)
-                    data << GetTransTime();
-                break;
-            case MSETransportTime2:
-                if (hasTransportData && hasTransportTime2)
-                    data << mi.transport.time2;
-                break;
-            case MSETransportTime3:
-                if (hasTransportData && hasTransportTime3)
-                    data << mi.transport.time3;
-                break;
-            case MSEPitch:
-                if (hasPitch)
-                    data << mi.pitch;
-                break;
-            case MSEFallTime:
-                if (hasFallData)
-                    data << mi.jump.fallTime;
-                break;
-            case MSEFallVerticalSpeed:
-                if (hasFallData)
-                    data << mi.jump.zspeed;
-                break;
-            case MSEFallCosAngle:
-                if (hasFallData && hasFallDirection)
-                    data << mi.jump.cosAngle;
-                break;
-            case MSEFallSinAngle:
-                if (hasFallData && hasFallDirection)
-                    data << mi.jump.sinAngle;
-                break;
-            case MSEFallHorizontalSpeed:
-                if (hasFallData && hasFallDirection)
-                    data << mi.jump.xyspeed;
-                break;
-            case MSESplineElevation:
-                if (hasSplineElevation)
-                    data << mi.splineElevation;
-                break;
-            case MSEForcesCount:
-                data.WriteBits(0, 22);
-                break;
-            case MSECounter:
-                if (m_movementCounter)
-                    data << m_movementCounter;
-                m_movementCounter++;
-                break;
-            case MSECount:
-                data << m_movementCounter++;
-                break;
-            case MSEZeroBit:
-                data.WriteBit(0);
-                break;
-            case MSEOneBit:
-                data.WriteBit(1);
-                break;
-            case MSEExtraElement:
-                extras->WriteNextElement(data);
-                break;
-            case MSEUintCount:
-                data << uint32(0);
-                break;
-            case MSEHasTransportVehicleId:
-                data.WriteBit(hasTransportVehicleId);
-                break;
-            case MSETransportVehicleId:
-                if (hasTransportVehicleId)
-                    data << mi.transport.time3; // this should be renamed
-                break;
-            case MSEForces:
-                /*
-                for (uint8 i = 0; i < forcesCount; ++i)
-                data << uint32(0);
-                */
-                break;
-            case MSEFlushBits:
-                data.FlushBits();
-                break;
-            default:
-                ASSERT(Movement::PrintInvalidSequenceElement(element, __FUNCTION__));
-                break;
-        }
-    }
+    MovementInfo const& mi = m_movementInfo;
+    Movement::MovementWriteState state(&mi, extras, &m_movementCounter);
+
+    state.Guid = GetGUID();
+    state.PositionX = GetPositionX();
+    state.PositionY = GetPositionY();
+    state.PositionZ = GetPositionZ();
+    state.Orientation = GetOrientation();
+    state.MountDisplayId = GetUInt32Value(UNIT_FIELD_MOUNT_DISPLAY_ID);
+    state.MovementFlags = GetUnitMovementFlags();
+    state.MovementFlags2 = GetExtraUnitMovementFlags();
+
+    state.HasMountDisplayId = state.MountDisplayId != 0;
+    state.HasMovementFlags = state.MovementFlags != 0;
+    state.HasMovementFlags2 = state.MovementFlags2 != 0;
+    state.HasTimestamp = mi.time;
+    state.HasOrientation = !G3D::fuzzyEq(state.Orientation, 0.0f);
+    state.HasTransportData = GetTransGUID() != 0;
+    state.HasSpline = movespline ? IsSplineEnabled() : false;
+
+    state.HasTransportTime2 = state.HasTransportData && mi.transport.time2 != 0;
+    state.HasTransportTime3 = false;
+    state.HasTransportVehicleId = state.HasTransportData && mi.transport.time3 != 0;
+    state.HasPitch = HasUnitMovementFlag(MovementFlags(MOVEMENTFLAG_SWIMMING | MOVEMENTFLAG_FLYING)) || HasExtraUnitMovementFlag(MOVEMENTFLAG2_ALWAYS_ALLOW_PITCHING);
+    state.HasFallDirection = HasUnitMovementFlag(MOVEMENTFLAG_FALLING);
+    state.HasFallData = state.HasFallDirection || mi.jump.fallTime != 0;
+    state.HasSplineElevation = HasUnitMovementFlag(MOVEMENTFLAG_SPLINE_ELEVATION);
+
+    state.TransportGuid = state.HasTransportData ? GetTransGUID() : 0;
+
+    Movement::WriteMovementBlock(*codec, data, state);
 }
 
 void Unit::SendTeleportPacket(Position& pos)
@@ -2586,6 +2586,8 @@ public:
     void removeFollower(FollowerReference* /*pRef*/)
     { /* nothing to do yet */
     }
+    // units chasing or following this one
+    uint32 GetFollowerCount() const { return m_FollowingRefManager.getSize(); }
     static Unit* GetUnit(WorldObject& object, uint64 guid);
     static Player* GetPlayer(WorldObject& object, uint64 guid);
     static Creature* GetCreature(WorldObject& object, uint64 guid);
@@ -2838,6 +2840,18 @@ public:
     {
         return m_movementCounter;
     }
+    bool IsMovementBroadcastPending() const
+    {
+        return m_movementBroadcastSlot != 0;
+    }
+    uint32 GetMovementBroadcastSlot() const
+    {
+        return m_movementBroadcastSlot;
+    }
+    void SetMovementBroadcastSlot(uint32 slot)
+    {
+        m_movementBroadcastSlot = slot;
+    }
     void SetAutoattackOverrideSpell(SpellInfo const* spellInfo)
     {
         m_overrideAutoattackSpellInfo = spellInfo;
@@ -2952,6 +2966,7 @@ protected:
     void SetRooted(bool apply, bool packetOnly = false);
 
     uint32 m_movementCounter;       ///< Incrementing counter used in movement packets
+    uint32 m_movementBroadcastSlot; ///< Index + 1 of the entry queued in Map::QueueMovementBroadcast, 0 when nothing is pending
 
 private:
     uint32 m_state;                                     // Even derived shouldn't modify
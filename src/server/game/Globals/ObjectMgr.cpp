@@ -26,6 +26,7 @@
 #include "ObjectMgr.h"
 #include "Pet.h"
 #include "PoolMgr.h"
+#include "QueryResponseCache.h"
 #include "ReputationMgr.h"
 #include "ScriptMgr.h"
 #include "Spell.h"
@@ -312,6 +313,8 @@ void ObjectMgr::LoadCreatureLocales()
 {
     uint32 oldMSTime = getMSTime();
 
+    QueryResponseReloadGuard reloadGuard(QUERY_RESPONSE_CREATURE);
+
     _creatureLocaleStore.clear();                              // need for reload case
 
     QueryResult result = WorldDatabase.Query("SELECT entry, name_loc1, subname_loc1, name_loc2, subname_loc2, name_loc3, subname_loc3, name_loc4, subname_loc4, name_loc5, subname_loc5, name_loc6, subname_loc6, name_loc7, subname_loc7, name_loc8, subname_loc8, name_loc9, subname_loc9, name_loc10, subname_loc10, name_loc11, subname_loc11 FROM locales_creature");
@@ -406,6 +409,8 @@ void ObjectMgr::LoadCreatureTemplates()
 {
     uint32 oldMSTime = getMSTime();
 
+    QueryResponseReloadGuard reloadGuard(QUERY_RESPONSE_CREATURE);
+
     //                                                 0              1                 2                  3                 4            5           6        7         8
     QueryResult result = WorldDatabase.Query("SELECT entry, difficulty_entry_1, difficulty_entry_2, difficulty_entry_3, KillCredit1, KillCredit2, modelid1, modelid2, modelid3, "
         //                                           9       10      11       12           13           14        15     16      17        18        19         20         21
@@ -2063,18 +2068,11 @@ Player* ObjectMgr::GetPlayerByLowGUID(uint32 lowguid) const
 // name must be checked to correctness (if received) before call this function
 uint64 ObjectMgr::GetPlayerGUIDByName(std::string const& name) const
 {
-    uint64 guid = 0;
-
-    PreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_SEL_GUID_BY_NAME);
-
-    stmt->setString(0, name);
+    // resolved from the name data cache, no DB access
+    if (uint32 lowGuid = sWorld->GetCharacterGuidByName(name))
+        return MAKE_NEW_GUID(lowGuid, 0, HIGHGUID_PLAYER);
 
-    PreparedQueryResult result = CharacterDatabase.Query(stmt);
-
-    if (result)
-        guid = MAKE_NEW_GUID((*result)[0].GetUInt32(), 0, HIGHGUID_PLAYER);
-
-    return guid;
+    return 0;
 }
 
 bool ObjectMgr::GetPlayerNameByGUID(uint64 guid, std::string& name) const
@@ -3628,6 +3626,8 @@ void ObjectMgr::LoadQuests()
 {
     uint32 oldMSTime = getMSTime();
 
+    QueryResponseReloadGuard reloadGuard(QUERY_RESPONSE_QUEST);
+
     // For reload case
     for (QuestMap::const_iterator itr = _questTemplates.begin(); itr != _questTemplates.end(); ++itr)
         delete itr->second;
@@ -4218,6 +4218,8 @@ void ObjectMgr::LoadQuestLocales()
 {
     uint32 oldMSTime = getMSTime();
 
+    QueryResponseReloadGuard reloadGuard(QUERY_RESPONSE_QUEST);
+
     _questLocaleStore.clear();                                // need for reload case
 
     QueryResult result = WorldDatabase.Query("SELECT Id, "
@@ -5031,6 +5033,8 @@ void ObjectMgr::LoadGossipText()
 {
     uint32 oldMSTime = getMSTime();
 
+    QueryResponseReloadGuard reloadGuard(QUERY_RESPONSE_NPC_TEXT);
+
     QueryResult result = WorldDatabase.Query("SELECT * FROM npc_text");
 
     int count = 0;
@@ -6131,6 +6135,8 @@ void ObjectMgr::LoadGameObjectLocales()
 {
     uint32 oldMSTime = getMSTime();
 
+    QueryResponseReloadGuard reloadGuard(QUERY_RESPONSE_GAMEOBJECT);
+
     _gameObjectLocaleStore.clear();                           // need for reload case
 
     QueryResult result = WorldDatabase.Query("SELECT entry, name_loc1, name_loc2, name_loc3, name_loc4, "
@@ -6223,6 +6229,8 @@ void ObjectMgr::LoadGameObjectTemplate()
 {
     uint32 oldMSTime = getMSTime();
 
+    QueryResponseReloadGuard reloadGuard(QUERY_RESPONSE_GAMEOBJECT);
+
     //                                                 0      1      2        3       4             5          6      7       8     9        10         11          12
     QueryResult result = WorldDatabase.Query("SELECT entry, type, displayId, name, IconName, castBarCaption, unk1, faction, flags, size, questItem1, questItem2, questItem3, "
         //                                            13          14          15       16     17     18     19     20     21     22     23     24     25      26      27      28
@@ -8631,6 +8639,8 @@ void ObjectMgr::LoadHotfixData()
 {
     uint32 oldMSTime = getMSTime();
 
+    sQueryResponseCache->InvalidateDB2Records();
+
     QueryResult result = WorldDatabase.Query("SELECT entry, type, UNIX_TIMESTAMP(hotfixDate) FROM hotfix_data");
 
     if (!result)
@@ -9265,6 +9275,8 @@ void ObjectMgr::LoadQuestObjectives()
 {
     uint32 oldMSTime = getMSTime();
 
+    QueryResponseReloadGuard reloadGuard(QUERY_RESPONSE_QUEST);
+
     QueryResult result = WorldDatabase.Query("SELECT `questId`, `id`, `index`, `type`, `objectId`, `amount`, `flags`, `description` FROM `quest_objective` ORDER BY `questId` ASC");
     if (!result)
     {
@@ -9466,6 +9478,8 @@ void ObjectMgr::LoadQuestObjectiveVisualEffects()
 {
     uint32 oldMSTime = getMSTime();
 
+    QueryResponseReloadGuard reloadGuard(QUERY_RESPONSE_QUEST);
+
     QueryResult result = WorldDatabase.Query("SELECT `objectiveId`, `visualEffect` FROM `quest_objective_effects` ORDER BY `objectiveId` ASC");
     if (!result)
     {
@@ -9510,6 +9524,8 @@ void ObjectMgr::LoadQuestObjectiveLocales()
 {
     uint32 oldMSTime = getMSTime();
 
+    QueryResponseReloadGuard reloadGuard(QUERY_RESPONSE_QUEST);
+
     QueryResult result = WorldDatabase.Query("SELECT `id`, `locale`, `description` FROM `locales_quest_objective` ORDER BY `id` ASC");
     if (!result)
     {
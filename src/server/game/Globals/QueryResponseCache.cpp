@@ -0,0 +1,101 @@
+/*
+* This file is part of Project SkyFire https://www.projectskyfire.org.
+* See LICENSE.md file for Copyright information
+*/
+
+#include "ObjectDefines.h"
+#include "QueryResponseCache.h"
+#include "WorldPacket.h"
+
+QueryResponseCache::QueryResponseCache()
+{
+    for (uint8 i = 0; i < MAX_QUERY_RESPONSE_TYPES; ++i)
+    {
+        _generations[i] = 0;
+        _reloading[i] = 0;
+    }
+}
+
+QueryResponsePtr QueryResponseCache::Get(QueryResponseType type, uint32 entry, LocaleConstant locale) const
+{
+    std::lock_guard<std::mutex> lock(_lock);
+
+    ResponseStore::const_iterator itr = _responses[type].find(MAKE_PAIR64(entry, uint32(locale)));
+    if (itr == _responses[type].end())
+        return QueryResponsePtr();
+
+    return itr->second;
+}
+
+uint32 QueryResponseCache::GetGeneration(QueryResponseType type) const
+{
+    std::lock_guard<std::mutex> lock(_lock);
+    return _generations[type];
+}
+
+void QueryResponseCache::Add(QueryResponseType type, uint32 entry, LocaleConstant locale, WorldPacket const& packet, uint32 generation)
+{
+    QueryResponsePtr response(new WorldPacket(packet));
+
+    std::lock_guard<std::mutex> lock(_lock);
+    // built from tables that were being reloaded, the next query builds it again
+    if (_reloading[type] || _generations[type] != generation)
+        return;
+
+    _responses[type][MAKE_PAIR64(entry, uint32(locale))] = response;
+}
+
+void QueryResponseCache::Invalidate(QueryResponseType type)
+{
+    std::lock_guard<std::mutex> lock(_lock);
+    ++_generations[type];
+    _responses[type].clear();
+}
+
+void QueryResponseCache::BeginReload(QueryResponseType type)
+{
+    std::lock_guard<std::mutex> lock(_lock);
+    ++_reloading[type];
+    ++_generations[type];
+    _responses[type].clear();
+}
+
+void QueryResponseCache::EndReload(QueryResponseType type)
+{
+    std::lock_guard<std::mutex> lock(_lock);
+    --_reloading[type];
+    ++_generations[type];
+    _responses[type].clear();
+}
+
+DB2RecordPtr QueryResponseCache::GetDB2Record(uint32 type, uint32 entry, LocaleConstant locale) const
+{
+    if (uint32(locale) >= TOTAL_LOCALES)
+        return DB2RecordPtr();
+
+    std::lock_guard<std::mutex> lock(_lock);
+
+    DB2RecordStore::const_iterator itr = _db2Records[locale].find(MAKE_PAIR64(entry, type));
+    if (itr == _db2Records[locale].end())
+        return DB2RecordPtr();
+
+    return itr->second;
+}
+
+DB2RecordPtr QueryResponseCache::AddDB2Record(uint32 type, uint32 entry, LocaleConstant locale, ByteBuffer const& record)
+{
+    DB2RecordPtr cached(new ByteBuffer(record));
+    if (uint32(locale) >= TOTAL_LOCALES)
+        return cached;
+
+    std::lock_guard<std::mutex> lock(_lock);
+    _db2Records[locale][MAKE_PAIR64(entry, type)] = cached;
+    return cached;
+}
+
+void QueryResponseCache::InvalidateDB2Records()
+{
+    std::lock_guard<std::mutex> lock(_lock);
+    for (uint8 i = 0; i < TOTAL_LOCALES; ++i)
+        _db2Records[i].clear();
+}
@@ -0,0 +1,90 @@
+/*
+* This file is part of Project SkyFire https://www.projectskyfire.org.
+* See LICENSE.md file for Copyright information
+*/
+
+#ifndef SKYFIRE_QUERYRESPONSECACHE_H
+#define SKYFIRE_QUERYRESPONSECACHE_H
+
+#include "Common.h"
+
+#include <ace/Null_Mutex.h>
+#include <ace/Singleton.h>
+#include <memory>
+#include <mutex>
+
+class ByteBuffer;
+class WorldPacket;
+
+enum QueryResponseType
+{
+    QUERY_RESPONSE_CREATURE,
+    QUERY_RESPONSE_GAMEOBJECT,
+    QUERY_RESPONSE_NPC_TEXT,
+    QUERY_RESPONSE_QUEST,
+
+    MAX_QUERY_RESPONSE_TYPES
+};
+
+typedef std::shared_ptr<WorldPacket const> QueryResponsePtr;
+typedef std::shared_ptr<ByteBuffer const> DB2RecordPtr;
+
+/// Finished SMSG_*_QUERY_RESPONSE packets per (entry, locale).
+/// The responses only depend on template and locale tables, so they are built once and the same
+/// bytes are sent to every client asking. Loading or reloading the source tables drops the cached
+/// packets of that type; packets still being sent stay alive through their shared pointer.
+/// Query opcodes are handled in place on the network threads, every access is locked. A response is
+/// only stored when no load of its type ran while it was built, see GetGeneration and Add.
+class QueryResponseCache
+{
+    friend class ACE_Singleton<QueryResponseCache, ACE_Null_Mutex>;
+
+private:
+    QueryResponseCache();
+    ~QueryResponseCache() { }
+
+public:
+    QueryResponsePtr Get(QueryResponseType type, uint32 entry, LocaleConstant locale) const;
+    /// Taken before building a response from the source tables and passed to Add
+    uint32 GetGeneration(QueryResponseType type) const;
+    /// Ignored while a load of the type is running or when one ran since generation was taken
+    void Add(QueryResponseType type, uint32 entry, LocaleConstant locale, WorldPacket const& packet, uint32 generation);
+    void Invalidate(QueryResponseType type);
+
+    /// Used by QueryResponseReloadGuard around the loaders of the source tables
+    void BeginReload(QueryResponseType type);
+    void EndReload(QueryResponseType type);
+
+    /// Serialized DB2 records sent in SMSG_DB_REPLY, the reply header carries a timestamp so only the record is kept
+    DB2RecordPtr GetDB2Record(uint32 type, uint32 entry, LocaleConstant locale) const;
+    DB2RecordPtr AddDB2Record(uint32 type, uint32 entry, LocaleConstant locale, ByteBuffer const& record);
+    void InvalidateDB2Records();
+
+private:
+    typedef UNORDERED_MAP<uint64, QueryResponsePtr> ResponseStore;
+    typedef UNORDERED_MAP<uint64 /*MAKE_PAIR64(entry, type)*/, DB2RecordPtr> DB2RecordStore;
+
+    ResponseStore _responses[MAX_QUERY_RESPONSE_TYPES];
+    uint32 _generations[MAX_QUERY_RESPONSE_TYPES];
+    uint32 _reloading[MAX_QUERY_RESPONSE_TYPES];
+    DB2RecordStore _db2Records[TOTAL_LOCALES];
+    mutable std::mutex _lock;
+};
+
+#define sQueryResponseCache ACE_Singleton<QueryResponseCache, ACE_Null_Mutex>::instance()
+
+/// Keeps responses of one type out of the cache for the lifetime of a loader of its source tables
+class QueryResponseReloadGuard
+{
+public:
+    explicit QueryResponseReloadGuard(QueryResponseType type) : _type(type) { sQueryResponseCache->BeginReload(_type); }
+    ~QueryResponseReloadGuard() { sQueryResponseCache->EndReload(_type); }
+
+private:
+    QueryResponseReloadGuard(QueryResponseReloadGuard const&) = delete;
+    QueryResponseReloadGuard& operator=(QueryResponseReloadGuard const&) = delete;
+
+    QueryResponseType _type;
+};
+
+#endif
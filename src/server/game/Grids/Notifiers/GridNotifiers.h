@@ -200,15 +200,16 @@ namespace Skyfire
         template<class NOT_INTERESTED> void Visit(GridRefManager<NOT_INTERESTED>&) { }
     };
 
-    template<class Check>
+    // Container may be any sequence of WorldObject* with push_back, spell target selection uses a vector
+    template<class Check, class Container = std::list<WorldObject*> >
     struct WorldObjectListSearcher
     {
         uint32 i_mapTypeMask;
         uint32 i_phaseMask;
-        std::list<WorldObject*>& i_objects;
+        Container& i_objects;
         Check& i_check;
 
-        WorldObjectListSearcher(WorldObject const* searcher, std::list<WorldObject*>& objects, Check& check, uint32 mapTypeMask = GRID_MAP_TYPE_MASK_ALL)
+        WorldObjectListSearcher(WorldObject const* searcher, Container& objects, Check& check, uint32 mapTypeMask = GRID_MAP_TYPE_MASK_ALL)
             : i_mapTypeMask(mapTypeMask), i_phaseMask(searcher->GetPhaseMask()), i_objects(objects), i_check(check) { }
 
         void Visit(PlayerMapType& m);
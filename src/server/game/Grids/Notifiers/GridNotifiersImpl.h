@@ -263,8 +263,8 @@ void Skyfire::WorldObjectLastSearcher<Check>::Visit(AreaTriggerMapType& m)
     }
 }
 
-template<class Check>
-void Skyfire::WorldObjectListSearcher<Check>::Visit(PlayerMapType& m)
+template<class Check, class Container>
+void Skyfire::WorldObjectListSearcher<Check, Container>::Visit(PlayerMapType& m)
 {
     if (!(i_mapTypeMask & GRID_MAP_TYPE_MASK_PLAYER))
         return;
@@ -274,8 +274,8 @@ void Skyfire::WorldObjectListSearcher<Check>::Visit(PlayerMapType& m)
             i_objects.push_back(itr->GetSource());
 }
 
-template<class Check>
-void Skyfire::WorldObjectListSearcher<Check>::Visit(CreatureMapType& m)
+template<class Check, class Container>
+void Skyfire::WorldObjectListSearcher<Check, Container>::Visit(CreatureMapType& m)
 {
     if (!(i_mapTypeMask & GRID_MAP_TYPE_MASK_CREATURE))
         return;
@@ -285,8 +285,8 @@ void Skyfire::WorldObjectListSearcher<Check>::Visit(CreatureMapType& m)
             i_objects.push_back(itr->GetSource());
 }
 
-template<class Check>
-void Skyfire::WorldObjectListSearcher<Check>::Visit(CorpseMapType& m)
+template<class Check, class Container>
+void Skyfire::WorldObjectListSearcher<Check, Container>::Visit(CorpseMapType& m)
 {
     if (!(i_mapTypeMask & GRID_MAP_TYPE_MASK_CORPSE))
         return;
@@ -296,8 +296,8 @@ void Skyfire::WorldObjectListSearcher<Check>::Visit(CorpseMapType& m)
             i_objects.push_back(itr->GetSource());
 }
 
-template<class Check>
-void Skyfire::WorldObjectListSearcher<Check>::Visit(GameObjectMapType& m)
+template<class Check, class Container>
+void Skyfire::WorldObjectListSearcher<Check, Container>::Visit(GameObjectMapType& m)
 {
     if (!(i_mapTypeMask & GRID_MAP_TYPE_MASK_GAMEOBJECT))
         return;
@@ -307,8 +307,8 @@ void Skyfire::WorldObjectListSearcher<Check>::Visit(GameObjectMapType& m)
             i_objects.push_back(itr->GetSource());
 }
 
-template<class Check>
-void Skyfire::WorldObjectListSearcher<Check>::Visit(DynamicObjectMapType& m)
+template<class Check, class Container>
+void Skyfire::WorldObjectListSearcher<Check, Container>::Visit(DynamicObjectMapType& m)
 {
     if (!(i_mapTypeMask & GRID_MAP_TYPE_MASK_DYNAMICOBJECT))
         return;
@@ -318,8 +318,8 @@ void Skyfire::WorldObjectListSearcher<Check>::Visit(DynamicObjectMapType& m)
             i_objects.push_back(itr->GetSource());
 }
 
-template<class Check>
-void Skyfire::WorldObjectListSearcher<Check>::Visit(AreaTriggerMapType& m)
+template<class Check, class Container>
+void Skyfire::WorldObjectListSearcher<Check, Container>::Visit(AreaTriggerMapType& m)
 {
     if (!(i_mapTypeMask & GRID_MAP_TYPE_MASK_AREATRIGGER))
         return;
@@ -826,7 +826,8 @@ void WorldSession::HandlePlayerLoginOpcode(WorldPacket& recvData)
         return;
     }
 
-    _charLoginCallback = CharacterDatabase.DelayQueryHolder((SQLQueryHolder*)holder);
+    // the login queries are independent, spread them over several async connections if configured
+    _charLoginCallback = CharacterDatabase.DelayQueryHolder((SQLQueryHolder*)holder, uint8(std::min<uint32>(sWorld->getIntConfig(WorldIntConfigs::CONFIG_LOGIN_QUERY_PARALLELISM), 255)));
 }
 
 void WorldSession::HandleLoadScreenOpcode(WorldPacket& recvPacket)
@@ -34,6 +34,7 @@
 #include "OutdoorPvP.h"
 #include "Pet.h"
 #include "Player.h"
+#include "QueryResponseCache.h"
 #include "ScriptMgr.h"
 #include "SocialMgr.h"
 #include "Spell.h"
@@ -843,6 +844,8 @@ void WorldSession::HandleAddIgnoreOpcodeCallBack(PreparedQueryResult result)
                 // ignore list full
                 if (!GetPlayer()->GetSocial()->AddToSocialList(GUID_LOPART(IgnoreGuid), true))
                     ignoreResult = FRIEND_IGNORE_FULL;
+                else
+                    GetPlayer()->UpdateChannelIgnore(GUID_LOPART(IgnoreGuid), true);
             }
         }
     }
@@ -860,6 +863,9 @@ void WorldSession::HandleDelIgnoreOpcode(WorldPacket& recvData)
 
     recvData >> IgnoreGUID;
 
+    if (_player->GetSocial()->HasIgnore(GUID_LOPART(IgnoreGUID)))
+        _player->UpdateChannelIgnore(GUID_LOPART(IgnoreGUID), false);
+
     _player->GetSocial()->RemoveFromSocialList(GUID_LOPART(IgnoreGUID), true);
 
     sSocialMgr->SendFriendStatus(GetPlayer(), FRIEND_IGNORE_REMOVED, GUID_LOPART(IgnoreGUID), false);
@@ -2172,6 +2178,11 @@ void WorldSession::HandleRequestHotfix(WorldPacket& recvPacket)
         recvPacket.ReadGuidMask(guids[i], 6, 3, 0, 1, 4, 5, 7, 2);
     }
 
+    // one packet for all replies, its storage is reused; the socket writes all of them in one go anyway
+    WorldPacket data(SMSG_DB_REPLY, 4 + 4 + 4 + 4 + 256);
+    uint32 now = uint32(time(NULL));
+    LocaleConstant locale = GetSessionDbcLocale();
+
     uint32 entry;
     for (uint32 i = 0; i < count; ++i)
     {
@@ -2189,15 +2200,20 @@ void WorldSession::HandleRequestHotfix(WorldPacket& recvPacket)
         if (!store->HasRecord(entry))
             continue;
 
-        ByteBuffer record;
-        store->WriteRecord(entry, (uint32)GetSessionDbcLocale(), record);
+        DB2RecordPtr record = sQueryResponseCache->GetDB2Record(type, entry, locale);
+        if (!record)
+        {
+            ByteBuffer buffer;
+            store->WriteRecord(entry, uint32(locale), buffer);
+            record = sQueryResponseCache->AddDB2Record(type, entry, locale, buffer);
+        }
 
-        WorldPacket data(SMSG_DB_REPLY);
+        data.Initialize(SMSG_DB_REPLY, 4 + 4 + 4 + 4 + record->size());
         data << uint32(entry);
-        data << uint32(time(NULL));
+        data << uint32(now);
         data << uint32(type);
-        data << uint32(record.size());
-        data.append(record);
+        data << uint32(record->size());
+        data.append(*record);
 
         SendPacket(&data);
 
@@ -386,9 +386,14 @@ void WorldSession::HandleMovementOpcodes(WorldPacket& recvPacket)
         mover->SetUInt32Value(UNIT_FIELD_NPC_EMOTESTATE, 0x00);
     }
 
-    WorldPacket data(SMSG_PLAYER_MOVE, recvPacket.size());
-    mover->WriteMovementInfo(data);
-    mover->SendMessageToSet(&data, _player);
+    if (sWorld->GetBoolConfig(WorldBoolConfigs::CONFIG_MOVEMENT_BROADCAST_AGGREGATE))
+        mover->GetMap()->QueueMovementBroadcast(mover);
+    else
+    {
+        WorldPacket data(SMSG_PLAYER_MOVE, recvPacket.size());
+        mover->WriteMovementInfo(data);
+        mover->SendMessageToSet(&data, _player);
+    }
 
     if (plrMover)                                            // nothing is charmed, or player charmed
     {
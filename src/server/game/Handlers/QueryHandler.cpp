@@ -14,6 +14,7 @@
 #include "Opcodes.h"
 #include "Pet.h"
 #include "Player.h"
+#include "QueryResponseCache.h"
 #include "UpdateMask.h"
 #include "World.h"
 #include "WorldPacket.h"
@@ -209,6 +210,14 @@ void WorldSession::HandleCreatureQueryOpcode(WorldPacket& recvData)
     uint32 entry;
     recvData >> entry;
 
+    if (QueryResponsePtr response = sQueryResponseCache->Get(QUERY_RESPONSE_CREATURE, entry, GetSessionDbLocaleIndex()))
+    {
+        SendPacket(response.get());
+        return;
+    }
+
+    uint32 cacheGeneration = sQueryResponseCache->GetGeneration(QUERY_RESPONSE_CREATURE);
+
     WorldPacket data(SMSG_CREATURE_QUERY_RESPONSE, 500);
 
     CreatureTemplate const* info = sObjectMgr->GetCreatureTemplate(entry);
@@ -278,6 +287,7 @@ void WorldSession::HandleCreatureQueryOpcode(WorldPacket& recvData)
         data << float(info->ModMana);                         // Mana modifier
         data << uint32(info->family);                         // CreatureFamily.dbc
 
+        sQueryResponseCache->Add(QUERY_RESPONSE_CREATURE, entry, GetSessionDbLocaleIndex(), data, cacheGeneration);
         SF_LOG_DEBUG("network", "WORLD: Sent SMSG_CREATURE_QUERY_RESPONSE");
     }
     else
@@ -312,6 +322,14 @@ void WorldSession::HandleGameObjectQueryOpcode(WorldPacket& recvData)
     recvData.ReadByteSeq(guid[7]);
     recvData.ReadByteSeq(guid[0]);
 
+    if (QueryResponsePtr response = sQueryResponseCache->Get(QUERY_RESPONSE_GAMEOBJECT, entry, GetSessionDbLocaleIndex()))
+    {
+        SendPacket(response.get());
+        return;
+    }
+
+    uint32 cacheGeneration = sQueryResponseCache->GetGeneration(QUERY_RESPONSE_GAMEOBJECT);
+
     const GameObjectTemplate* info = sObjectMgr->GetGameObjectTemplate(entry);
 
     WorldPacket data(SMSG_GAMEOBJECT_QUERY_RESPONSE, 150);
@@ -362,6 +380,7 @@ void WorldSession::HandleGameObjectQueryOpcode(WorldPacket& recvData)
         data << int32(info->unkInt32);                      // 4.x, unknown
 
         data.put(pos, uint32(data.wpos() - (pos + 4)));
+        sQueryResponseCache->Add(QUERY_RESPONSE_GAMEOBJECT, entry, GetSessionDbLocaleIndex(), data, cacheGeneration);
         SF_LOG_DEBUG("network", "WORLD: Sent SMSG_GAMEOBJECT_QUERY_RESPONSE");
     }
     else
@@ -456,9 +475,18 @@ void WorldSession::HandleNpcTextQueryOpcode(WorldPacket& recvData)
     recvData.ReadGuidMask(guid, 4, 5, 1, 7, 0, 2, 6, 3);
     recvData.ReadGuidBytes(guid, 4, 0, 2, 5, 1, 7, 3, 7);
 
-    SF_LOG_ERROR("network", "WORLD: CMSG_NPC_TEXT_QUERY ID '%u', %lu", textID, uint64(guid));
+    SF_LOG_DEBUG("network", "WORLD: CMSG_NPC_TEXT_QUERY ID '%u', " UI64FMTD, textID, uint64(guid));
     //SendBroadcastText(textID);
 
+    // not localized, every client gets the same text
+    if (QueryResponsePtr response = sQueryResponseCache->Get(QUERY_RESPONSE_NPC_TEXT, textID, LOCALE_enUS))
+    {
+        SendPacket(response.get());
+        return;
+    }
+
+    uint32 cacheGeneration = sQueryResponseCache->GetGeneration(QUERY_RESPONSE_NPC_TEXT);
+
     GossipText const* pGossip = sObjectMgr->GetGossipText(textID);
 
     // WNPC collumns should be in this buffer
@@ -497,6 +525,9 @@ void WorldSession::HandleNpcTextQueryOpcode(WorldPacket& recvData)
     data.WriteBit(1); // write record to WNPC cache
     data.FlushBits();
 
+    if (pGossip)
+        sQueryResponseCache->Add(QUERY_RESPONSE_NPC_TEXT, textID, LOCALE_enUS, data, cacheGeneration);
+
     SendPacket(&data);
 
     SF_LOG_DEBUG("network", "WORLD: Sent SMSG_NPC_TEXT_UPDATE");
@@ -17,8 +17,10 @@
 #include "MMapFactory.h"
 #include "ObjectAccessor.h"
 #include "ObjectMgr.h"
+#include "PathCache.h"
 #include "Pet.h"
 #include "ScriptMgr.h"
+#include "TickProfiler.h"
 #include "Transport.h"
 #include "Vehicle.h"
 #include "VMapFactory.h"
@@ -66,6 +68,8 @@ Map::~Map()
     if (!m_scriptSchedule.empty())
         sScriptMgr->DecreaseScheduledScriptCount(m_scriptSchedule.size());
 
+    delete _pathCache;
+
     MMAP::MMapFactory::createOrGetMMapManager()->unloadMapInstance(GetId(), i_InstanceId);
 }
 
@@ -216,6 +220,8 @@ void Map::DeleteStateMachine()
     delete si_GridStates[GRID_STATE_REMOVAL];
 }
 
+std::atomic<uint32> Map::_coalescedRespawnWrites(0);
+
 Map::Map(uint32 id, time_t expiry, uint32 InstanceId, uint8 SpawnMode, Map* _parent) :
     _creatureToMoveLock(false), _gameObjectsToMoveLock(false),
     i_mapEntry(sMapStore.LookupEntry(id)), i_spawnMode(SpawnMode), i_InstanceId(InstanceId),
@@ -226,6 +232,8 @@ Map::Map(uint32 id, time_t expiry, uint32 InstanceId, uint8 SpawnMode, Map* _par
     i_scriptLock(false)
 {
     m_parentMap = (_parent ? _parent : this);
+    _respawnSaveTimer = 0;
+    _pathCache = new PathCache();
     for (unsigned int idx = 0; idx < MAX_NUMBER_OF_GRIDS; ++idx)
     {
         for (unsigned int j = 0; j < MAX_NUMBER_OF_GRIDS; ++j)
@@ -594,73 +602,82 @@ void Map::VisitNearbyCellsOf(WorldObject* obj, TypeContainerVisitor<Skyfire::Obj
 
 void Map::Update(const uint32 t_diff)
 {
+    TickProfileScope profile(TICK_SECTION_MAP, GetId(), GetInstanceId());
+
     _dynamicTree.update(t_diff);
     /// update worldsessions for existing players
-    for (m_mapRefIter = m_mapRefManager.begin(); m_mapRefIter != m_mapRefManager.end(); ++m_mapRefIter)
     {
-        Player* player = m_mapRefIter->GetSource();
-        if (player && player->IsInWorld())
+        TickProfileScope sessionsProfile(TICK_SECTION_MAP_SESSIONS);
+        for (m_mapRefIter = m_mapRefManager.begin(); m_mapRefIter != m_mapRefManager.end(); ++m_mapRefIter)
         {
-            //player->Update(t_diff);
-            WorldSession* session = player->GetSession();
-            MapSessionFilter updater(session);
-            session->Update(t_diff, updater);
+            Player* player = m_mapRefIter->GetSource();
+            if (player && player->IsInWorld())
+            {
+                //player->Update(t_diff);
+                WorldSession* session = player->GetSession();
+                MapSessionFilter updater(session);
+                session->Update(t_diff, updater);
+            }
         }
     }
+
     /// update active cells around players and active objects
-    resetMarkedCells();
+    {
+        TickProfileScope objectsProfile(TICK_SECTION_OBJECT_UPDATE);
+        resetMarkedCells();
 
-    Skyfire::ObjectUpdater updater(t_diff);
-    // for creature
-    TypeContainerVisitor<Skyfire::ObjectUpdater, GridTypeMapContainer  > grid_object_update(updater);
-    // for pets
-    TypeContainerVisitor<Skyfire::ObjectUpdater, WorldTypeMapContainer > world_object_update(updater);
+        Skyfire::ObjectUpdater updater(t_diff);
+        // for creature
+        TypeContainerVisitor<Skyfire::ObjectUpdater, GridTypeMapContainer  > grid_object_update(updater);
+        // for pets
+        TypeContainerVisitor<Skyfire::ObjectUpdater, WorldTypeMapContainer > world_object_update(updater);
 
-    // the player iterator is stored in the map object
-    // to make sure calls to Map::Remove don't invalidate it
-    for (m_mapRefIter = m_mapRefManager.begin(); m_mapRefIter != m_mapRefManager.end(); ++m_mapRefIter)
-    {
-        Player* player = m_mapRefIter->GetSource();
+        // the player iterator is stored in the map object
+        // to make sure calls to Map::Remove don't invalidate it
+        for (m_mapRefIter = m_mapRefManager.begin(); m_mapRefIter != m_mapRefManager.end(); ++m_mapRefIter)
+        {
+            Player* player = m_mapRefIter->GetSource();
 
-        if (!player || !player->IsInWorld())
-            continue;
+            if (!player || !player->IsInWorld())
+                continue;
 
-        // update players at tick
-        player->Update(t_diff);
+            // update players at tick
+            player->Update(t_diff);
 
-        VisitNearbyCellsOf(player, grid_object_update, world_object_update);
+            VisitNearbyCellsOf(player, grid_object_update, world_object_update);
 
-        // If player is using far sight, visit that object too
-        if (WorldObject* viewPoint = player->GetViewpoint())
-        {
-            if (Creature* viewCreature = viewPoint->ToCreature())
-                VisitNearbyCellsOf(viewCreature, grid_object_update, world_object_update);
-            else if (DynamicObject* viewObject = viewPoint->ToDynObject())
-                VisitNearbyCellsOf(viewObject, grid_object_update, world_object_update);
+            // If player is using far sight, visit that object too
+            if (WorldObject* viewPoint = player->GetViewpoint())
+            {
+                if (Creature* viewCreature = viewPoint->ToCreature())
+                    VisitNearbyCellsOf(viewCreature, grid_object_update, world_object_update);
+                else if (DynamicObject* viewObject = viewPoint->ToDynObject())
+                    VisitNearbyCellsOf(viewObject, grid_object_update, world_object_update);
+            }
         }
-    }
 
-    // non-player active objects, increasing iterator in the loop in case of object removal
-    for (m_activeNonPlayersIter = m_activeNonPlayers.begin(); m_activeNonPlayersIter != m_activeNonPlayers.end();)
-    {
-        WorldObject* obj = *m_activeNonPlayersIter;
-        ++m_activeNonPlayersIter;
+        // non-player active objects, increasing iterator in the loop in case of object removal
+        for (m_activeNonPlayersIter = m_activeNonPlayers.begin(); m_activeNonPlayersIter != m_activeNonPlayers.end();)
+        {
+            WorldObject* obj = *m_activeNonPlayersIter;
+            ++m_activeNonPlayersIter;
 
-        if (!obj || !obj->IsInWorld())
-            continue;
+            if (!obj || !obj->IsInWorld())
+                continue;
 
-        VisitNearbyCellsOf(obj, grid_object_update, world_object_update);
-    }
+            VisitNearbyCellsOf(obj, grid_object_update, world_object_update);
+        }
 
-    for (_transportsUpdateIter = _transports.begin(); _transportsUpdateIter != _transports.end();)
-    {
-        WorldObject* obj = *_transportsUpdateIter;
-        ++_transportsUpdateIter;
+        for (_transportsUpdateIter = _transports.begin(); _transportsUpdateIter != _transports.end();)
+        {
+            WorldObject* obj = *_transportsUpdateIter;
+            ++_transportsUpdateIter;
 
-        if (!obj->IsInWorld())
-            continue;
+            if (!obj->IsInWorld())
+                continue;
 
-        obj->Update(t_diff);
+            obj->Update(t_diff);
+        }
     }
 
     ///- Process necessary scripts
@@ -674,12 +691,75 @@ void Map::Update(const uint32 t_diff)
     MoveAllCreaturesInMoveList();
     MoveAllGameObjectsInMoveList();
 
+    if (!_pendingMovementBroadcasts.empty())
+        SendPendingMovementBroadcasts(t_diff);
+
+    _respawnSaveTimer += t_diff;
+    if (_respawnSaveTimer >= sWorld->getIntConfig(WorldIntConfigs::CONFIG_RESPAWN_SAVE_INTERVAL))
+        SaveRespawnTimesToDB();
+
     if (!m_mapRefManager.isEmpty() || !m_activeNonPlayers.empty())
+    {
+        TickProfileScope relocationProfile(TICK_SECTION_RELOCATION_NOTIFY);
         ProcessRelocationNotifies(t_diff);
+    }
 
     sScriptMgr->OnMapUpdate(this, t_diff);
 }
 
+void Map::QueueMovementBroadcast(Unit* mover)
+{
+    // only the latest state is sent, so one entry per mover is enough
+    if (mover->IsMovementBroadcastPending())
+        return;
+
+    _pendingMovementBroadcasts.push_back(PendingMovementBroadcast(mover, getMSTime()));
+    mover->SetMovementBroadcastSlot(uint32(_pendingMovementBroadcasts.size()));
+}
+
+void Map::CancelMovementBroadcast(Unit* mover)
+{
+    if (!mover->IsMovementBroadcastPending())
+        return;
+
+    // the order of the queue does not matter, the last entry takes over the slot of the cancelled one
+    uint32 index = mover->GetMovementBroadcastSlot() - 1;
+    ASSERT(index < _pendingMovementBroadcasts.size() && _pendingMovementBroadcasts[index].Mover == mover);
+
+    _pendingMovementBroadcasts[index] = _pendingMovementBroadcasts.back();
+    _pendingMovementBroadcasts[index].Mover->SetMovementBroadcastSlot(index + 1);
+    _pendingMovementBroadcasts.pop_back();
+
+    mover->SetMovementBroadcastSlot(0);
+}
+
+void Map::SendPendingMovementBroadcasts(uint32 diff)
+{
+    uint32 const now = getMSTime();
+    uint32 const maxDelay = sWorld->getIntConfig(WorldIntConfigs::CONFIG_MOVEMENT_BROADCAST_MAX_DELAY);
+
+    PendingMovementBroadcasts::iterator keep = _pendingMovementBroadcasts.begin();
+    for (PendingMovementBroadcasts::iterator itr = _pendingMovementBroadcasts.begin(); itr != _pendingMovementBroadcasts.end(); ++itr)
+    {
+        // hold an update back only if the next map update can still send it within the delay
+        if (maxDelay && getMSTimeDiff(itr->QueueTime, now) + diff < maxDelay)
+        {
+            itr->Mover->SetMovementBroadcastSlot(uint32(keep - _pendingMovementBroadcasts.begin()) + 1);
+            *keep++ = *itr;
+            continue;
+        }
+
+        Unit* mover = itr->Mover;
+        mover->SetMovementBroadcastSlot(0);
+
+        WorldPacket data(SMSG_PLAYER_MOVE, 64);
+        mover->WriteMovementInfo(data);
+        mover->SendMessageToSet(&data, mover->GetCharmerOrOwnerPlayerOrPlayerItself());
+    }
+
+    _pendingMovementBroadcasts.erase(keep, _pendingMovementBroadcasts.end());
+}
+
 struct ResetNotifier
 {
     template<class T>inline void resetNotify(GridRefManager<T>& m)
@@ -1361,6 +1441,9 @@ void Map::UnloadAll()
         ++i;
         UnloadGrid(grid, true);       // deletes the grid and removes it from the GridRefManager
     }
+
+    // unloading grids may save respawn times, write everything before the map goes away
+    SaveRespawnTimesToDB();
 }
 
 // *****************************
@@ -3089,6 +3172,15 @@ void BattlegroundMap::RemovePlayerFromMap(Player* player, bool remove)
     Map::RemovePlayerFromMap(player, remove);
 }
 
+void BattlegroundMap::Update(const uint32 diff)
+{
+    Map::Update(diff);
+
+    // battleground logic runs in the same job as its map, deletion stays with BattlegroundMgr
+    if (m_bg && !m_bg->ToBeDeleted())
+        m_bg->Update(diff);
+}
+
 void BattlegroundMap::SetUnload()
 {
     m_unloadTimer = MIN_UNLOAD_DELAY;
@@ -3144,6 +3236,12 @@ void Map::SaveCreatureRespawnTime(uint32 dbGuid, time_t respawnTime)
 
     _creatureRespawnTimes[dbGuid] = respawnTime;
 
+    if (sWorld->getIntConfig(WorldIntConfigs::CONFIG_RESPAWN_SAVE_INTERVAL))
+    {
+        QueueRespawnTimeSave(_pendingCreatureRespawnTimes, dbGuid, respawnTime);
+        return;
+    }
+
     PreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_REP_CREATURE_RESPAWN);
     stmt->setUInt32(0, dbGuid);
     stmt->setUInt32(1, uint32(respawnTime));
@@ -3156,6 +3254,12 @@ void Map::RemoveCreatureRespawnTime(uint32 dbGuid)
 {
     _creatureRespawnTimes.erase(dbGuid);
 
+    if (sWorld->getIntConfig(WorldIntConfigs::CONFIG_RESPAWN_SAVE_INTERVAL))
+    {
+        QueueRespawnTimeSave(_pendingCreatureRespawnTimes, dbGuid, 0);
+        return;
+    }
+
     PreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_DEL_CREATURE_RESPAWN);
     stmt->setUInt32(0, dbGuid);
     stmt->setUInt16(1, GetId());
@@ -3174,6 +3278,12 @@ void Map::SaveGORespawnTime(uint32 dbGuid, time_t respawnTime)
 
     _goRespawnTimes[dbGuid] = respawnTime;
 
+    if (sWorld->getIntConfig(WorldIntConfigs::CONFIG_RESPAWN_SAVE_INTERVAL))
+    {
+        QueueRespawnTimeSave(_pendingGORespawnTimes, dbGuid, respawnTime);
+        return;
+    }
+
     PreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_REP_GO_RESPAWN);
     stmt->setUInt32(0, dbGuid);
     stmt->setUInt32(1, uint32(respawnTime));
@@ -3186,6 +3296,12 @@ void Map::RemoveGORespawnTime(uint32 dbGuid)
 {
     _goRespawnTimes.erase(dbGuid);
 
+    if (sWorld->getIntConfig(WorldIntConfigs::CONFIG_RESPAWN_SAVE_INTERVAL))
+    {
+        QueueRespawnTimeSave(_pendingGORespawnTimes, dbGuid, 0);
+        return;
+    }
+
     PreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_DEL_GO_RESPAWN);
     stmt->setUInt32(0, dbGuid);
     stmt->setUInt16(1, GetId());
@@ -3193,6 +3309,77 @@ void Map::RemoveGORespawnTime(uint32 dbGuid)
     CharacterDatabase.Execute(stmt);
 }
 
+void Map::QueueRespawnTimeSave(PendingRespawnTimes& pending, uint32 dbGuid, time_t respawnTime)
+{
+    std::pair<PendingRespawnTimes::iterator, bool> result = pending.insert(PendingRespawnTimes::value_type(dbGuid, respawnTime));
+    if (!result.second)
+    {
+        // an older change of the same spawn was not written yet, only the latest one is kept
+        result.first->second = respawnTime;
+        ++_coalescedRespawnWrites;
+    }
+}
+
+void Map::SaveRespawnTimesToDB()
+{
+    _respawnSaveTimer = 0;
+
+    if (_pendingCreatureRespawnTimes.empty() && _pendingGORespawnTimes.empty())
+        return;
+
+    SQLTransaction trans = CharacterDatabase.BeginTransaction();
+
+    for (PendingRespawnTimes::const_iterator itr = _pendingCreatureRespawnTimes.begin(); itr != _pendingCreatureRespawnTimes.end(); ++itr)
+    {
+        PreparedStatement* stmt;
+        if (itr->second)
+        {
+            stmt = CharacterDatabase.GetPreparedStatement(CHAR_REP_CREATURE_RESPAWN);
+            stmt->setUInt32(0, itr->first);
+            stmt->setUInt32(1, uint32(itr->second));
+            stmt->setUInt16(2, GetId());
+            stmt->setUInt32(3, GetInstanceId());
+        }
+        else
+        {
+            stmt = CharacterDatabase.GetPreparedStatement(CHAR_DEL_CREATURE_RESPAWN);
+            stmt->setUInt32(0, itr->first);
+            stmt->setUInt16(1, GetId());
+            stmt->setUInt32(2, GetInstanceId());
+        }
+        trans->Append(stmt);
+    }
+
+    for (PendingRespawnTimes::const_iterator itr = _pendingGORespawnTimes.begin(); itr != _pendingGORespawnTimes.end(); ++itr)
+    {
+        PreparedStatement* stmt;
+        if (itr->second)
+        {
+            stmt = CharacterDatabase.GetPreparedStatement(CHAR_REP_GO_RESPAWN);
+            stmt->setUInt32(0, itr->first);
+            stmt->setUInt32(1, uint32(itr->second));
+            stmt->setUInt16(2, GetId());
+            stmt->setUInt32(3, GetInstanceId());
+        }
+        else
+        {
+            stmt = CharacterDatabase.GetPreparedStatement(CHAR_DEL_GO_RESPAWN);
+            stmt->setUInt32(0, itr->first);
+            stmt->setUInt16(1, GetId());
+            stmt->setUInt32(2, GetInstanceId());
+        }
+        trans->Append(stmt);
+    }
+
+    SF_LOG_DEBUG("maps", "Map::SaveRespawnTimesToDB: map %u instance %u wrote %u creature and %u gameobject respawn times (%u writes coalesced so far)",
+        GetId(), GetInstanceId(), uint32(_pendingCreatureRespawnTimes.size()), uint32(_pendingGORespawnTimes.size()), uint32(_coalescedRespawnWrites));
+
+    _pendingCreatureRespawnTimes.clear();
+    _pendingGORespawnTimes.clear();
+
+    CharacterDatabase.CommitTransaction(trans);
+}
+
 void Map::LoadRespawnTimes()
 {
     PreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_SEL_CREATURE_RESPAWNS);
@@ -3230,6 +3417,8 @@ void Map::DeleteRespawnTimes()
 {
     _creatureRespawnTimes.clear();
     _goRespawnTimes.clear();
+    _pendingCreatureRespawnTimes.clear();
+    _pendingGORespawnTimes.clear();
 
     DeleteRespawnTimesInDB(GetId(), GetInstanceId());
 }
@@ -18,6 +18,7 @@
 #include "SharedDefines.h"
 #include "Timer.h"
 
+#include <atomic>
 #include <bitset>
 #include <list>
 #include <mutex>
@@ -39,6 +40,7 @@ class Battleground;
 class MapInstanced;
 class InstanceMap;
 class Transport;
+class PathCache;
 namespace Skyfire { struct ObjectUpdater; }
 
 struct ScriptAction
@@ -272,6 +274,12 @@ public:
     void CreatureRelocation(Creature* creature, float x, float y, float z, float ang, bool respawnRelocationOnFail = true);
     void GameObjectRelocation(GameObject* go, float x, float y, float z, float orientation, bool respawnRelocationOnFail = true);
 
+    // Coalesced movement broadcasts (Movement.Broadcast.Aggregate)
+    void QueueMovementBroadcast(Unit* mover);
+    void CancelMovementBroadcast(Unit* mover);
+    /// diff of the current map update, used as estimate of the time until the next one
+    void SendPendingMovementBroadcasts(uint32 diff);
+
     template<class T, class CONTAINER> void Visit(const Cell& cell, TypeContainerVisitor<T, CONTAINER>& visitor);
 
     bool IsRemovalGrid(float x, float y) const
@@ -477,6 +485,10 @@ public:
     void RemoveGORespawnTime(uint32 dbGuid);
     void LoadRespawnTimes();
     void DeleteRespawnTimes();
+    void SaveRespawnTimesToDB();
+    static uint32 GetCoalescedRespawnWrites() { return _coalescedRespawnWrites; }
+
+    PathCache* GetPathCache() const { return _pathCache; }
 
     static void DeleteRespawnTimesInDB(uint16 mapId, uint32 instanceId);
 
@@ -582,6 +594,16 @@ private:
     //visibility calculations. Highly optimized for massive calculations
     void ProcessRelocationNotifies(const uint32 diff);
 
+    struct PendingMovementBroadcast
+    {
+        PendingMovementBroadcast(Unit* mover, uint32 queueTime) : Mover(mover), QueueTime(queueTime) { }
+
+        Unit* Mover;
+        uint32 QueueTime;
+    };
+    typedef std::vector<PendingMovementBroadcast> PendingMovementBroadcasts;
+    PendingMovementBroadcasts _pendingMovementBroadcasts;
+
     bool i_scriptLock;
     std::set<WorldObject*> i_objectsToRemove;
     std::map<WorldObject*, bool> i_objectsToSwitch;
@@ -620,6 +642,17 @@ private:
 
     UNORDERED_MAP<uint32 /*dbGUID*/, time_t> _creatureRespawnTimes;
     UNORDERED_MAP<uint32 /*dbGUID*/, time_t> _goRespawnTimes;
+
+    // respawn time changes not yet written to DB, 0 = delete
+    typedef UNORDERED_MAP<uint32 /*dbGUID*/, time_t> PendingRespawnTimes;
+    PendingRespawnTimes _pendingCreatureRespawnTimes;
+    PendingRespawnTimes _pendingGORespawnTimes;
+    uint32 _respawnSaveTimer;
+    static std::atomic<uint32> _coalescedRespawnWrites;
+
+    void QueueRespawnTimeSave(PendingRespawnTimes& pending, uint32 dbGuid, time_t respawnTime);
+
+    PathCache* _pathCache;
 };
 
 enum class InstanceResetMethod
@@ -670,6 +703,7 @@ public:
     bool AddPlayerToMap(Player*) OVERRIDE;
     void RemovePlayerFromMap(Player*, bool) OVERRIDE;
     bool CanEnter(Player* player) OVERRIDE;
+    void Update(const uint32) OVERRIDE;
     void SetUnload();
     //void UnloadAll(bool pForce);
     void RemoveAllPlayers() OVERRIDE;
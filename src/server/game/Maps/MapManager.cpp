@@ -19,6 +19,7 @@
 #include "ObjectMgr.h"
 #include "Opcodes.h"
 #include "Player.h"
+#include "TickProfiler.h"
 #include "Transport.h"
 #include "World.h"
 #include "WorldPacket.h"
@@ -304,7 +305,10 @@ void MapManager::Update(uint32 diff)
     for (iter = i_maps.begin(); iter != i_maps.end(); ++iter)
         iter->second->DelayedUpdate(uint32(i_timer.GetCurrent()));
 
-    sObjectAccessor->Update(uint32(i_timer.GetCurrent()));
+    {
+        TickProfileScope profile(TICK_SECTION_OBJECT_ACCESSOR);
+        sObjectAccessor->Update(uint32(i_timer.GetCurrent()));
+    }
 
     i_timer.SetCurrent(0);
 }
@@ -3,6 +3,7 @@
 * See LICENSE.md file for Copyright information
 */
 
+#include "AllocatorMgr.h"
 #include "DatabaseEnv.h"
 #include "DelayExecutor.h"
 #include "Map.h"
@@ -15,7 +16,11 @@ class WDBThreadStartReq1 : public ACE_Method_Request
 public:
     WDBThreadStartReq1() { }
 
-    virtual int call() { return 0; }
+    virtual int call()
+    {
+        sAllocatorMgr->InitMapThread();
+        return 0;
+    }
 };
 
 class WDBThreadEndReq1 : public ACE_Method_Request
@@ -75,6 +75,10 @@ void TargetedMovementGeneratorMedium<T, D>::_setTargetLocation(T* owner, bool up
     if (!i_path)
         i_path = new PathGenerator(owner);
 
+    // with many chasers one flow field around the target is cheaper than a search per chaser
+    uint32 flowFieldChasers = sWorld->getIntConfig(WorldIntConfigs::CONFIG_FLOW_FIELD_CHASERS);
+    i_path->SetUseFlowField(flowFieldChasers && i_target->GetFollowerCount() >= flowFieldChasers);
+
     // allow pets to use shortcut if no path found when following their master
     bool forceDest = (owner->GetTypeId() == TypeID::TYPEID_UNIT && owner->ToCreature()->IsPet()
         && owner->HasUnitState(UNIT_STATE_FOLLOW));
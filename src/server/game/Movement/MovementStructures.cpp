@@ -6,7 +6,7 @@
 #include "MovementStructures.h"
 #include "Player.h"
 
-MovementStatusElements const PlayerMove[] = // 5.4.8 18414
+constexpr MovementStatusElements PlayerMove[] = // 5.4.8 18414
 {
     MSEHasPitch,               // 112
     MSEHasGuidByte2,           // 18
@@ -82,7 +82,7 @@ MovementStatusElements const PlayerMove[] = // 5.4.8 18414
     MSEEnd
 };
 
-MovementStatusElements const MovementFallLand[] = // 5.4.8 18414
+constexpr MovementStatusElements MovementFallLand[] = // 5.4.8 18414
 {
     MSEPositionY,              // 40
     MSEPositionZ,              // 44
@@ -159,7 +159,7 @@ MovementStatusElements const MovementFallLand[] = // 5.4.8 18414
     MSEEnd
 };
 
-MovementStatusElements const MovementHeartBeat[] = // 5.4.8 18414
+constexpr MovementStatusElements MovementHeartBeat[] = // 5.4.8 18414
 {
     MSEPositionZ,              // 44
     MSEPositionX,              // 36
@@ -236,7 +236,7 @@ MovementStatusElements const MovementHeartBeat[] = // 5.4.8 18414
     MSEEnd
 };
 
-MovementStatusElements const MovementJump[] = // 5.4.8 18414
+constexpr MovementStatusElements MovementJump[] = // 5.4.8 18414
 {
     MSEPositionY,              // 40
     MSEPositionX,              // 36
@@ -313,7 +313,7 @@ MovementStatusElements const MovementJump[] = // 5.4.8 18414
     MSEEnd
 };
 
-MovementStatusElements const MovementSetFacing[] = // 5.4.8 18414
+constexpr MovementStatusElements MovementSetFacing[] = // 5.4.8 18414
 {
     MSEPositionY,              // 40
     MSEPositionX,              // 36
@@ -390,7 +390,7 @@ MovementStatusElements const MovementSetFacing[] = // 5.4.8 18414
     MSEEnd
 };
 
-MovementStatusElements const MovementSetPitch[] = // 5.4.8 18414
+constexpr MovementStatusElements MovementSetPitch[] = // 5.4.8 18414
 {
     MSEPositionZ,              // 44
     MSEPositionX,              // 36
@@ -467,7 +467,7 @@ MovementStatusElements const MovementSetPitch[] = // 5.4.8 18414
     MSEEnd
 };
 
-MovementStatusElements const MovementStartBackward[] = // 5.4.8 18414
+constexpr MovementStatusElements MovementStartBackward[] = // 5.4.8 18414
 {
     MSEPositionY,              // 40
     MSEPositionZ,              // 44
@@ -544,7 +544,7 @@ MovementStatusElements const MovementStartBackward[] = // 5.4.8 18414
     MSEEnd
 };
 
-MovementStatusElements const MovementStartForward[] = // 5.4.8 18414
+constexpr MovementStatusElements MovementStartForward[] = // 5.4.8 18414
 {
     MSEPositionZ,              // 44
     MSEPositionX,              // 36
@@ -621,7 +621,7 @@ MovementStatusElements const MovementStartForward[] = // 5.4.8 18414
     MSEEnd
 };
 
-MovementStatusElements const MovementStartStrafeLeft[] = // 5.4.8 18414
+constexpr MovementStatusElements MovementStartStrafeLeft[] = // 5.4.8 18414
 {
     MSEPositionY,              // 40
     MSEPositionZ,              // 44
@@ -698,7 +698,7 @@ MovementStatusElements const MovementStartStrafeLeft[] = // 5.4.8 18414
     MSEEnd
 };
 
-MovementStatusElements const MovementStartStrafeRight[] = // 5.4.8 18414
+constexpr MovementStatusElements MovementStartStrafeRight[] = // 5.4.8 18414
 {
     MSEPositionY,              // 40
     MSEPositionX,              // 36
@@ -775,7 +775,7 @@ MovementStatusElements const MovementStartStrafeRight[] = // 5.4.8 18414
     MSEEnd
 };
 
-MovementStatusElements const MovementStartTurnLeft[] = // 5.4.8 18414
+constexpr MovementStatusElements MovementStartTurnLeft[] = // 5.4.8 18414
 {
     MSEPositionZ,              // 44
     MSEPositionX,              // 36
@@ -852,7 +852,7 @@ MovementStatusElements const MovementStartTurnLeft[] = // 5.4.8 18414
     MSEEnd
 };
 
-MovementStatusElements const MovementStartTurnRight[] = // 5.4.8 18414
+constexpr MovementStatusElements MovementStartTurnRight[] = // 5.4.8 18414
 {
     MSEPositionX,              // 36
     MSEPositionZ,              // 44
@@ -929,7 +929,7 @@ MovementStatusElements const MovementStartTurnRight[] = // 5.4.8 18414
     MSEEnd
 };
 
-MovementStatusElements const MovementStop[] = // 5.4.8 18414
+constexpr MovementStatusElements MovementStop[] = // 5.4.8 18414
 {
     MSEPositionX,              // 36
     MSEPositionY,              // 40
@@ -1006,7 +1006,7 @@ MovementStatusElements const MovementStop[] = // 5.4.8 18414
     MSEEnd
 };
 
-MovementStatusElements const MovementStopStrafe[] = // 5.4.8 18414
+constexpr MovementStatusElements MovementStopStrafe[] = // 5.4.8 18414
 {
     MSEPositionZ,              // 44
     MSEPositionX,              // 36
@@ -1083,7 +1083,7 @@ MovementStatusElements const MovementStopStrafe[] = // 5.4.8 18414
     MSEEnd
 };
 
-MovementStatusElements const MovementStopTurn[] = // 5.4.8 18414
+constexpr MovementStatusElements MovementStopTurn[] = // 5.4.8 18414
 {
     MSEPositionX,              // 36
     MSEPositionZ,              // 44
@@ -1160,7 +1160,7 @@ MovementStatusElements const MovementStopTurn[] = // 5.4.8 18414
     MSEEnd
 };
 
-MovementStatusElements const MovementStartAscend[] = // 5.4.8 18414
+constexpr MovementStatusElements MovementStartAscend[] = // 5.4.8 18414
 {
     MSEPositionY,              // 40
     MSEPositionX,              // 36
@@ -1237,7 +1237,7 @@ MovementStatusElements const MovementStartAscend[] = // 5.4.8 18414
     MSEEnd
 };
 
-MovementStatusElements const MovementStartDescend[] = // 5.4.8 18414
+constexpr MovementStatusElements MovementStartDescend[] = // 5.4.8 18414
 {
     MSEPositionX,              // 36
     MSEPositionY,              // 40
@@ -1314,7 +1314,7 @@ MovementStatusElements const MovementStartDescend[] = // 5.4.8 18414
     MSEEnd
 };
 
-MovementStatusElements const MovementStartSwim[] = // 5.4.8 18414
+constexpr MovementStatusElements MovementStartSwim[] = // 5.4.8 18414
 {
     MSEPositionX,              // 36
     MSEPositionY,              // 40
@@ -1391,7 +1391,7 @@ MovementStatusElements const MovementStartSwim[] = // 5.4.8 18414
     MSEEnd
 };
 
-MovementStatusElements const MovementStopSwim[] = // 5.4.8 18414
+constexpr MovementStatusElements MovementStopSwim[] = // 5.4.8 18414
 {
     MSEPositionX,              // 36
     MSEPositionZ,              // 44
@@ -1468,7 +1468,7 @@ MovementStatusElements const MovementStopSwim[] = // 5.4.8 18414
     MSEEnd
 };
 
-MovementStatusElements const MovementStopAscend[] = // 5.4.8 18414
+constexpr MovementStatusElements MovementStopAscend[] = // 5.4.8 18414
 {
     MSEPositionZ,              // 44
     MSEPositionX,              // 36
@@ -1545,7 +1545,7 @@ MovementStatusElements const MovementStopAscend[] = // 5.4.8 18414
     MSEEnd
 };
 
-MovementStatusElements const MovementStopPitch[] = // 5.4.8 18414
+constexpr MovementStatusElements MovementStopPitch[] = // 5.4.8 18414
 {
     MSEPositionY,              // 40
     MSEPositionX,              // 36
@@ -1622,7 +1622,7 @@ MovementStatusElements const MovementStopPitch[] = // 5.4.8 18414
     MSEEnd
 };
 
-MovementStatusElements const MovementStartPitchDown[] = // 5.4.8 18414
+constexpr MovementStatusElements MovementStartPitchDown[] = // 5.4.8 18414
 {
     MSEPositionZ,              // 44
     MSEPositionY,              // 40
@@ -1699,7 +1699,7 @@ MovementStatusElements const MovementStartPitchDown[] = // 5.4.8 18414
     MSEEnd
 };
 
-MovementStatusElements const MovementStartPitchUp[] = // 5.4.8 18414
+constexpr MovementStatusElements MovementStartPitchUp[] = // 5.4.8 18414
 {
     MSEPositionY,              // 40
     MSEPositionZ,              // 44
@@ -1776,7 +1776,7 @@ MovementStatusElements const MovementStartPitchUp[] = // 5.4.8 18414
     MSEEnd
 };
 
-MovementStatusElements const MoveChngTransport[] = // 5.4.8 18414
+constexpr MovementStatusElements MoveChngTransport[] = // 5.4.8 18414
 {
     MSEPositionX,
     MSEPositionY,
@@ -1853,7 +1853,7 @@ MovementStatusElements const MoveChngTransport[] = // 5.4.8 18414
     MSEEnd
 };
 
-MovementStatusElements const MoveSplineDone[] = // 5.4.8 18414
+constexpr MovementStatusElements MoveSplineDone[] = // 5.4.8 18414
 {
     MSECounter,
     MSEPositionZ,
@@ -1931,7 +1931,7 @@ MovementStatusElements const MoveSplineDone[] = // 5.4.8 18414
     MSEEnd,
 };
 
-MovementStatusElements const MoveNotActiveMover[] =
+constexpr MovementStatusElements MoveNotActiveMover[] =
 {
     MSEPositionZ,
     MSEPositionX,
@@ -2010,7 +2010,7 @@ MovementStatusElements const MoveNotActiveMover[] =
     MSEEnd,
 };
 
-MovementStatusElements const DismissControlledVehicle[] =  // 5.4.8 18414
+constexpr MovementStatusElements DismissControlledVehicle[] =  // 5.4.8 18414
 {
     MSEPositionZ,              // 44
     MSEPositionY,              // 40
@@ -2088,7 +2088,7 @@ MovementStatusElements const DismissControlledVehicle[] =  // 5.4.8 18414
     MSEEnd
 };
 
-MovementStatusElements const MoveTeleport[] =
+constexpr MovementStatusElements MoveTeleport[] =
 {
     MSEHasGuidByte0,
     MSEHasGuidByte6,
@@ -2132,7 +2132,7 @@ MovementStatusElements const MoveTeleport[] =
     MSEEnd
 };
 
-MovementStatusElements const MoveUpdateTeleport[] =
+constexpr MovementStatusElements MoveUpdateTeleport[] =
 {
     MSEPositionZ,
     MSEPositionY,
@@ -2214,7 +2214,7 @@ MovementStatusElements const MoveUpdateTeleport[] =
     MSEEnd,
 };
 
-MovementStatusElements const MovementSetRunMode[] = // 5.4.8 18414
+constexpr MovementStatusElements MovementSetRunMode[] = // 5.4.8 18414
 {
     MSEPositionZ,              // 44
     MSEPositionY,              // 40
@@ -2292,7 +2292,7 @@ MovementStatusElements const MovementSetRunMode[] = // 5.4.8 18414
     MSEEnd
 };
 
-MovementStatusElements const MovementSetWalkMode[] = // 5.4.8 18414
+constexpr MovementStatusElements MovementSetWalkMode[] = // 5.4.8 18414
 {
     MSEPositionY,              // 40
     MSEPositionX,              // 36
@@ -2370,7 +2370,7 @@ MovementStatusElements const MovementSetWalkMode[] = // 5.4.8 18414
     MSEEnd
 };
 
-MovementStatusElements const MovementSetCanFly[] =
+constexpr MovementStatusElements MovementSetCanFly[] =
 {
     MSEPositionY,              // 40
     MSEPositionX,              // 36
@@ -2447,7 +2447,7 @@ MovementStatusElements const MovementSetCanFly[] =
     MSEEnd
 };
 
-MovementStatusElements const MovementSetCanTransitionBetweenSwimAndFlyAck[] =
+constexpr MovementStatusElements MovementSetCanTransitionBetweenSwimAndFlyAck[] =
 {
     MSEPositionZ,
     MSEPositionY,
@@ -2520,7 +2520,7 @@ MovementStatusElements const MovementSetCanTransitionBetweenSwimAndFlyAck[] =
     MSEEnd,
 };
 
-MovementStatusElements const MovementApplyMovementForceAck[] = // 5.4.8 18414
+constexpr MovementStatusElements MovementApplyMovementForceAck[] = // 5.4.8 18414
 {
     MSECount,                  // 176
     MSEExtraElement,           // 196
@@ -2603,7 +2603,7 @@ MovementStatusElements const MovementApplyMovementForceAck[] = // 5.4.8 18414
     MSEEnd
 };
 
-MovementStatusElements const MovementRemoveMovementForceAck[] = // 5.4.8 18414
+constexpr MovementStatusElements MovementRemoveMovementForceAck[] = // 5.4.8 18414
 {
     MSECount,                  // 184
     MSEPositionZ,              // 52  34h
@@ -2683,7 +2683,7 @@ MovementStatusElements const MovementRemoveMovementForceAck[] = // 5.4.8 18414
     MSEEnd
 };
 
-MovementStatusElements const MovementUpdateSwimBackSpeed[] = // 5.4.8 18414
+constexpr MovementStatusElements MovementUpdateSwimBackSpeed[] = // 5.4.8 18414
 {
     MSEHasGuidByte3,           // 27
     MSEHasGuidByte6,           // 30
@@ -2762,7 +2762,7 @@ MovementStatusElements const MovementUpdateSwimBackSpeed[] = // 5.4.8 18414
     MSEEnd
 };
 
-MovementStatusElements const MovementUpdateSwimSpeed[] = // 5.4.8 18414
+constexpr MovementStatusElements MovementUpdateSwimSpeed[] = // 5.4.8 18414
 {
     MSEHasOrientation,         // 56  38h
     MSEHasGuidByte0,           // 24
@@ -2841,7 +2841,7 @@ MovementStatusElements const MovementUpdateSwimSpeed[] = // 5.4.8 18414
     MSEEnd
 };
 
-MovementStatusElements const MovementUpdateRunSpeed[] =
+constexpr MovementStatusElements MovementUpdateRunSpeed[] =
 {
     MSEHasGuidByte0,
     MSEHasGuidByte3,
@@ -2920,7 +2920,7 @@ MovementStatusElements const MovementUpdateRunSpeed[] =
     MSEEnd
 };
 
-MovementStatusElements const MovementUpdateFlightBackSpeed[] = // 5.4.8 18414
+constexpr MovementStatusElements MovementUpdateFlightBackSpeed[] = // 5.4.8 18414
 {
     MSEHasGuidByte0,           // 24
     MSEZeroBit,                // 157
@@ -2999,7 +2999,7 @@ MovementStatusElements const MovementUpdateFlightBackSpeed[] = // 5.4.8 18414
     MSEEnd
 };
 
-MovementStatusElements const MovementUpdateFlightSpeed[] =
+constexpr MovementStatusElements MovementUpdateFlightSpeed[] =
 {
     MSEHasGuidByte3,
     MSEHasGuidByte2,
@@ -3078,7 +3078,7 @@ MovementStatusElements const MovementUpdateFlightSpeed[] =
     MSEEnd
 };
 
-MovementStatusElements const MovementUpdateCollisionHeight[] =
+constexpr MovementStatusElements MovementUpdateCollisionHeight[] =
 {
     MSEHasGuidByte7,
     MSEHasGuidByte3,
@@ -3157,7 +3157,7 @@ MovementStatusElements const MovementUpdateCollisionHeight[] =
     MSEEnd
 };
 
-MovementStatusElements const MovementForceRunSpeedChangeAck[] = // 5.4.8 18414
+constexpr MovementStatusElements MovementForceRunSpeedChangeAck[] = // 5.4.8 18414
 {
     MSECount,                  // 176
     MSEPositionY,              // 40
@@ -3237,7 +3237,7 @@ MovementStatusElements const MovementForceRunSpeedChangeAck[] = // 5.4.8 18414
     MSEEnd
 };
 
-MovementStatusElements const MovementForceSwimBackSpeedChangeAck[] = // 5.4.8 18414
+constexpr MovementStatusElements MovementForceSwimBackSpeedChangeAck[] = // 5.4.8 18414
 {
     MSEExtraElement,           // 184
     MSEPositionY,              // 40
@@ -3317,7 +3317,7 @@ MovementStatusElements const MovementForceSwimBackSpeedChangeAck[] = // 5.4.8 18
     MSEEnd
 };
 
-MovementStatusElements const MovementSetCollisionHeightAck[] =
+constexpr MovementStatusElements MovementSetCollisionHeightAck[] =
 {
     MSEMountDisplayIdWithoutCheck,
     MSEPositionZ,
@@ -3399,7 +3399,7 @@ MovementStatusElements const MovementSetCollisionHeightAck[] =
     MSEEnd
 };
 
-MovementStatusElements const MovementForceFlightBackSpeedChangeAck[] = // 5.4.8 18414
+constexpr MovementStatusElements MovementForceFlightBackSpeedChangeAck[] = // 5.4.8 18414
 {
     MSEExtraElement,           // 184
     MSEPositionZ,              // 44
@@ -3479,7 +3479,7 @@ MovementStatusElements const MovementForceFlightBackSpeedChangeAck[] = // 5.4.8
     MSEEnd
 };
 
-MovementStatusElements const MovementForceFlightSpeedChangeAck[] = // 5.4.8 18414
+constexpr MovementStatusElements MovementForceFlightSpeedChangeAck[] = // 5.4.8 18414
 {
     MSEPositionY,              // 40
     MSECount,                  // 176
@@ -3559,7 +3559,7 @@ MovementStatusElements const MovementForceFlightSpeedChangeAck[] = // 5.4.8 1841
     MSEEnd
 };
 
-MovementStatusElements const MovementForcePitchRateChangeAck[] = // 5.4.8 18414
+constexpr MovementStatusElements MovementForcePitchRateChangeAck[] = // 5.4.8 18414
 {
     MSEPositionY,              // 40
     MSEExtraElement,           // 184
@@ -3639,7 +3639,7 @@ MovementStatusElements const MovementForcePitchRateChangeAck[] = // 5.4.8 18414
     MSEEnd
 };
 
-MovementStatusElements const MovementSetCanFlyAck[] = // 5.4.8 18414
+constexpr MovementStatusElements MovementSetCanFlyAck[] = // 5.4.8 18414
 {
     MSEPositionZ,              // 44
     MSECount,                  // 176
@@ -3718,7 +3718,7 @@ MovementStatusElements const MovementSetCanFlyAck[] = // 5.4.8 18414
     MSEEnd
 };
 
-MovementStatusElements const MovementSetFly[] = // 5.4.8 18414
+constexpr MovementStatusElements MovementSetFly[] = // 5.4.8 18414
 {
     MSEPositionY,              // 40
     MSEPositionZ,              // 44
@@ -3796,7 +3796,7 @@ MovementStatusElements const MovementSetFly[] = // 5.4.8 18414
     MSEEnd
 };
 
-MovementStatusElements const MovementForceSwimSpeedChangeAck[] = // 5.4.8 18414
+constexpr MovementStatusElements MovementForceSwimSpeedChangeAck[] = // 5.4.8 18414
 {
     MSEExtraElement,           // 184
     MSEPositionY,              // 40
@@ -3876,7 +3876,7 @@ MovementStatusElements const MovementForceSwimSpeedChangeAck[] = // 5.4.8 18414
     MSEEnd
 };
 
-MovementStatusElements const MovementForceTurnRateChangeAck[] = // 5.4.8 18414
+constexpr MovementStatusElements MovementForceTurnRateChangeAck[] = // 5.4.8 18414
 {
     MSECount,                  // 176
     MSEPositionZ,              // 44
@@ -3956,7 +3956,7 @@ MovementStatusElements const MovementForceTurnRateChangeAck[] = // 5.4.8 18414
     MSEEnd
 };
 
-MovementStatusElements const MovementForceWalkSpeedChangeAck[] = // 5.4.8 18414
+constexpr MovementStatusElements MovementForceWalkSpeedChangeAck[] = // 5.4.8 18414
 {
     MSECount,                  // 176
     MSEExtraElement,           // 184
@@ -4036,7 +4036,7 @@ MovementStatusElements const MovementForceWalkSpeedChangeAck[] = // 5.4.8 18414
     MSEEnd
 };
 
-MovementStatusElements const MovementForceRunBackSpeedChangeAck[] = // 5.4.8 18414
+constexpr MovementStatusElements MovementForceRunBackSpeedChangeAck[] = // 5.4.8 18414
 {
     MSEExtraElement,           // 184
     MSECount,                  // 176
@@ -4116,7 +4116,7 @@ MovementStatusElements const MovementForceRunBackSpeedChangeAck[] = // 5.4.8 184
     MSEEnd
 };
 
-MovementStatusElements const MovementUpdateRunBackSpeed[] = // 5.4.8 18414
+constexpr MovementStatusElements MovementUpdateRunBackSpeed[] = // 5.4.8 18414
 {
     MSEPositionZ,              // 52  34h
     MSEPositionY,              // 48  30h
@@ -4195,7 +4195,7 @@ MovementStatusElements const MovementUpdateRunBackSpeed[] = // 5.4.8 18414
     MSEEnd
 };
 
-MovementStatusElements const MovementUpdateWalkSpeed[] = // 5.4.8 18414
+constexpr MovementStatusElements MovementUpdateWalkSpeed[] = // 5.4.8 18414
 {
     MSEHasGuidByte4,           // 28
     MSEHasGuidByte0,           // 24
@@ -4273,7 +4273,7 @@ MovementStatusElements const MovementUpdateWalkSpeed[] = // 5.4.8 18414
     MSEEnd
 };
 
-MovementStatusElements const ForceMoveRootAck[] = // 5.4.8 18414
+constexpr MovementStatusElements ForceMoveRootAck[] = // 5.4.8 18414
 {
     MSEPositionX,
     MSECounter,
@@ -4351,7 +4351,7 @@ MovementStatusElements const ForceMoveRootAck[] = // 5.4.8 18414
     MSEEnd,
 };
 
-MovementStatusElements const ForceMoveUnrootAck[] = // 5.4.8 18414
+constexpr MovementStatusElements ForceMoveUnrootAck[] = // 5.4.8 18414
 {
     MSEPositionX,
     MSEPositionY,
@@ -4429,7 +4429,7 @@ MovementStatusElements const ForceMoveUnrootAck[] = // 5.4.8 18414
     MSEEnd,
 };
 
-MovementStatusElements const MovementFallReset[] = // 5.4.8 18414
+constexpr MovementStatusElements MovementFallReset[] = // 5.4.8 18414
 {
     MSEPositionZ,              // 44
     MSEPositionX,              // 36
@@ -4507,7 +4507,7 @@ MovementStatusElements const MovementFallReset[] = // 5.4.8 18414
     MSEEnd
 };
 
-MovementStatusElements const MovementFeatherFallAck[] = // 5.4.8 18414
+constexpr MovementStatusElements MovementFeatherFallAck[] = // 5.4.8 18414
 {
     MSEPositionY,              // 40
     MSEPositionX,              // 36
@@ -4586,7 +4586,7 @@ MovementStatusElements const MovementFeatherFallAck[] = // 5.4.8 18414
     MSEEnd,
 };
 
-MovementStatusElements const MovementGravityDisableAck[] = // 5.4.8 18414
+constexpr MovementStatusElements MovementGravityDisableAck[] = // 5.4.8 18414
 {
     MSECount,                  // 176
     MSEPositionY,              // 40
@@ -4665,7 +4665,7 @@ MovementStatusElements const MovementGravityDisableAck[] = // 5.4.8 18414
     MSEEnd
 };
 
-MovementStatusElements const MovementGravityEnableAck[] = // 5.4.8 18414
+constexpr MovementStatusElements MovementGravityEnableAck[] = // 5.4.8 18414
 {
     MSEPositionY,              // 40
     MSEPositionX,              // 36
@@ -4744,7 +4744,7 @@ MovementStatusElements const MovementGravityEnableAck[] = // 5.4.8 18414
     MSEEnd
 };
 
-MovementStatusElements const MovementHoverAck[] = // 5.4.8 18414
+constexpr MovementStatusElements MovementHoverAck[] = // 5.4.8 18414
 {
     MSECount,                  // 176
     MSEPositionY,              // 40
@@ -4823,7 +4823,7 @@ MovementStatusElements const MovementHoverAck[] = // 5.4.8 18414
     MSEEnd
 };
 
-MovementStatusElements const MovementKnockBackAck[] = // 5.4.8 18414
+constexpr MovementStatusElements MovementKnockBackAck[] = // 5.4.8 18414
 {
     MSEAckCount,               // 44
     MSEPositionX,              // 9
@@ -4901,7 +4901,7 @@ MovementStatusElements const MovementKnockBackAck[] = // 5.4.8 18414
     MSEEnd,
 };
 
-MovementStatusElements const MovementWaterWalkAck[] = // 5.4.8 18414
+constexpr MovementStatusElements MovementWaterWalkAck[] = // 5.4.8 18414
 {
     MSEPositionX,              // 36
     MSEPositionY,              // 40
@@ -4980,7 +4980,7 @@ MovementStatusElements const MovementWaterWalkAck[] = // 5.4.8 18414
     MSEEnd
 };
 
-MovementStatusElements const MovementUpdateKnockBack[] =
+constexpr MovementStatusElements MovementUpdateKnockBack[] =
 {
     MSEHasGuidByte5,           // 21
     MSEHasSplineElevation,     // 36
@@ -5057,7 +5057,7 @@ MovementStatusElements const MovementUpdateKnockBack[] =
     MSEEnd,
 };
 
-MovementStatusElements const MovementUpdatePitchBack[] = // 5.4.8 18414
+constexpr MovementStatusElements MovementUpdatePitchBack[] = // 5.4.8 18414
 {
     MSEHasGuidByte7,           // 23
     MSEHasMovementFlags,       // 24
@@ -5136,7 +5136,7 @@ MovementStatusElements const MovementUpdatePitchBack[] = // 5.4.8 18414
     MSEEnd
 };
 
-MovementStatusElements const MovementUpdateTurnRate[] = // 5.4.8 18414
+constexpr MovementStatusElements MovementUpdateTurnRate[] = // 5.4.8 18414
 {
     MSEHasGuidByte4,           // 28
     MSEHasFallData,            // 148
@@ -5215,7 +5215,7 @@ MovementStatusElements const MovementUpdateTurnRate[] = // 5.4.8 18414
     MSEEnd
 };
 
-MovementStatusElements const SplineMoveSetWalkSpeed[] = // 5.4.8 18414
+constexpr MovementStatusElements SplineMoveSetWalkSpeed[] = // 5.4.8 18414
 {
     MSEHasGuidByte4,
     MSEHasGuidByte1,
@@ -5237,7 +5237,7 @@ MovementStatusElements const SplineMoveSetWalkSpeed[] = // 5.4.8 18414
     MSEEnd,
 };
 
-MovementStatusElements const SplineMoveSetRunSpeed[] = // 5.4.8 18414
+constexpr MovementStatusElements SplineMoveSetRunSpeed[] = // 5.4.8 18414
 {
     MSEHasGuidByte3,
     MSEHasGuidByte0,
@@ -5259,7 +5259,7 @@ MovementStatusElements const SplineMoveSetRunSpeed[] = // 5.4.8 18414
     MSEEnd,
 };
 
-MovementStatusElements const SplineMoveSetRunBackSpeed[] = // 5.4.8 18414
+constexpr MovementStatusElements SplineMoveSetRunBackSpeed[] = // 5.4.8 18414
 {
     MSEHasGuidByte7,
     MSEHasGuidByte4,
@@ -5281,7 +5281,7 @@ MovementStatusElements const SplineMoveSetRunBackSpeed[] = // 5.4.8 18414
     MSEEnd,
 };
 
-MovementStatusElements const SplineMoveSetSwimSpeed[] = // 5.4.8 18414
+constexpr MovementStatusElements SplineMoveSetSwimSpeed[] = // 5.4.8 18414
 {
     MSEHasGuidByte5,
     MSEHasGuidByte6,
@@ -5303,7 +5303,7 @@ MovementStatusElements const SplineMoveSetSwimSpeed[] = // 5.4.8 18414
     MSEEnd,
 };
 
-MovementStatusElements const SplineMoveSetSwimBackSpeed[] = // 5.4.8 18414
+constexpr MovementStatusElements SplineMoveSetSwimBackSpeed[] = // 5.4.8 18414
 {
     MSEHasGuidByte2,
     MSEHasGuidByte6,
@@ -5325,7 +5325,7 @@ MovementStatusElements const SplineMoveSetSwimBackSpeed[] = // 5.4.8 18414
     MSEEnd,
 };
 
-MovementStatusElements const SplineMoveSetTurnRate[] = // 5.4.8 18414
+constexpr MovementStatusElements SplineMoveSetTurnRate[] = // 5.4.8 18414
 {
     MSEHasGuidByte5,
     MSEHasGuidByte7,
@@ -5347,7 +5347,7 @@ MovementStatusElements const SplineMoveSetTurnRate[] = // 5.4.8 18414
     MSEEnd,
 };
 
-MovementStatusElements const SplineMoveSetFlightSpeed[] = // 5.4.8 18414
+constexpr MovementStatusElements SplineMoveSetFlightSpeed[] = // 5.4.8 18414
 {
     MSEExtraElement,
     MSEHasGuidByte1,
@@ -5369,7 +5369,7 @@ MovementStatusElements const SplineMoveSetFlightSpeed[] = // 5.4.8 18414
     MSEEnd,
 };
 
-MovementStatusElements const SplineMoveSetFlightBackSpeed[] = // 5.4.8 18414
+constexpr MovementStatusElements SplineMoveSetFlightBackSpeed[] = // 5.4.8 18414
 {
     MSEHasGuidByte6,
     MSEHasGuidByte0,
@@ -5391,7 +5391,7 @@ MovementStatusElements const SplineMoveSetFlightBackSpeed[] = // 5.4.8 18414
     MSEEnd,
 };
 
-MovementStatusElements const SplineMoveSetPitchRate[] = // 5.4.8 18414
+constexpr MovementStatusElements SplineMoveSetPitchRate[] = // 5.4.8 18414
 {
     MSEHasGuidByte2,
     MSEHasGuidByte6,
@@ -5413,7 +5413,7 @@ MovementStatusElements const SplineMoveSetPitchRate[] = // 5.4.8 18414
     MSEEnd,
 };
 
-MovementStatusElements const MoveSetWalkSpeed[] = // 5.4.8 18414
+constexpr MovementStatusElements MoveSetWalkSpeed[] = // 5.4.8 18414
 {
     MSEHasGuidByte6,
     MSEHasGuidByte7,
@@ -5436,7 +5436,7 @@ MovementStatusElements const MoveSetWalkSpeed[] = // 5.4.8 18414
     MSEEnd,
 };
 
-MovementStatusElements const MoveSetRunSpeed[] = // 5.4.8 18414
+constexpr MovementStatusElements MoveSetRunSpeed[] = // 5.4.8 18414
 {
     MSEHasGuidByte1,
     MSEHasGuidByte7,
@@ -5459,7 +5459,7 @@ MovementStatusElements const MoveSetRunSpeed[] = // 5.4.8 18414
     MSEEnd,
 };
 
-MovementStatusElements const MoveSetRunBackSpeed[] = //5.4.8 18414
+constexpr MovementStatusElements MoveSetRunBackSpeed[] = //5.4.8 18414
 {
     MSEHasGuidByte7,
     MSEHasGuidByte1,
@@ -5482,7 +5482,7 @@ MovementStatusElements const MoveSetRunBackSpeed[] = //5.4.8 18414
     MSEEnd,
 };
 
-MovementStatusElements const MoveSetSwimSpeed[] = //5.4.8 18414
+constexpr MovementStatusElements MoveSetSwimSpeed[] = //5.4.8 18414
 {
     MSEHasGuidByte5,
     MSEHasGuidByte0,
@@ -5505,7 +5505,7 @@ MovementStatusElements const MoveSetSwimSpeed[] = //5.4.8 18414
     MSEEnd,
 };
 
-MovementStatusElements const MoveSetSwimBackSpeed[] = //5.4.8 18414
+constexpr MovementStatusElements MoveSetSwimBackSpeed[] = //5.4.8 18414
 {
     MSEHasGuidByte5,
     MSEHasGuidByte0,
@@ -5528,7 +5528,7 @@ MovementStatusElements const MoveSetSwimBackSpeed[] = //5.4.8 18414
     MSEEnd,
 };
 
-MovementStatusElements const MoveSetTurnRate[] = //5.4.8 18414
+constexpr MovementStatusElements MoveSetTurnRate[] = //5.4.8 18414
 {
     MSEHasGuidByte6,
     MSEHasGuidByte5,
@@ -5551,7 +5551,7 @@ MovementStatusElements const MoveSetTurnRate[] = //5.4.8 18414
     MSEEnd,
 };
 
-MovementStatusElements const MoveSetFlightSpeed[] = //5.4.8 18414
+constexpr MovementStatusElements MoveSetFlightSpeed[] = //5.4.8 18414
 {
     MSEExtraElement,
     MSEUintCount,
@@ -5574,7 +5574,7 @@ MovementStatusElements const MoveSetFlightSpeed[] = //5.4.8 18414
     MSEEnd,
 };
 
-MovementStatusElements const MoveSetFlightBackSpeed[] = //5.4.8 18414
+constexpr MovementStatusElements MoveSetFlightBackSpeed[] = //5.4.8 18414
 {
     MSEHasGuidByte2,
     MSEHasGuidByte7,
@@ -5597,7 +5597,7 @@ MovementStatusElements const MoveSetFlightBackSpeed[] = //5.4.8 18414
     MSEEnd,
 };
 
-MovementStatusElements const MoveSetPitchRate[] = //5.4.8 18414
+constexpr MovementStatusElements MoveSetPitchRate[] = //5.4.8 18414
 {
     MSEHasGuidByte7,
     MSEHasGuidByte5,
@@ -5620,7 +5620,7 @@ MovementStatusElements const MoveSetPitchRate[] = //5.4.8 18414
     MSEEnd,
 };
 
-MovementStatusElements const MoveSetCollisionHeight[] = //5.4.8 18414
+constexpr MovementStatusElements MoveSetCollisionHeight[] = //5.4.8 18414
 {
     MSEHasGuidByte7,
     MSEHasGuidByte0,
@@ -5648,7 +5648,7 @@ MovementStatusElements const MoveSetCollisionHeight[] = //5.4.8 18414
     MSEEnd
 };
 
-MovementStatusElements const SplineMoveSetWalkMode[] = // 5.4.8 18414
+constexpr MovementStatusElements SplineMoveSetWalkMode[] = // 5.4.8 18414
 {
     MSEHasGuidByte4,
     MSEHasGuidByte3,
@@ -5669,7 +5669,7 @@ MovementStatusElements const SplineMoveSetWalkMode[] = // 5.4.8 18414
     MSEEnd,
 };
 
-MovementStatusElements const SplineMoveSetRunMode[] = // 5.4.8 18414
+constexpr MovementStatusElements SplineMoveSetRunMode[] = // 5.4.8 18414
 {
     MSEHasGuidByte5,
     MSEHasGuidByte6,
@@ -5690,7 +5690,7 @@ MovementStatusElements const SplineMoveSetRunMode[] = // 5.4.8 18414
     MSEEnd,
 };
 
-MovementStatusElements const SplineMoveGravityDisable[] = // 5.4.8 18414
+constexpr MovementStatusElements SplineMoveGravityDisable[] = // 5.4.8 18414
 {
     MSEHasGuidByte1,
     MSEHasGuidByte7,
@@ -5711,7 +5711,7 @@ MovementStatusElements const SplineMoveGravityDisable[] = // 5.4.8 18414
     MSEEnd,
 };
 
-MovementStatusElements const SplineMoveGravityEnable[] = // 5.4.8 18414
+constexpr MovementStatusElements SplineMoveGravityEnable[] = // 5.4.8 18414
 {
     MSEHasGuidByte5,
     MSEHasGuidByte7,
@@ -5732,7 +5732,7 @@ MovementStatusElements const SplineMoveGravityEnable[] = // 5.4.8 18414
     MSEEnd,
 };
 
-MovementStatusElements const SplineMoveSetHover[] = // 5.4.8 18414
+constexpr MovementStatusElements SplineMoveSetHover[] = // 5.4.8 18414
 {
     MSEHasGuidByte6,
     MSEHasGuidByte5,
@@ -5753,7 +5753,7 @@ MovementStatusElements const SplineMoveSetHover[] = // 5.4.8 18414
     MSEEnd,
 };
 
-MovementStatusElements const SplineMoveUnsetHover[] = // 5.4.8 18414
+constexpr MovementStatusElements SplineMoveUnsetHover[] = // 5.4.8 18414
 {
     MSEHasGuidByte3,
     MSEHasGuidByte1,
@@ -5774,7 +5774,7 @@ MovementStatusElements const SplineMoveUnsetHover[] = // 5.4.8 18414
     MSEEnd,
 };
 
-MovementStatusElements const SplineMoveStartSwim[] = // 5.4.8 18414
+constexpr MovementStatusElements SplineMoveStartSwim[] = // 5.4.8 18414
 {
     MSEHasGuidByte7,
     MSEHasGuidByte4,
@@ -5795,7 +5795,7 @@ MovementStatusElements const SplineMoveStartSwim[] = // 5.4.8 18414
     MSEEnd,
 };
 
-MovementStatusElements const SplineMoveStopSwim[] = // 5.4.8 18414
+constexpr MovementStatusElements SplineMoveStopSwim[] = // 5.4.8 18414
 {
     MSEHasGuidByte3,
     MSEHasGuidByte7,
@@ -5816,7 +5816,7 @@ MovementStatusElements const SplineMoveStopSwim[] = // 5.4.8 18414
     MSEEnd,
 };
 
-MovementStatusElements const SplineMoveSetFlying[] = // 5.4.8 18414
+constexpr MovementStatusElements SplineMoveSetFlying[] = // 5.4.8 18414
 {
     MSEHasGuidByte4,
     MSEHasGuidByte1,
@@ -5837,7 +5837,7 @@ MovementStatusElements const SplineMoveSetFlying[] = // 5.4.8 18414
     MSEEnd,
 };
 
-MovementStatusElements const SplineMoveUnsetFlying[] = // 5.4.8 18414
+constexpr MovementStatusElements SplineMoveUnsetFlying[] = // 5.4.8 18414
 {
     MSEHasGuidByte1,
     MSEHasGuidByte5,
@@ -5858,7 +5858,7 @@ MovementStatusElements const SplineMoveUnsetFlying[] = // 5.4.8 18414
     MSEEnd,
 };
 
-MovementStatusElements const SplineMoveSetWaterWalk[] = // 5.4.8 18414
+constexpr MovementStatusElements SplineMoveSetWaterWalk[] = // 5.4.8 18414
 {
     MSEHasGuidByte3,
     MSEHasGuidByte1,
@@ -5879,7 +5879,7 @@ MovementStatusElements const SplineMoveSetWaterWalk[] = // 5.4.8 18414
     MSEEnd,
 };
 
-MovementStatusElements const SplineMoveSetLandWalk[] = // 5.4.8 18414
+constexpr MovementStatusElements SplineMoveSetLandWalk[] = // 5.4.8 18414
 {
     MSEHasGuidByte1,
     MSEHasGuidByte5,
@@ -5900,7 +5900,7 @@ MovementStatusElements const SplineMoveSetLandWalk[] = // 5.4.8 18414
     MSEEnd,
 };
 
-MovementStatusElements const SplineMoveSetFeatherFall[] = // 5.4.8 18414
+constexpr MovementStatusElements SplineMoveSetFeatherFall[] = // 5.4.8 18414
 {
     MSEHasGuidByte1,
     MSEHasGuidByte5,
@@ -5921,7 +5921,7 @@ MovementStatusElements const SplineMoveSetFeatherFall[] = // 5.4.8 18414
     MSEEnd,
 };
 
-MovementStatusElements const SplineMoveSetNormalFall[] = // 5.4.8 18414
+constexpr MovementStatusElements SplineMoveSetNormalFall[] = // 5.4.8 18414
 {
     MSEHasGuidByte6,
     MSEHasGuidByte1,
@@ -5942,7 +5942,7 @@ MovementStatusElements const SplineMoveSetNormalFall[] = // 5.4.8 18414
     MSEEnd,
 };
 
-MovementStatusElements const SplineMoveRoot[] = // 5.4.8 18414
+constexpr MovementStatusElements SplineMoveRoot[] = // 5.4.8 18414
 {
     MSEHasGuidByte3,
     MSEHasGuidByte7,
@@ -5963,7 +5963,7 @@ MovementStatusElements const SplineMoveRoot[] = // 5.4.8 18414
     MSEEnd,
 };
 
-MovementStatusElements const SplineMoveUnroot[] = // 5.4.8 18414
+constexpr MovementStatusElements SplineMoveUnroot[] = // 5.4.8 18414
 {
     MSEHasGuidByte1,
     MSEHasGuidByte5,
@@ -5984,7 +5984,7 @@ MovementStatusElements const SplineMoveUnroot[] = // 5.4.8 18414
     MSEEnd,
 };
 
-MovementStatusElements const MoveSetCanFly[] = // 5.4.8 18414
+constexpr MovementStatusElements MoveSetCanFly[] = // 5.4.8 18414
 {
     MSEHasGuidByte6,
     MSEHasGuidByte1,
@@ -6006,7 +6006,7 @@ MovementStatusElements const MoveSetCanFly[] = // 5.4.8 18414
     MSEEnd,
 };
 
-MovementStatusElements const MoveUnsetCanFly[] = // 5.4.8 18414
+constexpr MovementStatusElements MoveUnsetCanFly[] = // 5.4.8 18414
 {
     MSEHasGuidByte6,
     MSEHasGuidByte5,
@@ -6028,7 +6028,7 @@ MovementStatusElements const MoveUnsetCanFly[] = // 5.4.8 18414
     MSEEnd,
 };
 
-MovementStatusElements const MoveSetHover[] = //5.4.8 18414
+constexpr MovementStatusElements MoveSetHover[] = //5.4.8 18414
 {
     MSEHasGuidByte7,
     MSEHasGuidByte1,
@@ -6050,7 +6050,7 @@ MovementStatusElements const MoveSetHover[] = //5.4.8 18414
     MSEEnd,
 };
 
-MovementStatusElements const MoveUnsetHover[] = // 5.4.8 18414
+constexpr MovementStatusElements MoveUnsetHover[] = // 5.4.8 18414
 {
     MSEHasGuidByte3,
     MSEHasGuidByte5,
@@ -6072,7 +6072,7 @@ MovementStatusElements const MoveUnsetHover[] = // 5.4.8 18414
     MSEEnd,
 };
 
-MovementStatusElements const MoveGravityDisable[] = // 5.4.8 18414
+constexpr MovementStatusElements MoveGravityDisable[] = // 5.4.8 18414
 {
     MSEHasGuidByte6, //22
     MSEHasGuidByte1, //17
@@ -6092,9 +6092,10 @@ MovementStatusElements const MoveGravityDisable[] = // 5.4.8 18414
     MSEGuidByte3, //19
     MSEGuidByte4, //20
     MSEGuidByte7, //23
+    MSEEnd,
 };
 
-MovementStatusElements const MoveGravityEnable[] = // 5.4.8 18414
+constexpr MovementStatusElements MoveGravityEnable[] = // 5.4.8 18414
 {
     MSEHasGuidByte3, //19
     MSEHasGuidByte0, //16
@@ -6114,9 +6115,10 @@ MovementStatusElements const MoveGravityEnable[] = // 5.4.8 18414
     MSEGuidByte4, //20
     MSECounter,   // uint32
     MSEGuidByte5, //21
+    MSEEnd,
 };
 
-MovementStatusElements const MoveWaterWalk[] = //5.4.8 18414
+constexpr MovementStatusElements MoveWaterWalk[] = //5.4.8 18414
 {
     MSEHasGuidByte2,
     MSEHasGuidByte0,
@@ -6138,7 +6140,7 @@ MovementStatusElements const MoveWaterWalk[] = //5.4.8 18414
     MSEEnd,
 };
 
-MovementStatusElements const MoveLandWalk[] = //5.4.8 18414
+constexpr MovementStatusElements MoveLandWalk[] = //5.4.8 18414
 {
     MSEHasGuidByte0,
     MSEHasGuidByte7,
@@ -6160,7 +6162,7 @@ MovementStatusElements const MoveLandWalk[] = //5.4.8 18414
     MSEEnd,
 };
 
-MovementStatusElements const MoveFeatherFall[] = //5.4.8 18414
+constexpr MovementStatusElements MoveFeatherFall[] = //5.4.8 18414
 {
     MSEHasGuidByte4,
     MSEHasGuidByte1,
@@ -6182,7 +6184,7 @@ MovementStatusElements const MoveFeatherFall[] = //5.4.8 18414
     MSEEnd,
 };
 
-MovementStatusElements const MoveNormalFall[] = //5.4.8 18414
+constexpr MovementStatusElements MoveNormalFall[] = //5.4.8 18414
 {
     MSEHasGuidByte3,
     MSEHasGuidByte1,
@@ -6204,7 +6206,7 @@ MovementStatusElements const MoveNormalFall[] = //5.4.8 18414
     MSEEnd,
 };
 
-MovementStatusElements const MoveRoot[] = // 5.4.8 18414
+constexpr MovementStatusElements MoveRoot[] = // 5.4.8 18414
 {
     MSEHasGuidByte0,
     MSEHasGuidByte3,
@@ -6226,7 +6228,7 @@ MovementStatusElements const MoveRoot[] = // 5.4.8 18414
     MSEEnd,
 };
 
-MovementStatusElements const MoveUnroot[] = // 5.4.8 18414
+constexpr MovementStatusElements MoveUnroot[] = // 5.4.8 18414
 {
     MSEHasGuidByte3,
     MSEHasGuidByte5,
@@ -6248,7 +6250,7 @@ MovementStatusElements const MoveUnroot[] = // 5.4.8 18414
     MSEEnd,
 };
 
-MovementStatusElements const ChangeSeatsOnControlledVehicle[] =
+constexpr MovementStatusElements ChangeSeatsOnControlledVehicle[] =
 {
     MSEPositionY,
     MSEPositionX,
@@ -6337,7 +6339,7 @@ MovementStatusElements const ChangeSeatsOnControlledVehicle[] =
     MSEEnd,
 };
 
-MovementStatusElements const CastSpellEmbeddedMovement[] =
+constexpr MovementStatusElements CastSpellEmbeddedMovement[] =
 {
     MSEPositionZ,
     MSEPositionY,
@@ -6550,247 +6552,1308 @@ void Movement::PacketSender::Send() const
     }
 }
 
-MovementStatusElements const* GetMovementStatusElementsSequence(Opcodes opcode)
+namespace
 {
-    switch (opcode)
+    template <MovementStatusElements Element>
+    void ReadMovementElement(ByteBuffer& data, Movement::MovementReadState& state)
     {
-        case MSG_MOVE_FALL_LAND:
-            return MovementFallLand;
-        case MSG_MOVE_HEARTBEAT:
-            return MovementHeartBeat;
-        case MSG_MOVE_JUMP:
-            return MovementJump;
-        case MSG_MOVE_SET_FACING:
-            return MovementSetFacing;
-        case MSG_MOVE_SET_PITCH:
-            return MovementSetPitch;
-        case MSG_MOVE_START_ASCEND:
-            return MovementStartAscend;
-        case MSG_MOVE_START_BACKWARD:
-            return MovementStartBackward;
-        case MSG_MOVE_START_DESCEND:
-            return MovementStartDescend;
-        case MSG_MOVE_START_FORWARD:
-            return MovementStartForward;
-        case MSG_MOVE_START_PITCH_DOWN:
-            return MovementStartPitchDown;
-        case MSG_MOVE_START_PITCH_UP:
-            return MovementStartPitchUp;
-        case MSG_MOVE_START_STRAFE_LEFT:
-            return MovementStartStrafeLeft;
-        case MSG_MOVE_START_STRAFE_RIGHT:
-            return MovementStartStrafeRight;
-        case MSG_MOVE_START_SWIM:
-            return MovementStartSwim;
-        case MSG_MOVE_START_TURN_LEFT:
-            return MovementStartTurnLeft;
-        case MSG_MOVE_START_TURN_RIGHT:
-            return MovementStartTurnRight;
-        case MSG_MOVE_STOP:
-            return MovementStop;
-        case MSG_MOVE_STOP_ASCEND:
-            return MovementStopAscend;
-        case MSG_MOVE_STOP_PITCH:
-            return MovementStopPitch;
-        case MSG_MOVE_STOP_STRAFE:
-            return MovementStopStrafe;
-        case MSG_MOVE_STOP_SWIM:
-            return MovementStopSwim;
-        case MSG_MOVE_STOP_TURN:
-            return MovementStopTurn;
-        case SMSG_PLAYER_MOVE:
-            return PlayerMove;
-        case CMSG_MOVE_CHNG_TRANSPORT:
-            return MoveChngTransport;
-        case CMSG_MOVE_SPLINE_DONE:
-            return MoveSplineDone;
-            //case CMSG_MOVE_NOT_ACTIVE_MOVER:
-            //    return MoveNotActiveMover;
-        case CMSG_DISMISS_CONTROLLED_VEHICLE:
-            return DismissControlledVehicle;
-        case SMSG_MOVE_TELEPORT:
-            return MoveTeleport;
-            //case SMSG_MOVE_UPDATE_TELEPORT:
-            //    return MoveUpdateTeleport;
-        case CMSG_FORCE_MOVE_ROOT_ACK:
-            return ForceMoveRootAck;
-        case CMSG_FORCE_MOVE_UNROOT_ACK:
-            return ForceMoveUnrootAck;
-        case CMSG_MOVE_FALL_RESET:
-            return MovementFallReset;
-        case CMSG_MOVE_FEATHER_FALL_ACK:
-            return MovementFeatherFallAck;
-        case CMSG_MOVE_FORCE_FLIGHT_BACK_SPEED_CHANGE_ACK:
-            return MovementForceFlightBackSpeedChangeAck;
-        case CMSG_MOVE_FORCE_FLIGHT_SPEED_CHANGE_ACK:
-            return MovementForceFlightSpeedChangeAck;
-        case CMSG_MOVE_FORCE_PITCH_RATE_CHANGE_ACK:
-            return MovementForcePitchRateChangeAck;
-        case CMSG_MOVE_FORCE_RUN_BACK_SPEED_CHANGE_ACK:
-            return MovementForceRunBackSpeedChangeAck;
-        case CMSG_MOVE_FORCE_RUN_SPEED_CHANGE_ACK:
-            return MovementForceRunSpeedChangeAck;
-        case CMSG_MOVE_FORCE_SWIM_BACK_SPEED_CHANGE_ACK:
-            return MovementForceSwimBackSpeedChangeAck;
-        case CMSG_MOVE_FORCE_SWIM_SPEED_CHANGE_ACK:
-            return MovementForceSwimSpeedChangeAck;
-        case CMSG_MOVE_FORCE_TURN_RATE_CHANGE_ACK:
-            return MovementForceTurnRateChangeAck;
-        case CMSG_MOVE_FORCE_WALK_SPEED_CHANGE_ACK:
-            return MovementForceWalkSpeedChangeAck;
-        case CMSG_MOVE_GRAVITY_DISABLE_ACK:
-            return MovementGravityDisableAck;
-        case CMSG_MOVE_GRAVITY_ENABLE_ACK:
-            return MovementGravityEnableAck;
-        case CMSG_MOVE_HOVER_ACK:
-            return MovementHoverAck;
-            //case CMSG_MOVE_KNOCK_BACK_ACK:
-            //    return MovementKnockBackAck;
-            //case CMSG_MOVE_SET_CAN_FLY:
-            //    return MovementSetCanFly;
-        case CMSG_MOVE_SET_FLY:
-            return MovementSetFly;
-        case CMSG_MOVE_SET_CAN_FLY_ACK:
-            return MovementSetCanFlyAck;
-            //case CMSG_MOVE_SET_CAN_TRANSITION_BETWEEN_SWIM_AND_FLY_ACK:
-            //    return MovementSetCanTransitionBetweenSwimAndFlyAck;
-        case CMSG_MOVE_APPLY_MOVEMENT_FORCE_ACK:
-            return MovementApplyMovementForceAck;
-        case CMSG_MOVE_REMOVE_MOVEMENT_FORCE_ACK:
-            return MovementRemoveMovementForceAck;
-        case SMSG_MOVE_SET_COLLISION_HEIGHT:
-            return MoveSetCollisionHeight;
-        case CMSG_MOVE_SET_COLLISION_HEIGHT_ACK:
-            return MovementSetCollisionHeightAck;
-        case SMSG_MOVE_UPDATE_COLLISION_HEIGHT:
-            return MovementUpdateCollisionHeight;
-        case CMSG_MOVE_WATER_WALK_ACK:
-            return MovementWaterWalkAck;
-        case MSG_MOVE_SET_RUN_MODE:
-            return MovementSetRunMode;
-        case MSG_MOVE_SET_WALK_MODE:
-            return MovementSetWalkMode;
-        case SMSG_MOVE_UPDATE_FLIGHT_BACK_SPEED:
-            return MovementUpdateFlightBackSpeed;
-        case SMSG_MOVE_UPDATE_FLIGHT_SPEED:
-            return MovementUpdateFlightSpeed;
-        case SMSG_MOVE_UPDATE_RUN_SPEED:
-            return MovementUpdateRunSpeed;
-            //case SMSG_MOVE_UPDATE_KNOCK_BACK:
-            //    return MovementUpdateKnockBack;
-        case SMSG_MOVE_UPDATE_PITCH_RATE:
-            return MovementUpdatePitchBack;
-        case SMSG_MOVE_UPDATE_RUN_BACK_SPEED:
-            return MovementUpdateRunBackSpeed;
-        case SMSG_MOVE_UPDATE_SWIM_BACK_SPEED:
-            return MovementUpdateSwimBackSpeed;
-        case SMSG_MOVE_UPDATE_SWIM_SPEED:
-            return MovementUpdateSwimSpeed;
-        case SMSG_MOVE_UPDATE_WALK_SPEED:
-            return MovementUpdateWalkSpeed;
-        case SMSG_MOVE_UPDATE_TURN_RATE:
-            return MovementUpdateTurnRate;
-        case SMSG_SPLINE_MOVE_SET_WALK_SPEED:
-            return SplineMoveSetWalkSpeed;
-        case SMSG_SPLINE_MOVE_SET_RUN_SPEED:
-            return SplineMoveSetRunSpeed;
-        case SMSG_SPLINE_MOVE_SET_RUN_BACK_SPEED:
-            return SplineMoveSetRunBackSpeed;
-        case SMSG_SPLINE_MOVE_SET_SWIM_SPEED:
-            return SplineMoveSetSwimSpeed;
-        case SMSG_SPLINE_MOVE_SET_SWIM_BACK_SPEED:
-            return SplineMoveSetSwimBackSpeed;
-        case SMSG_SPLINE_MOVE_SET_TURN_RATE:
-            return SplineMoveSetTurnRate;
-        case SMSG_SPLINE_MOVE_SET_FLIGHT_SPEED:
-            return SplineMoveSetFlightSpeed;
-        case SMSG_SPLINE_MOVE_SET_FLIGHT_BACK_SPEED:
-            return SplineMoveSetFlightBackSpeed;
-        case SMSG_SPLINE_MOVE_SET_PITCH_RATE:
-            return SplineMoveSetPitchRate;
-        case SMSG_MOVE_SET_WALK_SPEED:
-            return MoveSetWalkSpeed;
-        case SMSG_MOVE_SET_RUN_SPEED:
-            return MoveSetRunSpeed;
-        case SMSG_MOVE_SET_RUN_BACK_SPEED:
-            return MoveSetRunBackSpeed;
-        case SMSG_MOVE_SET_SWIM_SPEED:
-            return MoveSetSwimSpeed;
-        case SMSG_MOVE_SET_SWIM_BACK_SPEED:
-            return MoveSetSwimBackSpeed;
-        case SMSG_MOVE_SET_TURN_RATE:
-            return MoveSetTurnRate;
-        case SMSG_MOVE_SET_FLIGHT_SPEED:
-            return MoveSetFlightSpeed;
-        case SMSG_MOVE_SET_FLIGHT_BACK_SPEED:
-            return MoveSetFlightBackSpeed;
-        case SMSG_MOVE_SET_PITCH_RATE:
-            return MoveSetPitchRate;
-        case SMSG_SPLINE_MOVE_SET_WALK_MODE:
-            return SplineMoveSetWalkMode;
-        case SMSG_SPLINE_MOVE_SET_RUN_MODE:
-            return SplineMoveSetRunMode;
-        case SMSG_SPLINE_MOVE_GRAVITY_DISABLE:
-            return SplineMoveGravityDisable;
-        case SMSG_SPLINE_MOVE_GRAVITY_ENABLE:
-            return SplineMoveGravityEnable;
-        case SMSG_SPLINE_MOVE_SET_HOVER:
-            return SplineMoveSetHover;
-        case SMSG_SPLINE_MOVE_UNSET_HOVER:
-            return SplineMoveUnsetHover;
-        case SMSG_SPLINE_MOVE_START_SWIM:
-            return SplineMoveStartSwim;
-        case SMSG_SPLINE_MOVE_STOP_SWIM:
-            return SplineMoveStopSwim;
-        case SMSG_SPLINE_MOVE_SET_FLYING:
-            return SplineMoveSetFlying;
-        case SMSG_SPLINE_MOVE_UNSET_FLYING:
-            return SplineMoveUnsetFlying;
-        case SMSG_SPLINE_MOVE_SET_WATER_WALK:
-            return SplineMoveSetWaterWalk;
-        case SMSG_SPLINE_MOVE_SET_LAND_WALK:
-            return SplineMoveSetLandWalk;
-        case SMSG_SPLINE_MOVE_SET_FEATHER_FALL:
-            return SplineMoveSetFeatherFall;
-        case SMSG_SPLINE_MOVE_SET_NORMAL_FALL:
-            return SplineMoveSetNormalFall;
-        case SMSG_SPLINE_MOVE_ROOT:
-            return SplineMoveRoot;
-        case SMSG_SPLINE_MOVE_UNROOT:
-            return SplineMoveUnroot;
-        case SMSG_MOVE_SET_CAN_FLY:
-            return MoveSetCanFly;
-        case SMSG_MOVE_UNSET_CAN_FLY:
-            return MoveUnsetCanFly;
-        case SMSG_MOVE_SET_HOVER:
-            return MoveSetHover;
-        case SMSG_MOVE_UNSET_HOVER:
-            return MoveUnsetHover;
-        case SMSG_MOVE_GRAVITY_DISABLE:
-            return MoveGravityDisable;
-        case SMSG_MOVE_GRAVITY_ENABLE:
-            return MoveGravityEnable;
-        case SMSG_MOVE_WATER_WALK:
-            return MoveWaterWalk;
-        case SMSG_MOVE_LAND_WALK:
-            return MoveLandWalk;
-        case SMSG_MOVE_FEATHER_FALL:
-            return MoveFeatherFall;
-        case SMSG_MOVE_NORMAL_FALL:
-            return MoveNormalFall;
-        case SMSG_MOVE_ROOT:
-            return MoveRoot;
-        case SMSG_MOVE_UNROOT:
-            return MoveUnroot;
-        case CMSG_CHANGE_SEATS_ON_CONTROLLED_VEHICLE:
-            return ChangeSeatsOnControlledVehicle;
-            //case CMSG_CAST_SPELL:
-            //case CMSG_PET_CAST_SPELL:
-            //case CMSG_USE_ITEM:
-            //    return CastSpellEmbeddedMovement;*/
-        default:
-            break;
+        MovementInfo* mi = state.Info;
+
+        if constexpr (Element >= MSEHasGuidByte0 && Element <= MSEHasGuidByte7)
+            state.Guid[Element - MSEHasGuidByte0] = data.ReadBit();
+        else if constexpr (Element >= MSEHasTransportGuidByte0 && Element <= MSEHasTransportGuidByte7)
+        {
+            if (state.HasTransportData)
+                state.TransportGuid[Element - MSEHasTransportGuidByte0] = data.ReadBit();
+        }
+        else if constexpr (Element >= MSEGuidByte0 && Element <= MSEGuidByte7)
+            data.ReadByteSeq(state.Guid[Element - MSEGuidByte0]);
+        else if constexpr (Element >= MSETransportGuidByte0 && Element <= MSETransportGuidByte7)
+        {
+            if (state.HasTransportData)
+                data.ReadByteSeq(state.TransportGuid[Element - MSETransportGuidByte0]);
+        }
+        else if constexpr (Element == MSEHasMovementFlags)
+            state.HasMovementFlags = !data.ReadBit();
+        else if constexpr (Element == MSEHasMovementFlags2)
+            state.HasMovementFlags2 = !data.ReadBit();
+        else if constexpr (Element == MSEHasTimestamp)
+            state.HasTimestamp = !data.ReadBit();
+        else if constexpr (Element == MSEHasOrientation)
+            state.HasOrientation = !data.ReadBit();
+        else if constexpr (Element == MSEHasTransportData)
+            state.HasTransportData = data.ReadBit();
+        else if constexpr (Element == MSEHasTransportTime2)
+        {
+            if (state.HasTransportData)
+                state.HasTransportTime2 = data.ReadBit();
+        }
+        else if constexpr (Element == MSEHasTransportTime3)
+        {
+            if (state.HasTransportData)
+                state.HasTransportTime3 = data.ReadBit();
+        }
+        else if constexpr (Element == MSEHasPitch)
+            state.HasPitch = !data.ReadBit();
+        else if constexpr (Element == MSEHasFallData)
+            state.HasFallData = data.ReadBit();
+        else if constexpr (Element == MSEHasFallDirection)
+        {
+            if (state.HasFallData)
+                state.HasFallDirection = data.ReadBit();
+        }
+        else if constexpr (Element == MSEHasSplineElevation)
+            state.HasSplineElevation = !data.ReadBit();
+        else if constexpr (Element == MSEHasSpline)
+            data.ReadBit();
+        else if constexpr (Element == MSEHasMountDisplayId)
+            state.HasMountDisplayId = !data.ReadBit();
+        else if constexpr (Element == MSEMountDisplayIdWithCheck || Element == MSEMountDisplayIdWithoutCheck)
+        {
+            if (Element == MSEMountDisplayIdWithoutCheck || state.HasMountDisplayId)
+            {
+                data >> state.MountDisplayId;
+                state.MountDisplayIdRead = true;
+            }
+        }
+        else if constexpr (Element == MSEMovementFlags)
+        {
+            if (state.HasMovementFlags)
+                mi->flags = data.ReadBits(30);
+        }
+        else if constexpr (Element == MSEMovementFlags2)
+        {
+            if (state.HasMovementFlags2)
+                mi->flags2 = data.ReadBits(13);
+        }
+        else if constexpr (Element == MSETimestamp)
+        {
+            if (state.HasTimestamp)
+                data >> mi->time;
+        }
+        else if constexpr (Element == MSEPositionX)
+            data >> mi->pos.m_positionX;
+        else if constexpr (Element == MSEPositionY)
+            data >> mi->pos.m_positionY;
+        else if constexpr (Element == MSEPositionZ)
+            data >> mi->pos.m_positionZ;
+        else if constexpr (Element == MSEOrientation)
+        {
+            if (state.HasOrientation)
+                mi->pos.SetOrientation(data.read<float>());
+        }
+        else if constexpr (Element == MSETransportPositionX)
+        {
+            if (state.HasTransportData)
+                data >> mi->transport.pos.m_positionX;
+        }
+        else if constexpr (Element == MSETransportPositionY)
+        {
+            if (state.HasTransportData)
+                data >> mi->transport.pos.m_positionY;
+        }
+        else if constexpr (Element == MSETransportPositionZ)
+        {
+            if (state.HasTransportData)
+                data >> mi->transport.pos.m_positionZ;
+        }
+        else if constexpr (Element == MSETransportOrientation)
+        {
+            if (state.HasTransportData)
+                mi->transport.pos.SetOrientation(data.read<float>());
+        }
+        else if constexpr (Element == MSETransportSeat)
+        {
+            if (state.HasTransportData)
+                data >> mi->transport.seat;
+        }
+        else if constexpr (Element == MSETransportTime)
+        {
+            if (state.HasTransportData)
+                data >> mi->transport.time;
+        }
+        else if constexpr (Element == MSETransportTime2)
+        {
+            if (state.HasTransportData && state.HasTransportTime2)
+                data >> mi->transport.time2;
+        }
+        else if constexpr (Element == MSETransportTime3)
+        {
+            if (state.HasTransportData && state.HasTransportTime3)
+                data >> mi->transport.time3;
+        }
+        else if constexpr (Element == MSEPitch)
+        {
+            if (state.HasPitch)
+                mi->pitch = G3D::wrap(data.read<float>(), float(-M_PI), float(M_PI));
+        }
+        else if constexpr (Element == MSEFallTime)
+        {
+            if (state.HasFallData)
+                data >> mi->jump.fallTime;
+        }
+        else if constexpr (Element == MSEFallVerticalSpeed)
+        {
+            if (state.HasFallData)
+                data >> mi->jump.zspeed;
+        }
+        else if constexpr (Element == MSEFallCosAngle)
+        {
+            if (state.HasFallData && state.HasFallDirection)
+                data >> mi->jump.cosAngle;
+        }
+        else if constexpr (Element == MSEFallSinAngle)
+        {
+            if (state.HasFallData && state.HasFallDirection)
+                data >> mi->jump.sinAngle;
+        }
+        else if constexpr (Element == MSEFallHorizontalSpeed)
+        {
+            if (state.HasFallData && state.HasFallDirection)
+                data >> mi->jump.xyspeed;
+        }
+        else if constexpr (Element == MSESplineElevation)
+        {
+            if (state.HasSplineElevation)
+                data >> mi->splineElevation;
+        }
+        else if constexpr (Element == MSEForcesCount)
+            state.ForcesCount = data.ReadBits(22);
+        else if constexpr (Element == MSEForces)
+        {
+            for (uint32 i = 0; i < state.ForcesCount; i++)
+                data.read_skip<uint32>();
+        }
+        else if constexpr (Element == MSEHasCounter)
+            state.HasCounter = !data.ReadBit();
+        else if constexpr (Element == MSECounter)
+        {
+            if (state.HasCounter)
+                data.read_skip<uint32>();
+        }
+        else if constexpr (Element == MSECount)
+            data.read_skip<uint32>();
+        else if constexpr (Element == MSEZeroBit || Element == MSEOneBit)
+            data.ReadBit();
+        else if constexpr (Element == MSEExtraElement)
+            state.Extras->ReadNextElement(data);
+        else
+            ASSERT(Movement::PrintInvalidSequenceElement(Element, "Player::ReadMovementInfo"));
     }
 
+    template <MovementStatusElements Element>
+    void WriteMovementElement(ByteBuffer& data, Movement::MovementWriteState& state)
+    {
+        MovementInfo const* mi = state.Info;
+
+        if constexpr (Element >= MSEHasGuidByte0 && Element <= MSEHasGuidByte7)
+            data.WriteBit(state.Guid[Element - MSEHasGuidByte0]);
+        else if constexpr (Element >= MSEHasTransportGuidByte0 && Element <= MSEHasTransportGuidByte7)
+        {
+            if (state.HasTransportData)
+                data.WriteBit(state.TransportGuid[Element - MSEHasTransportGuidByte0]);
+        }
+        else if constexpr (Element >= MSEGuidByte0 && Element <= MSEGuidByte7)
+            data.WriteByteSeq(state.Guid[Element - MSEGuidByte0]);
+        else if constexpr (Element >= MSETransportGuidByte0 && Element <= MSETransportGuidByte7)
+        {
+            if (state.HasTransportData)
+                data.WriteByteSeq(state.TransportGuid[Element - MSETransportGuidByte0]);
+        }
+        else if constexpr (Element == MSEHasCounter)
+            data.WriteBit(!*state.Counter);
+        else if constexpr (Element == MSEHasMovementFlags)
+            data.WriteBit(!state.HasMovementFlags);
+        else if constexpr (Element == MSEHasMovementFlags2)
+            data.WriteBit(!state.HasMovementFlags2);
+        else if constexpr (Element == MSEHasMountDisplayId)
+            data.WriteBit(!state.HasMountDisplayId);
+        else if constexpr (Element == MSEHasTimestamp)
+            data.WriteBit(!state.HasTimestamp);
+        else if constexpr (Element == MSEHasOrientation)
+            data.WriteBit(!state.HasOrientation);
+        else if constexpr (Element == MSEHasTransportData)
+            data.WriteBit(state.HasTransportData);
+        else if constexpr (Element == MSEHasTransportTime2)
+        {
+            if (state.HasTransportData)
+                data.WriteBit(state.HasTransportTime2);
+        }
+        else if constexpr (Element == MSEHasTransportTime3)
+        {
+            if (state.HasTransportData)
+                data.WriteBit(state.HasTransportTime3);
+        }
+        else if constexpr (Element == MSEHasPitch)
+            data.WriteBit(!state.HasPitch);
+        else if constexpr (Element == MSEHasFallData)
+            data.WriteBit(state.HasFallData);
+        else if constexpr (Element == MSEHasFallDirection)
+        {
+            if (state.HasFallData)
+                data.WriteBit(state.HasFallDirection);
+        }
+        else if constexpr (Element == MSEHasSplineElevation)
+            data.WriteBit(!state.HasSplineElevation);
+        else if constexpr (Element == MSEHasSpline)
+            data.WriteBit(state.HasSpline);
+        else if constexpr (Element == MSEMountDisplayIdWithCheck || Element == MSEMountDisplayIdWithoutCheck)
+        {
+            if (Element == MSEMountDisplayIdWithoutCheck || state.HasMountDisplayId)
+                data << state.MountDisplayId;
+        }
+        else if constexpr (Element == MSEMovementFlags)
+        {
+            if (state.HasMovementFlags)
+                data.WriteBits(state.MovementFlags, 30);
+        }
+        else if constexpr (Element == MSEMovementFlags2)
+        {
+            if (state.HasMovementFlags2)
+                data.WriteBits(state.MovementFlags2, 13);
+        }
+        else if constexpr (Element == MSETimestamp)
+        {
+            if (state.HasTimestamp)
+                data << mi->time;
+        }
+        else if constexpr (Element == MSEPositionX)
+            data << state.PositionX;
+        else if constexpr (Element == MSEPositionY)
+            data << state.PositionY;
+        else if constexpr (Element == MSEPositionZ)
+            data << state.PositionZ;
+        else if constexpr (Element == MSEOrientation)
+        {
+            if (state.HasOrientation)
+                data << state.Orientation;
+        }
+        else if constexpr (Element == MSETransportPositionX)
+        {
+            if (state.HasTransportData)
+                data << mi->transport.pos.GetPositionX();
+        }
+        else if constexpr (Element == MSETransportPositionY)
+        {
+            if (state.HasTransportData)
+                data << mi->transport.pos.GetPositionY();
+        }
+        else if constexpr (Element == MSETransportPositionZ)
+        {
+            if (state.HasTransportData)
+                data << mi->transport.pos.GetPositionZ();
+        }
+        else if constexpr (Element == MSETransportOrientation)
+        {
+            if (state.HasTransportData)
+                data << mi->transport.pos.GetOrientation();
+        }
+        else if constexpr (Element == MSETransportSeat)
+        {
+            if (state.HasTransportData)
+                data << mi->transport.seat;
+        }
+        else if constexpr (Element == MSETransportTime)
+        {
+            if (state.HasTransportData)
+                data << mi->transport.time;
+        }
+        else if constexpr (Element == MSETransportTime2)
+        {
+            if (state.HasTransportData && state.HasTransportTime2)
+                data << mi->transport.time2;
+        }
+        else if constexpr (Element == MSETransportTime3)
+        {
+            if (state.HasTransportData && state.HasTransportTime3)
+                data << mi->transport.time3;
+        }
+        else if constexpr (Element == MSEPitch)
+        {
+            if (state.HasPitch)
+                data << mi->pitch;
+        }
+        else if constexpr (Element == MSEFallTime)
+        {
+            if (state.HasFallData)
+                data << mi->jump.fallTime;
+        }
+        else if constexpr (Element == MSEFallVerticalSpeed)
+        {
+            if (state.HasFallData)
+                data << mi->jump.zspeed;
+        }
+        else if constexpr (Element == MSEFallCosAngle)
+        {
+            if (state.HasFallData && state.HasFallDirection)
+                data << mi->jump.cosAngle;
+        }
+        else if constexpr (Element == MSEFallSinAngle)
+        {
+            if (state.HasFallData && state.HasFallDirection)
+                data << mi->jump.sinAngle;
+        }
+        else if constexpr (Element == MSEFallHorizontalSpeed)
+        {
+            if (state.HasFallData && state.HasFallDirection)
+                data << mi->jump.xyspeed;
+        }
+        else if constexpr (Element == MSESplineElevation)
+        {
+            if (state.HasSplineElevation)
+                data << mi->splineElevation;
+        }
+        else if constexpr (Element == MSEForcesCount)
+            data.WriteBits(0, 22);
+        else if constexpr (Element == MSECounter)
+        {
+            if (*state.Counter)
+                data << *state.Counter;
+            ++*state.Counter;
+        }
+        else if constexpr (Element == MSECount)
+            data << (*state.Counter)++;
+        else if constexpr (Element == MSEZeroBit)
+            data.WriteBit(0);
+        else if constexpr (Element == MSEOneBit)
+            data.WriteBit(1);
+        else if constexpr (Element == MSEExtraElement)
+            state.Extras->WriteNextElement(data);
+        else if constexpr (Element == MSEUintCount)
+            data << uint32(0);
+        else if constexpr (Element == MSEHasTransportVehicleId)
+            data.WriteBit(state.HasTransportVehicleId);
+        else if constexpr (Element == MSETransportVehicleId)
+        {
+            if (state.HasTransportVehicleId)
+                data << mi->transport.time3; // this should be renamed
+        }
+        else if constexpr (Element == MSEForces)
+            ; // forces are never sent, see MSEForcesCount
+        else if constexpr (Element == MSEFlushBits)
+            data.FlushBits();
+        else
+            ASSERT(Movement::PrintInvalidSequenceElement(Element, "Unit::WriteMovementInfo"));
+    }
+
+    // the sequence is unrolled at compile time, each element resolves to its handler without any dispatch
+    template <MovementStatusElements const* Sequence, uint32 Index = 0>
+    void ReadMovementSequence(ByteBuffer& data, Movement::MovementReadState& state)
+    {
+        if constexpr (Sequence[Index] != MSEEnd)
+        {
+            ReadMovementElement<Sequence[Index]>(data, state);
+            ReadMovementSequence<Sequence, Index + 1>(data, state);
+        }
+    }
+
+    template <MovementStatusElements const* Sequence, uint32 Index = 0>
+    void WriteMovementSequence(ByteBuffer& data, Movement::MovementWriteState& state)
+    {
+        if constexpr (Sequence[Index] != MSEEnd)
+        {
+            WriteMovementElement<Sequence[Index]>(data, state);
+            WriteMovementSequence<Sequence, Index + 1>(data, state);
+        }
+    }
+
+    struct MovementSequenceCodecEntry
+    {
+        Opcodes Opcode;
+        Movement::MovementSequenceCodec Codec;
+    };
+
+#define MOVEMENT_SEQUENCE_CODEC(opcode, sequence) { opcode, { sequence, &ReadMovementSequence<sequence>, &WriteMovementSequence<sequence> } }
+
+    MovementSequenceCodecEntry const MovementSequenceCodecs[] =
+    {
+    MOVEMENT_SEQUENCE_CODEC(MSG_MOVE_FALL_LAND, MovementFallLand),
+    MOVEMENT_SEQUENCE_CODEC(MSG_MOVE_HEARTBEAT, MovementHeartBeat),
+    MOVEMENT_SEQUENCE_CODEC(MSG_MOVE_JUMP, MovementJump),
+    MOVEMENT_SEQUENCE_CODEC(MSG_MOVE_SET_FACING, MovementSetFacing),
+    MOVEMENT_SEQUENCE_CODEC(MSG_MOVE_SET_PITCH, MovementSetPitch),
+    MOVEMENT_SEQUENCE_CODEC(MSG_MOVE_START_ASCEND, MovementStartAscend),
+    MOVEMENT_SEQUENCE_CODEC(MSG_MOVE_START_BACKWARD, MovementStartBackward),
+    MOVEMENT_SEQUENCE_CODEC(MSG_MOVE_START_DESCEND, MovementStartDescend),
+    MOVEMENT_SEQUENCE_CODEC(MSG_MOVE_START_FORWARD, MovementStartForward),
+    MOVEMENT_SEQUENCE_CODEC(MSG_MOVE_START_PITCH_DOWN, MovementStartPitchDown),
+    MOVEMENT_SEQUENCE_CODEC(MSG_MOVE_START_PITCH_UP, MovementStartPitchUp),
+    MOVEMENT_SEQUENCE_CODEC(MSG_MOVE_START_STRAFE_LEFT, MovementStartStrafeLeft),
+    MOVEMENT_SEQUENCE_CODEC(MSG_MOVE_START_STRAFE_RIGHT, MovementStartStrafeRight),
+    MOVEMENT_SEQUENCE_CODEC(MSG_MOVE_START_SWIM, MovementStartSwim),
+    MOVEMENT_SEQUENCE_CODEC(MSG_MOVE_START_TURN_LEFT, MovementStartTurnLeft),
+    MOVEMENT_SEQUENCE_CODEC(MSG_MOVE_START_TURN_RIGHT, MovementStartTurnRight),
+    MOVEMENT_SEQUENCE_CODEC(MSG_MOVE_STOP, MovementStop),
+    MOVEMENT_SEQUENCE_CODEC(MSG_MOVE_STOP_ASCEND, MovementStopAscend),
+    MOVEMENT_SEQUENCE_CODEC(MSG_MOVE_STOP_PITCH, MovementStopPitch),
+    MOVEMENT_SEQUENCE_CODEC(MSG_MOVE_STOP_STRAFE, MovementStopStrafe),
+    MOVEMENT_SEQUENCE_CODEC(MSG_MOVE_STOP_SWIM, MovementStopSwim),
+    MOVEMENT_SEQUENCE_CODEC(MSG_MOVE_STOP_TURN, MovementStopTurn),
+    MOVEMENT_SEQUENCE_CODEC(SMSG_PLAYER_MOVE, PlayerMove),
+    MOVEMENT_SEQUENCE_CODEC(CMSG_MOVE_CHNG_TRANSPORT, MoveChngTransport),
+    MOVEMENT_SEQUENCE_CODEC(CMSG_MOVE_SPLINE_DONE, MoveSplineDone),
+    MOVEMENT_SEQUENCE_CODEC(CMSG_DISMISS_CONTROLLED_VEHICLE, DismissControlledVehicle),
+    MOVEMENT_SEQUENCE_CODEC(SMSG_MOVE_TELEPORT, MoveTeleport),
+    MOVEMENT_SEQUENCE_CODEC(CMSG_FORCE_MOVE_ROOT_ACK, ForceMoveRootAck),
+    MOVEMENT_SEQUENCE_CODEC(CMSG_FORCE_MOVE_UNROOT_ACK, ForceMoveUnrootAck),
+    MOVEMENT_SEQUENCE_CODEC(CMSG_MOVE_FALL_RESET, MovementFallReset),
+    MOVEMENT_SEQUENCE_CODEC(CMSG_MOVE_FEATHER_FALL_ACK, MovementFeatherFallAck),
+    MOVEMENT_SEQUENCE_CODEC(CMSG_MOVE_FORCE_FLIGHT_BACK_SPEED_CHANGE_ACK, MovementForceFlightBackSpeedChangeAck),
+    MOVEMENT_SEQUENCE_CODEC(CMSG_MOVE_FORCE_FLIGHT_SPEED_CHANGE_ACK, MovementForceFlightSpeedChangeAck),
+    MOVEMENT_SEQUENCE_CODEC(CMSG_MOVE_FORCE_PITCH_RATE_CHANGE_ACK, MovementForcePitchRateChangeAck),
+    MOVEMENT_SEQUENCE_CODEC(CMSG_MOVE_FORCE_RUN_BACK_SPEED_CHANGE_ACK, MovementForceRunBackSpeedChangeAck),
+    MOVEMENT_SEQUENCE_CODEC(CMSG_MOVE_FORCE_RUN_SPEED_CHANGE_ACK, MovementForceRunSpeedChangeAck),
+    MOVEMENT_SEQUENCE_CODEC(CMSG_MOVE_FORCE_SWIM_BACK_SPEED_CHANGE_ACK, MovementForceSwimBackSpeedChangeAck),
+    MOVEMENT_SEQUENCE_CODEC(CMSG_MOVE_FORCE_SWIM_SPEED_CHANGE_ACK, MovementForceSwimSpeedChangeAck),
+    MOVEMENT_SEQUENCE_CODEC(CMSG_MOVE_FORCE_TURN_RATE_CHANGE_ACK, MovementForceTurnRateChangeAck),
+    MOVEMENT_SEQUENCE_CODEC(CMSG_MOVE_FORCE_WALK_SPEED_CHANGE_ACK, MovementForceWalkSpeedChangeAck),
+    MOVEMENT_SEQUENCE_CODEC(CMSG_MOVE_GRAVITY_DISABLE_ACK, MovementGravityDisableAck),
+    MOVEMENT_SEQUENCE_CODEC(CMSG_MOVE_GRAVITY_ENABLE_ACK, MovementGravityEnableAck),
+    MOVEMENT_SEQUENCE_CODEC(CMSG_MOVE_HOVER_ACK, MovementHoverAck),
+    MOVEMENT_SEQUENCE_CODEC(CMSG_MOVE_SET_FLY, MovementSetFly),
+    MOVEMENT_SEQUENCE_CODEC(CMSG_MOVE_SET_CAN_FLY_ACK, MovementSetCanFlyAck),
+    MOVEMENT_SEQUENCE_CODEC(CMSG_MOVE_APPLY_MOVEMENT_FORCE_ACK, MovementApplyMovementForceAck),
+    MOVEMENT_SEQUENCE_CODEC(CMSG_MOVE_REMOVE_MOVEMENT_FORCE_ACK, MovementRemoveMovementForceAck),
+    MOVEMENT_SEQUENCE_CODEC(SMSG_MOVE_SET_COLLISION_HEIGHT, MoveSetCollisionHeight),
+    MOVEMENT_SEQUENCE_CODEC(CMSG_MOVE_SET_COLLISION_HEIGHT_ACK, MovementSetCollisionHeightAck),
+    MOVEMENT_SEQUENCE_CODEC(SMSG_MOVE_UPDATE_COLLISION_HEIGHT, MovementUpdateCollisionHeight),
+    MOVEMENT_SEQUENCE_CODEC(CMSG_MOVE_WATER_WALK_ACK, MovementWaterWalkAck),
+    MOVEMENT_SEQUENCE_CODEC(MSG_MOVE_SET_RUN_MODE, MovementSetRunMode),
+    MOVEMENT_SEQUENCE_CODEC(MSG_MOVE_SET_WALK_MODE, MovementSetWalkMode),
+    MOVEMENT_SEQUENCE_CODEC(SMSG_MOVE_UPDATE_FLIGHT_BACK_SPEED, MovementUpdateFlightBackSpeed),
+    MOVEMENT_SEQUENCE_CODEC(SMSG_MOVE_UPDATE_FLIGHT_SPEED, MovementUpdateFlightSpeed),
+    MOVEMENT_SEQUENCE_CODEC(SMSG_MOVE_UPDATE_RUN_SPEED, MovementUpdateRunSpeed),
+    MOVEMENT_SEQUENCE_CODEC(SMSG_MOVE_UPDATE_PITCH_RATE, MovementUpdatePitchBack),
+    MOVEMENT_SEQUENCE_CODEC(SMSG_MOVE_UPDATE_RUN_BACK_SPEED, MovementUpdateRunBackSpeed),
+    MOVEMENT_SEQUENCE_CODEC(SMSG_MOVE_UPDATE_SWIM_BACK_SPEED, MovementUpdateSwimBackSpeed),
+    MOVEMENT_SEQUENCE_CODEC(SMSG_MOVE_UPDATE_SWIM_SPEED, MovementUpdateSwimSpeed),
+    MOVEMENT_SEQUENCE_CODEC(SMSG_MOVE_UPDATE_WALK_SPEED, MovementUpdateWalkSpeed),
+    MOVEMENT_SEQUENCE_CODEC(SMSG_MOVE_UPDATE_TURN_RATE, MovementUpdateTurnRate),
+    MOVEMENT_SEQUENCE_CODEC(SMSG_SPLINE_MOVE_SET_WALK_SPEED, SplineMoveSetWalkSpeed),
+    MOVEMENT_SEQUENCE_CODEC(SMSG_SPLINE_MOVE_SET_RUN_SPEED, SplineMoveSetRunSpeed),
+    MOVEMENT_SEQUENCE_CODEC(SMSG_SPLINE_MOVE_SET_RUN_BACK_SPEED, SplineMoveSetRunBackSpeed),
+    MOVEMENT_SEQUENCE_CODEC(SMSG_SPLINE_MOVE_SET_SWIM_SPEED, SplineMoveSetSwimSpeed),
+    MOVEMENT_SEQUENCE_CODEC(SMSG_SPLINE_MOVE_SET_SWIM_BACK_SPEED, SplineMoveSetSwimBackSpeed),
+    MOVEMENT_SEQUENCE_CODEC(SMSG_SPLINE_MOVE_SET_TURN_RATE, SplineMoveSetTurnRate),
+    MOVEMENT_SEQUENCE_CODEC(SMSG_SPLINE_MOVE_SET_FLIGHT_SPEED, SplineMoveSetFlightSpeed),
+    MOVEMENT_SEQUENCE_CODEC(SMSG_SPLINE_MOVE_SET_FLIGHT_BACK_SPEED, SplineMoveSetFlightBackSpeed),
+    MOVEMENT_SEQUENCE_CODEC(SMSG_SPLINE_MOVE_SET_PITCH_RATE, SplineMoveSetPitchRate),
+    MOVEMENT_SEQUENCE_CODEC(SMSG_MOVE_SET_WALK_SPEED, MoveSetWalkSpeed),
+    MOVEMENT_SEQUENCE_CODEC(SMSG_MOVE_SET_RUN_SPEED, MoveSetRunSpeed),
+    MOVEMENT_SEQUENCE_CODEC(SMSG_MOVE_SET_RUN_BACK_SPEED, MoveSetRunBackSpeed),
+    MOVEMENT_SEQUENCE_CODEC(SMSG_MOVE_SET_SWIM_SPEED, MoveSetSwimSpeed),
+    MOVEMENT_SEQUENCE_CODEC(SMSG_MOVE_SET_SWIM_BACK_SPEED, MoveSetSwimBackSpeed),
+    MOVEMENT_SEQUENCE_CODEC(SMSG_MOVE_SET_TURN_RATE, MoveSetTurnRate),
+    MOVEMENT_SEQUENCE_CODEC(SMSG_MOVE_SET_FLIGHT_SPEED, MoveSetFlightSpeed),
+    MOVEMENT_SEQUENCE_CODEC(SMSG_MOVE_SET_FLIGHT_BACK_SPEED, MoveSetFlightBackSpeed),
+    MOVEMENT_SEQUENCE_CODEC(SMSG_MOVE_SET_PITCH_RATE, MoveSetPitchRate),
+    MOVEMENT_SEQUENCE_CODEC(SMSG_SPLINE_MOVE_SET_WALK_MODE, SplineMoveSetWalkMode),
+    MOVEMENT_SEQUENCE_CODEC(SMSG_SPLINE_MOVE_SET_RUN_MODE, SplineMoveSetRunMode),
+    MOVEMENT_SEQUENCE_CODEC(SMSG_SPLINE_MOVE_GRAVITY_DISABLE, SplineMoveGravityDisable),
+    MOVEMENT_SEQUENCE_CODEC(SMSG_SPLINE_MOVE_GRAVITY_ENABLE, SplineMoveGravityEnable),
+    MOVEMENT_SEQUENCE_CODEC(SMSG_SPLINE_MOVE_SET_HOVER, SplineMoveSetHover),
+    MOVEMENT_SEQUENCE_CODEC(SMSG_SPLINE_MOVE_UNSET_HOVER, SplineMoveUnsetHover),
+    MOVEMENT_SEQUENCE_CODEC(SMSG_SPLINE_MOVE_START_SWIM, SplineMoveStartSwim),
+    MOVEMENT_SEQUENCE_CODEC(SMSG_SPLINE_MOVE_STOP_SWIM, SplineMoveStopSwim),
+    MOVEMENT_SEQUENCE_CODEC(SMSG_SPLINE_MOVE_SET_FLYING, SplineMoveSetFlying),
+    MOVEMENT_SEQUENCE_CODEC(SMSG_SPLINE_MOVE_UNSET_FLYING, SplineMoveUnsetFlying),
+    MOVEMENT_SEQUENCE_CODEC(SMSG_SPLINE_MOVE_SET_WATER_WALK, SplineMoveSetWaterWalk),
+    MOVEMENT_SEQUENCE_CODEC(SMSG_SPLINE_MOVE_SET_LAND_WALK, SplineMoveSetLandWalk),
+    MOVEMENT_SEQUENCE_CODEC(SMSG_SPLINE_MOVE_SET_FEATHER_FALL, SplineMoveSetFeatherFall),
+    MOVEMENT_SEQUENCE_CODEC(SMSG_SPLINE_MOVE_SET_NORMAL_FALL, SplineMoveSetNormalFall),
+    MOVEMENT_SEQUENCE_CODEC(SMSG_SPLINE_MOVE_ROOT, SplineMoveRoot),
+    MOVEMENT_SEQUENCE_CODEC(SMSG_SPLINE_MOVE_UNROOT, SplineMoveUnroot),
+    MOVEMENT_SEQUENCE_CODEC(SMSG_MOVE_SET_CAN_FLY, MoveSetCanFly),
+    MOVEMENT_SEQUENCE_CODEC(SMSG_MOVE_UNSET_CAN_FLY, MoveUnsetCanFly),
+    MOVEMENT_SEQUENCE_CODEC(SMSG_MOVE_SET_HOVER, MoveSetHover),
+    MOVEMENT_SEQUENCE_CODEC(SMSG_MOVE_UNSET_HOVER, MoveUnsetHover),
+    MOVEMENT_SEQUENCE_CODEC(SMSG_MOVE_GRAVITY_DISABLE, MoveGravityDisable),
+    MOVEMENT_SEQUENCE_CODEC(SMSG_MOVE_GRAVITY_ENABLE, MoveGravityEnable),
+    MOVEMENT_SEQUENCE_CODEC(SMSG_MOVE_WATER_WALK, MoveWaterWalk),
+    MOVEMENT_SEQUENCE_CODEC(SMSG_MOVE_LAND_WALK, MoveLandWalk),
+    MOVEMENT_SEQUENCE_CODEC(SMSG_MOVE_FEATHER_FALL, MoveFeatherFall),
+    MOVEMENT_SEQUENCE_CODEC(SMSG_MOVE_NORMAL_FALL, MoveNormalFall),
+    MOVEMENT_SEQUENCE_CODEC(SMSG_MOVE_ROOT, MoveRoot),
+    MOVEMENT_SEQUENCE_CODEC(SMSG_MOVE_UNROOT, MoveUnroot),
+    MOVEMENT_SEQUENCE_CODEC(CMSG_CHANGE_SEATS_ON_CONTROLLED_VEHICLE, ChangeSeatsOnControlledVehicle),
+    };
+
+#undef MOVEMENT_SEQUENCE_CODEC
+
+    // opcode indexed lookup over MovementSequenceCodecs
+    class MovementSequenceCodecTable
+    {
+    public:
+        MovementSequenceCodecTable()
+        {
+            memset(_codecs, 0, sizeof(_codecs));
+            for (std::size_t i = 0; i < sizeof(MovementSequenceCodecs) / sizeof(MovementSequenceCodecs[0]); ++i)
+                _codecs[MovementSequenceCodecs[i].Opcode] = &MovementSequenceCodecs[i].Codec;
+        }
+
+        Movement::MovementSequenceCodec const* Find(Opcodes opcode) const
+        {
+            return opcode < NUM_OPCODES ? _codecs[opcode] : NULL;
+        }
+
+    private:
+        Movement::MovementSequenceCodec const* _codecs[NUM_OPCODES];
+    };
+
+    MovementSequenceCodecTable const MovementCodecTable;
+}
+
+Movement::MovementSequenceCodec const* Movement::GetMovementSequenceCodec(Opcodes opcode)
+{
+    return MovementCodecTable.Find(opcode);
+}
+
+#ifdef TRINITY_DEBUG
+namespace
+{
+    // the interpreters below are the switch based decoders the codecs were generated from, they are kept
+    // as the reference behaviour and every movement block is decoded and encoded through both in debug builds
+    void ReadMovementSequence(MovementStatusElements const* sequence, ByteBuffer& data, Movement::MovementReadState& state)
+    {
+        MovementInfo* mi = state.Info;
+
+        for (; *sequence != MSEEnd; ++sequence)
+        {
+            MovementStatusElements const& element = *sequence;
+
+            switch (element)
+            {
+                case MSEHasGuidByte0:
+                case MSEHasGuidByte1:
+                case MSEHasGuidByte2:
+                case MSEHasGuidByte3:
+                case MSEHasGuidByte4:
+                case MSEHasGuidByte5:
+                case MSEHasGuidByte6:
+                case MSEHasGuidByte7:
+                {
+                    state.Guid[element - MSEHasGuidByte0] = data.ReadBit();
+                    break;
+                }
+                case MSEHasTransportGuidByte0:
+                case MSEHasTransportGuidByte1:
+                case MSEHasTransportGuidByte2:
+                case MSEHasTransportGuidByte3:
+                case MSEHasTransportGuidByte4:
+                case MSEHasTransportGuidByte5:
+                case MSEHasTransportGuidByte6:
+                case MSEHasTransportGuidByte7:
+                {
+                    if (state.HasTransportData)
+                        state.TransportGuid[element - MSEHasTransportGuidByte0] = data.ReadBit();
+                    break;
+                }
+                case MSEGuidByte0:
+                case MSEGuidByte1:
+                case MSEGuidByte2:
+                case MSEGuidByte3:
+                case MSEGuidByte4:
+                case MSEGuidByte5:
+                case MSEGuidByte6:
+                case MSEGuidByte7:
+                {
+                    data.ReadByteSeq(state.Guid[element - MSEGuidByte0]);
+                    break;
+                }
+                case MSETransportGuidByte0:
+                case MSETransportGuidByte1:
+                case MSETransportGuidByte2:
+                case MSETransportGuidByte3:
+                case MSETransportGuidByte4:
+                case MSETransportGuidByte5:
+                case MSETransportGuidByte6:
+                case MSETransportGuidByte7:
+                {
+                    if (state.HasTransportData)
+                        data.ReadByteSeq(state.TransportGuid[element - MSETransportGuidByte0]);
+                    break;
+                }
+                case MSEHasMovementFlags:
+                {
+                    state.HasMovementFlags = !data.ReadBit();
+                    break;
+                }
+                case MSEHasMovementFlags2:
+                {
+                    state.HasMovementFlags2 = !data.ReadBit();
+                    break;
+                }
+                case MSEHasTimestamp:
+                {
+                    state.HasTimestamp = !data.ReadBit();
+                    break;
+                }
+                case MSEHasOrientation:
+                {
+                    state.HasOrientation = !data.ReadBit();
+                    break;
+                }
+                case MSEHasTransportData:
+                {
+                    state.HasTransportData = data.ReadBit();
+                    break;
+                }
+                case MSEHasTransportTime2:
+                {
+                    if (state.HasTransportData)
+                        state.HasTransportTime2 = data.ReadBit();
+                    break;
+                }
+                case MSEHasTransportTime3:
+                {
+                    if (state.HasTransportData)
+                        state.HasTransportTime3 = data.ReadBit();
+                    break;
+                }
+                case MSEHasPitch:
+                {
+                    state.HasPitch = !data.ReadBit();
+                    break;
+                }
+                case MSEHasFallData:
+                {
+                    state.HasFallData = data.ReadBit();
+                    break;
+                }
+                case MSEHasFallDirection:
+                {
+                    if (state.HasFallData)
+                        state.HasFallDirection = data.ReadBit();
+                    break;
+                }
+                case MSEHasSplineElevation:
+                {
+                    state.HasSplineElevation = !data.ReadBit();
+                    break;
+                }
+                case MSEHasSpline:
+                {
+                    data.ReadBit();
+                    break;
+                }
+                case MSEHasMountDisplayId:
+                {
+                    state.HasMountDisplayId = !data.ReadBit();
+                    break;
+                }
+                case MSEMountDisplayIdWithCheck: // Fallback here
+                {
+                    if (!state.HasMountDisplayId)
+                        break;
+                }
+                case MSEMountDisplayIdWithoutCheck:
+                {
+                    data >> state.MountDisplayId;
+                    state.MountDisplayIdRead = true;
+                    break;
+                }
+                case MSEMovementFlags:
+                {
+                    if (state.HasMovementFlags)
+                        mi->flags = data.ReadBits(30);
+                    break;
+                }
+                case MSEMovementFlags2:
+                {
+                    if (state.HasMovementFlags2)
+                        mi->flags2 = data.ReadBits(13);
+                    break;
+                }
+                case MSETimestamp:
+                {
+                    if (state.HasTimestamp)
+                        data >> mi->time;
+                    break;
+                }
+                case MSEPositionX:
+                {
+                    data >> mi->pos.m_positionX;
+                    break;
+                }
+                case MSEPositionY:
+                {
+                    data >> mi->pos.m_positionY;
+                    break;
+                }
+                case MSEPositionZ:
+                {
+                    data >> mi->pos.m_positionZ;
+                    break;
+                }
+                case MSEOrientation:
+                {
+                    if (state.HasOrientation)
+                        mi->pos.SetOrientation(data.read<float>());
+                    break;
+                }
+                case MSETransportPositionX:
+                {
+                    if (state.HasTransportData)
+                        data >> mi->transport.pos.m_positionX;
+                    break;
+                }
+                case MSETransportPositionY:
+                {
+                    if (state.HasTransportData)
+                        data >> mi->transport.pos.m_positionY;
+                    break;
+                }
+                case MSETransportPositionZ:
+                {
+                    if (state.HasTransportData)
+                        data >> mi->transport.pos.m_positionZ;
+                    break;
+                }
+                case MSETransportOrientation:
+                {
+                    if (state.HasTransportData)
+                        mi->transport.pos.SetOrientation(data.read<float>());
+                    break;
+                }
+                case MSETransportSeat:
+                {
+                    if (state.HasTransportData)
+                        data >> mi->transport.seat;
+                    break;
+                }
+                case MSETransportTime:
+                {
+                    if (state.HasTransportData)
+                        data >> mi->transport.time;
+                    break;
+                }
+                case MSETransportTime2:
+                {
+                    if (state.HasTransportData && state.HasTransportTime2)
+                        data >> mi->transport.time2;
+                    break;
+                }
+                case MSETransportTime3:
+                {
+                    if (state.HasTransportData && state.HasTransportTime3)
+                        data >> mi->transport.time3;
+                    break;
+                }
+                case MSEPitch:
+                {
+                    if (state.HasPitch)
+                        mi->pitch = G3D::wrap(data.read<float>(), float(-M_PI), float(M_PI));
+                    break;
+                }
+                case MSEFallTime:
+                {
+                    if (state.HasFallData)
+                        data >> mi->jump.fallTime;
+                    break;
+                }
+                case MSEFallVerticalSpeed:
+                {
+                    if (state.HasFallData)
+                        data >> mi->jump.zspeed;
+                    break;
+                }
+                case MSEFallCosAngle:
+                {
+                    if (state.HasFallData && state.HasFallDirection)
+                        data >> mi->jump.cosAngle;
+                    break;
+                }
+                case MSEFallSinAngle:
+                {
+                    if (state.HasFallData && state.HasFallDirection)
+                        data >> mi->jump.sinAngle;
+                    break;
+                }
+                case MSEFallHorizontalSpeed:
+                {
+                    if (state.HasFallData && state.HasFallDirection)
+                        data >> mi->jump.xyspeed;
+                    break;
+                }
+                case MSESplineElevation:
+                {
+                    if (state.HasSplineElevation)
+                        data >> mi->splineElevation;
+                    break;
+                }
+                case MSEForcesCount:
+                {
+                    state.ForcesCount = data.ReadBits(22);
+                    break;
+                }
+                case MSEForces:
+                {
+                    for (uint32 i = 0; i < state.ForcesCount; i++)
+                        data.read_skip<uint32>();
+                    break;
+                }
+                case MSEHasCounter:
+                {
+                    state.HasCounter = !data.ReadBit();
+                    break;
+                }
+                case MSECounter:
+                {
+                    if (state.HasCounter)
+                        data.read_skip<uint32>();
+                    break;
+                }
+                case MSECount:
+                {
+                    data.read_skip<uint32>();
+                    break;
+                }
+                case MSEZeroBit:
+                case MSEOneBit:
+                {
+                    data.ReadBit();
+                    break;
+                }
+                case MSEExtraElement:
+                {
+                    state.Extras->ReadNextElement(data);
+                    break;
+                }
+                default:
+                {
+                    ASSERT(Movement::PrintInvalidSequenceElement(element, __FUNCTION__));
+                    break;
+                }
+            }
+        }
+    }
+
+    void WriteMovementSequence(MovementStatusElements const* sequence, ByteBuffer& data, Movement::MovementWriteState& state)
+    {
+        MovementInfo const* mi = state.Info;
+
+        for (; *sequence != MSEEnd; ++sequence)
+        {
+            MovementStatusElements const& element = *sequence;
+
+            switch (element)
+            {
+                case MSEHasGuidByte0:
+                case MSEHasGuidByte1:
+                case MSEHasGuidByte2:
+                case MSEHasGuidByte3:
+                case MSEHasGuidByte4:
+                case MSEHasGuidByte5:
+                case MSEHasGuidByte6:
+                case MSEHasGuidByte7:
+                {
+                    data.WriteBit(state.Guid[element - MSEHasGuidByte0]);
+                    break;
+                }
+                case MSEHasTransportGuidByte0:
+                case MSEHasTransportGuidByte1:
+                case MSEHasTransportGuidByte2:
+                case MSEHasTransportGuidByte3:
+                case MSEHasTransportGuidByte4:
+                case MSEHasTransportGuidByte5:
+                case MSEHasTransportGuidByte6:
+                case MSEHasTransportGuidByte7:
+                {
+                    if (state.HasTransportData)
+                        data.WriteBit(state.TransportGuid[element - MSEHasTransportGuidByte0]);
+                    break;
+                }
+                case MSEGuidByte0:
+                case MSEGuidByte1:
+                case MSEGuidByte2:
+                case MSEGuidByte3:
+                case MSEGuidByte4:
+                case MSEGuidByte5:
+                case MSEGuidByte6:
+                case MSEGuidByte7:
+                {
+                    data.WriteByteSeq(state.Guid[element - MSEGuidByte0]);
+                    break;
+                }
+                case MSETransportGuidByte0:
+                case MSETransportGuidByte1:
+                case MSETransportGuidByte2:
+                case MSETransportGuidByte3:
+                case MSETransportGuidByte4:
+                case MSETransportGuidByte5:
+                case MSETransportGuidByte6:
+                case MSETransportGuidByte7:
+                {
+                    if (state.HasTransportData)
+                        data.WriteByteSeq(state.TransportGuid[element - MSETransportGuidByte0]);
+                    break;
+                }
+                case MSEHasCounter:
+                {
+                    data.WriteBit(!*state.Counter);
+                    break;
+                }
+                case MSEHasMovementFlags:
+                {
+                    data.WriteBit(!state.HasMovementFlags);
+                    break;
+                }
+                case MSEHasMovementFlags2:
+                {
+                    data.WriteBit(!state.HasMovementFlags2);
+                    break;
+                }
+                case MSEHasMountDisplayId:
+                {
+                    data.WriteBit(!state.HasMountDisplayId);
+                    break;
+                }
+                case MSEHasTimestamp:
+                {
+                    data.WriteBit(!state.HasTimestamp);
+                    break;
+                }
+                case MSEHasOrientation:
+                {
+                    data.WriteBit(!state.HasOrientation);
+                    break;
+                }
+                case MSEHasTransportData:
+                {
+                    data.WriteBit(state.HasTransportData);
+                    break;
+                }
+                case MSEHasTransportTime2:
+                {
+                    if (state.HasTransportData)
+                        data.WriteBit(state.HasTransportTime2);
+                    break;
+                }
+                case MSEHasTransportTime3:
+                {
+                    if (state.HasTransportData)
+                        data.WriteBit(state.HasTransportTime3);
+                    break;
+                }
+                case MSEHasPitch:
+                {
+                    data.WriteBit(!state.HasPitch);
+                    break;
+                }
+                case MSEHasFallData:
+                {
+                    data.WriteBit(state.HasFallData);
+                    break;
+                }
+                case MSEHasFallDirection:
+                {
+                    if (state.HasFallData)
+                        data.WriteBit(state.HasFallDirection);
+                    break;
+                }
+                case MSEHasSplineElevation:
+                {
+                    data.WriteBit(!state.HasSplineElevation);
+                    break;
+                }
+                case MSEHasSpline:
+                {
+                    data.WriteBit(state.HasSpline);
+                    break;
+                }
+                case MSEMountDisplayIdWithCheck: // Fallback here
+                {
+                    if (!state.HasMountDisplayId)
+                        break;
+                }
+                case MSEMountDisplayIdWithoutCheck:
+                {
+                    data << state.MountDisplayId;
+                    break;
+                }
+                case MSEMovementFlags:
+                {
+                    if (state.HasMovementFlags)
+                        data.WriteBits(state.MovementFlags, 30);
+                    break;
+                }
+                case MSEMovementFlags2:
+                {
+                    if (state.HasMovementFlags2)
+                        data.WriteBits(state.MovementFlags2, 13);
+                    break;
+                }
+                case MSETimestamp:
+                {
+                    if (state.HasTimestamp)
+                        data << mi->time;
+                    break;
+                }
+                case MSEPositionX:
+                {
+                    data << state.PositionX;
+                    break;
+                }
+                case MSEPositionY:
+                {
+                    data << state.PositionY;
+                    break;
+                }
+                case MSEPositionZ:
+                {
+                    data << state.PositionZ;
+                    break;
+                }
+                case MSEOrientation:
+                {
+                    if (state.HasOrientation)
+                        data << state.Orientation;
+                    break;
+                }
+                case MSETransportPositionX:
+                {
+                    if (state.HasTransportData)
+                        data << mi->transport.pos.GetPositionX();
+                    break;
+                }
+                case MSETransportPositionY:
+                {
+                    if (state.HasTransportData)
+                        data << mi->transport.pos.GetPositionY();
+                    break;
+                }
+                case MSETransportPositionZ:
+                {
+                    if (state.HasTransportData)
+                        data << mi->transport.pos.GetPositionZ();
+                    break;
+                }
+                case MSETransportOrientation:
+                {
+                    if (state.HasTransportData)
+                        data << mi->transport.pos.GetOrientation();
+                    break;
+                }
+                case MSETransportSeat:
+                {
+                    if (state.HasTransportData)
+                        data << mi->transport.seat;
+                    break;
+                }
+                case MSETransportTime:
+                {
+                    if (state.HasTransportData)
+                        data << mi->transport.time;
+                    break;
+                }
+                case MSETransportTime2:
+                {
+                    if (state.HasTransportData && state.HasTransportTime2)
+                        data << mi->transport.time2;
+                    break;
+                }
+                case MSETransportTime3:
+                {
+                    if (state.HasTransportData && state.HasTransportTime3)
+                        data << mi->transport.time3;
+                    break;
+                }
+                case MSEPitch:
+                {
+                    if (state.HasPitch)
+                        data << mi->pitch;
+                    break;
+                }
+                case MSEFallTime:
+                {
+                    if (state.HasFallData)
+                        data << mi->jump.fallTime;
+                    break;
+                }
+                case MSEFallVerticalSpeed:
+                {
+                    if (state.HasFallData)
+                        data << mi->jump.zspeed;
+                    break;
+                }
+                case MSEFallCosAngle:
+                {
+                    if (state.HasFallData && state.HasFallDirection)
+                        data << mi->jump.cosAngle;
+                    break;
+                }
+                case MSEFallSinAngle:
+                {
+                    if (state.HasFallData && state.HasFallDirection)
+                        data << mi->jump.sinAngle;
+                    break;
+                }
+                case MSEFallHorizontalSpeed:
+                {
+                    if (state.HasFallData && state.HasFallDirection)
+                        data << mi->jump.xyspeed;
+                    break;
+                }
+                case MSESplineElevation:
+                {
+                    if (state.HasSplineElevation)
+                        data << mi->splineElevation;
+                    break;
+                }
+                case MSEForcesCount:
+                {
+                    data.WriteBits(0, 22);
+                    break;
+                }
+                case MSECounter:
+                {
+                    if (*state.Counter)
+                        data << *state.Counter;
+                    ++*state.Counter;
+                    break;
+                }
+                case MSECount:
+                {
+                    data << (*state.Counter)++;
+                    break;
+                }
+                case MSEZeroBit:
+                {
+                    data.WriteBit(0);
+                    break;
+                }
+                case MSEOneBit:
+                {
+                    data.WriteBit(1);
+                    break;
+                }
+                case MSEExtraElement:
+                {
+                    state.Extras->WriteNextElement(data);
+                    break;
+                }
+                case MSEUintCount:
+                {
+                    data << uint32(0);
+                    break;
+                }
+                case MSEHasTransportVehicleId:
+                {
+                    data.WriteBit(state.HasTransportVehicleId);
+                    break;
+                }
+                case MSETransportVehicleId:
+                {
+                    if (state.HasTransportVehicleId)
+                        data << mi->transport.time3; // this should be renamed
+                    break;
+                }
+                case MSEForces:
+                    break;
+                case MSEFlushBits:
+                {
+                    data.FlushBits();
+                    break;
+                }
+                default:
+                {
+                    ASSERT(Movement::PrintInvalidSequenceElement(element, __FUNCTION__));
+                    break;
+                }
+            }
+        }
+    }
+
+    bool EqualReadResults(Movement::MovementReadState const& left, Movement::MovementReadState const& right)
+    {
+        MovementInfo const& l = *left.Info;
+        MovementInfo const& r = *right.Info;
+
+        return l.flags == r.flags && l.flags2 == r.flags2 && l.time == r.time
+            && l.pos.GetPositionX() == r.pos.GetPositionX() && l.pos.GetPositionY() == r.pos.GetPositionY()
+            && l.pos.GetPositionZ() == r.pos.GetPositionZ() && l.pos.GetOrientation() == r.pos.GetOrientation()
+            && l.transport.pos.GetPositionX() == r.transport.pos.GetPositionX() && l.transport.pos.GetPositionY() == r.transport.pos.GetPositionY()
+            && l.transport.pos.GetPositionZ() == r.transport.pos.GetPositionZ() && l.transport.pos.GetOrientation() == r.transport.pos.GetOrientation()
+            && l.transport.seat == r.transport.seat && l.transport.time == r.transport.time
+            && l.transport.time2 == r.transport.time2 && l.transport.time3 == r.transport.time3
+            && l.pitch == r.pitch && l.jump.fallTime == r.jump.fallTime && l.jump.zspeed == r.jump.zspeed
+            && l.jump.sinAngle == r.jump.sinAngle && l.jump.cosAngle == r.jump.cosAngle && l.jump.xyspeed == r.jump.xyspeed
+            && l.splineElevation == r.splineElevation
+            && memcmp(&left.Guid, &right.Guid, sizeof(ObjectGuid)) == 0 && memcmp(&left.TransportGuid, &right.TransportGuid, sizeof(ObjectGuid)) == 0
+            && left.MountDisplayId == right.MountDisplayId && left.MountDisplayIdRead == right.MountDisplayIdRead
+            && left.ForcesCount == right.ForcesCount && left.HasCounter == right.HasCounter
+            && (!left.Extras || memcmp(&left.Extras->Data, &right.Extras->Data, sizeof(left.Extras->Data)) == 0);
+    }
+}
+#endif
+
+void Movement::ReadMovementBlock(MovementSequenceCodec const& codec, WorldPacket& data, MovementReadState& state)
+{
+#ifdef TRINITY_DEBUG
+    // decode a copy of the block through the reference interpreter, both have to agree on every field
+    WorldPacket referenceData(data);
+    MovementInfo referenceInfo(*state.Info);
+    ExtraMovementStatusElement referenceExtras(state.Extras ? *state.Extras : ExtraMovementStatusElement(NULL));
+    MovementReadState referenceState(&referenceInfo, state.Extras ? &referenceExtras : NULL);
+#endif
+
+    codec.Read(data, state);
+
+#ifdef TRINITY_DEBUG
+    bool referenceComplete = true;
+    try
+    {
+        ReadMovementSequence(codec.Sequence, referenceData, referenceState);
+    }
+    catch (ByteBufferException const&)
+    {
+        referenceComplete = false;
+    }
+
+    if (!referenceComplete || referenceData.rpos() != data.rpos() || !EqualReadResults(state, referenceState))
+    {
+        SF_LOG_ERROR("network", "Movement codec of %s decodes a block differing from its sequence", GetOpcodeNameForLogging(data.GetOpcode(), false).c_str());
+        ASSERT(false);
+    }
+#endif
+}
+
+void Movement::WriteMovementBlock(MovementSequenceCodec const& codec, WorldPacket& data, MovementWriteState& state)
+{
+#ifdef TRINITY_DEBUG
+    // encode the same block through the reference interpreter, the bytes and the movement counter have to match
+    WorldPacket referenceData(data);
+    uint32 referenceCounter = *state.Counter;
+    ExtraMovementStatusElement referenceExtras(state.Extras ? *state.Extras : ExtraMovementStatusElement(NULL));
+    MovementWriteState referenceState(state);
+    referenceState.Counter = &referenceCounter;
+    referenceState.Extras = state.Extras ? &referenceExtras : NULL;
+#endif
+
+    codec.Write(data, state);
+
+#ifdef TRINITY_DEBUG
+    WriteMovementSequence(codec.Sequence, referenceData, referenceState);
+
+    // pending bits are compared too, the caller may keep writing into the same byte
+    ByteBuffer generatedData(data);
+    generatedData.FlushBits();
+    referenceData.FlushBits();
+
+    if (generatedData.size() != referenceData.size() || referenceCounter != *state.Counter
+        || (generatedData.size() && memcmp(generatedData.contents(), referenceData.contents(), generatedData.size()) != 0))
+    {
+        SF_LOG_ERROR("network", "Movement codec of %s encodes %u bytes differing from its sequence (%u bytes)",
+            GetOpcodeNameForLogging(data.GetOpcode(), true).c_str(), uint32(generatedData.size()), uint32(referenceData.size()));
+        ASSERT(false);
+    }
+#endif
+}
+
+MovementStatusElements const* GetMovementStatusElementsSequence(Opcodes opcode)
+{
+    if (Movement::MovementSequenceCodec const* codec = Movement::GetMovementSequenceCodec(opcode))
+        return codec->Sequence;
+
     return NULL;
-}
\ No newline at end of file
+}
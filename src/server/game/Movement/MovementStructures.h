@@ -11,6 +11,7 @@
 
 class ByteBuffer;
 class Unit;
+class WorldPacket;
 
 enum MovementStatusElements
 {
@@ -157,6 +158,90 @@ namespace Movement
     };
 
     bool PrintInvalidSequenceElement(MovementStatusElements element, char const* function);
+
+    // movement block decoded from a client packet, see Player::ReadMovementInfo
+    struct MovementReadState
+    {
+        MovementReadState(MovementInfo* info, ExtraMovementStatusElement* extras) : Info(info), Extras(extras),
+            ForcesCount(0), MountDisplayId(0), HasMountDisplayId(false), HasMovementFlags(false), HasMovementFlags2(false),
+            HasTimestamp(false), HasOrientation(false), HasTransportData(false), HasTransportTime2(false), HasTransportTime3(false),
+            HasPitch(false), HasFallData(false), HasFallDirection(false), HasSplineElevation(false), HasCounter(false), MountDisplayIdRead(false) { }
+
+        MovementInfo* Info;
+        ExtraMovementStatusElement* Extras;
+        ObjectGuid Guid;
+        ObjectGuid TransportGuid;
+        uint32 ForcesCount;
+        uint32 MountDisplayId;
+        bool HasMountDisplayId;
+        bool HasMovementFlags;
+        bool HasMovementFlags2;
+        bool HasTimestamp;
+        bool HasOrientation;
+        bool HasTransportData;
+        bool HasTransportTime2;
+        bool HasTransportTime3;
+        bool HasPitch;
+        bool HasFallData;
+        bool HasFallDirection;
+        bool HasSplineElevation;
+        bool HasCounter;
+        bool MountDisplayIdRead;
+    };
+
+    // movement block of a unit to be encoded, see Unit::WriteMovementInfo
+    struct MovementWriteState
+    {
+        MovementWriteState(MovementInfo const* info, ExtraMovementStatusElement* extras, uint32* counter) : Info(info), Extras(extras), Counter(counter),
+            PositionX(0.0f), PositionY(0.0f), PositionZ(0.0f), Orientation(0.0f), MountDisplayId(0), MovementFlags(0), MovementFlags2(0),
+            HasMountDisplayId(false), HasMovementFlags(false), HasMovementFlags2(false), HasTimestamp(false), HasOrientation(false),
+            HasTransportData(false), HasTransportTime2(false), HasTransportTime3(false), HasTransportVehicleId(false), HasPitch(false),
+            HasFallData(false), HasFallDirection(false), HasSplineElevation(false), HasSpline(false) { }
+
+        MovementInfo const* Info;
+        ExtraMovementStatusElement* Extras;
+        uint32* Counter;
+        ObjectGuid Guid;
+        ObjectGuid TransportGuid;
+        float PositionX;
+        float PositionY;
+        float PositionZ;
+        float Orientation;
+        uint32 MountDisplayId;
+        uint32 MovementFlags;
+        uint16 MovementFlags2;
+        bool HasMountDisplayId;
+        bool HasMovementFlags;
+        bool HasMovementFlags2;
+        bool HasTimestamp;
+        bool HasOrientation;
+        bool HasTransportData;
+        bool HasTransportTime2;
+        bool HasTransportTime3;
+        bool HasTransportVehicleId;
+        bool HasPitch;
+        bool HasFallData;
+        bool HasFallDirection;
+        bool HasSplineElevation;
+        bool HasSpline;
+    };
+
+    typedef void (*MovementSequenceReader)(ByteBuffer& data, MovementReadState& state);
+    typedef void (*MovementSequenceWriter)(ByteBuffer& data, MovementWriteState& state);
+
+    // encoder and decoder generated at compile time from one of the MovementStructures sequences
+    struct MovementSequenceCodec
+    {
+        MovementStatusElements const* Sequence;
+        MovementSequenceReader Read;
+        MovementSequenceWriter Write;
+    };
+
+    MovementSequenceCodec const* GetMovementSequenceCodec(Opcodes opcode);
+
+    // run the codec of the packet, debug builds also check it against the sequence interpreted element by element
+    void ReadMovementBlock(MovementSequenceCodec const& codec, WorldPacket& data, MovementReadState& state);
+    void WriteMovementBlock(MovementSequenceCodec const& codec, WorldPacket& data, MovementWriteState& state);
 }
 
 MovementStatusElements const* GetMovementStatusElementsSequence(Opcodes opcode);
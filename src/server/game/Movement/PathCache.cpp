@@ -0,0 +1,201 @@
+/*
+* This file is part of Project SkyFire https://www.projectskyfire.org.
+* See LICENSE.md file for Copyright information
+*/
+
+#include "PathCache.h"
+#include "Timer.h"
+
+std::atomic<uint64> PathCache::_hits(0);
+std::atomic<uint64> PathCache::_misses(0);
+
+uint32 PathCache::GetCorridor(dtNavMeshQuery const* query, dtQueryFilter const& filter, dtPolyRef startPoly, dtPolyRef endPoly,
+    dtPolyRef* polys, uint32 maxLength, uint32 lifetime)
+{
+    uint32 now = getMSTime();
+
+    std::pair<CorridorStore::iterator, CorridorStore::iterator> bounds = _corridors.equal_range(endPoly);
+    for (CorridorStore::iterator itr = bounds.first; itr != bounds.second;)
+    {
+        Corridor const& corridor = itr->second;
+        if (getMSTimeDiff(corridor.CreateTime, now) > lifetime)
+        {
+            _corridors.erase(itr++);
+            continue;
+        }
+
+        if (corridor.Query == query && corridor.IncludeFlags == filter.getIncludeFlags() && corridor.ExcludeFlags == filter.getExcludeFlags())
+        {
+            // sub-path of optimal path is optimal
+            for (uint32 i = 0; i < corridor.Length; ++i)
+            {
+                if (corridor.Polys[i] != startPoly)
+                    continue;
+
+                uint32 length = corridor.Length - i;
+                if (length > maxLength)
+                    break;
+
+                memcpy(polys, &corridor.Polys[i], length * sizeof(dtPolyRef));
+                ++_hits;
+                return length;
+            }
+        }
+
+        ++itr;
+    }
+
+    ++_misses;
+    return 0;
+}
+
+void PathCache::AddCorridor(dtNavMeshQuery const* query, dtQueryFilter const& filter, dtPolyRef const* polys, uint32 length, uint32 lifetime)
+{
+    if (!length || length > MAX_PATH_LENGTH)
+        return;
+
+    if (_corridors.size() >= PATH_CACHE_MAX_ENTRIES)
+    {
+        RemoveExpired(lifetime);
+        if (_corridors.size() >= PATH_CACHE_MAX_ENTRIES)
+            return;
+    }
+
+    Corridor& corridor = _corridors.insert(std::make_pair(polys[length - 1], Corridor()))->second;
+    corridor.Query = query;
+    corridor.IncludeFlags = filter.getIncludeFlags();
+    corridor.ExcludeFlags = filter.getExcludeFlags();
+    corridor.CreateTime = getMSTime();
+    corridor.Length = length;
+    memcpy(corridor.Polys, polys, length * sizeof(dtPolyRef));
+}
+
+uint32 PathCache::GetFlowFieldCorridor(dtNavMeshQuery const* query, dtQueryFilter const& filter, dtPolyRef startPoly, dtPolyRef endPoly,
+    float const* endPoint, dtPolyRef* polys, uint32 maxLength)
+{
+    FlowField* field = NULL;
+    FlowFieldStore::iterator itr = _flowFields.find(endPoly);
+    if (itr != _flowFields.end() && IsUsable(itr->second, query, filter, getMSTime()))
+        field = &itr->second;
+
+    // the target moved into another polygon, move the root of its field along instead of searching again
+    if (!field)
+        field = RerootFlowField(query, filter, endPoly);
+
+    if (!field)
+        field = BuildFlowField(query, filter, endPoly, endPoint);
+
+    if (!field)
+        return 0;
+
+    uint32 length = 0;
+    dtPolyRef poly = startPoly;
+    while (poly != INVALID_POLYREF)
+    {
+        UNORDERED_MAP<dtPolyRef, dtPolyRef>::const_iterator parent = field->Parents.find(poly);
+        if (parent == field->Parents.end() || length >= maxLength)
+            return 0;
+
+        polys[length++] = poly;
+        poly = parent->second;
+    }
+
+    return length;
+}
+
+PathCache::FlowField* PathCache::BuildFlowField(dtNavMeshQuery const* query, dtQueryFilter const& filter, dtPolyRef root, float const* rootPoint)
+{
+    if (_flowFields.size() >= FLOW_FIELD_MAX_ENTRIES)
+    {
+        uint32 now = getMSTime();
+        for (FlowFieldStore::iterator itr = _flowFields.begin(); itr != _flowFields.end();)
+        {
+            if (getMSTimeDiff(itr->second.CreateTime, now) > FLOW_FIELD_LIFETIME)
+                _flowFields.erase(itr++);
+            else
+                ++itr;
+        }
+
+        if (_flowFields.size() >= FLOW_FIELD_MAX_ENTRIES && _flowFields.find(root) == _flowFields.end())
+            return NULL;
+    }
+
+    dtPolyRef resultRefs[FLOW_FIELD_MAX_POLYS];
+    dtPolyRef resultParents[FLOW_FIELD_MAX_POLYS];
+    int resultCount = 0;
+    if (dtStatusFailed(query->findPolysAroundCircle(root, rootPoint, FLOW_FIELD_RADIUS, &filter, resultRefs, resultParents, NULL, &resultCount, FLOW_FIELD_MAX_POLYS)) || !resultCount)
+        return NULL;
+
+    FlowField& field = _flowFields[root];
+    field.Query = query;
+    field.IncludeFlags = filter.getIncludeFlags();
+    field.ExcludeFlags = filter.getExcludeFlags();
+    field.CreateTime = getMSTime();
+    field.Rerooted = 0;
+    field.Parents.clear();
+    for (int i = 0; i < resultCount; ++i)
+        field.Parents[resultRefs[i]] = resultParents[i];
+
+    return &field;
+}
+
+PathCache::FlowField* PathCache::RerootFlowField(dtNavMeshQuery const* query, dtQueryFilter const& filter, dtPolyRef root)
+{
+    uint32 now = getMSTime();
+    for (FlowFieldStore::iterator itr = _flowFields.begin(); itr != _flowFields.end(); ++itr)
+    {
+        FlowField& field = itr->second;
+        if (!IsUsable(field, query, filter, now) || field.Parents.find(root) == field.Parents.end())
+            continue;
+
+        // the branch from the new root to the old one, it is reversed so the old root leads to the new one
+        dtPolyRef chain[FLOW_FIELD_MAX_REROOT + 1];
+        uint32 length = 0;
+        dtPolyRef poly = root;
+        while (poly != INVALID_POLYREF && length <= FLOW_FIELD_MAX_REROOT - field.Rerooted)
+        {
+            chain[length++] = poly;
+            poly = field.Parents.find(poly)->second;
+        }
+
+        // too far from where the field was searched, its radius would no longer cover the chasers
+        if (poly != INVALID_POLYREF)
+            continue;
+
+        // every polygon keeps its way to the old root and continues along the reversed branch, so a corridor
+        // is at most twice the branch longer than the shortest one
+        for (uint32 i = length - 1; i > 0; --i)
+            field.Parents[chain[i]] = chain[i - 1];
+        field.Parents[root] = INVALID_POLYREF;
+
+        FlowField& moved = _flowFields[root];
+        moved.Query = field.Query;
+        moved.IncludeFlags = field.IncludeFlags;
+        moved.ExcludeFlags = field.ExcludeFlags;
+        moved.CreateTime = field.CreateTime;
+        moved.Rerooted = field.Rerooted + length - 1;
+        moved.Parents.swap(field.Parents);
+        _flowFields.erase(itr);
+        return &moved;
+    }
+
+    return NULL;
+}
+
+bool PathCache::IsUsable(FlowField const& field, dtNavMeshQuery const* query, dtQueryFilter const& filter, uint32 now)
+{
+    return field.Query == query && field.IncludeFlags == filter.getIncludeFlags() && field.ExcludeFlags == filter.getExcludeFlags() &&
+        getMSTimeDiff(field.CreateTime, now) <= FLOW_FIELD_LIFETIME;
+}
+
+void PathCache::RemoveExpired(uint32 lifetime)
+{
+    uint32 now = getMSTime();
+    for (CorridorStore::iterator itr = _corridors.begin(); itr != _corridors.end();)
+    {
+        if (getMSTimeDiff(itr->second.CreateTime, now) > lifetime)
+            _corridors.erase(itr++);
+        else
+            ++itr;
+    }
+}
@@ -0,0 +1,82 @@
+/*
+* This file is part of Project SkyFire https://www.projectskyfire.org.
+* See LICENSE.md file for Copyright information
+*/
+
+#ifndef SF_PATH_CACHE_H
+#define SF_PATH_CACHE_H
+
+#include "PathGenerator.h"
+
+#include <atomic>
+#include <map>
+
+#define PATH_CACHE_MAX_ENTRIES  512
+
+#define FLOW_FIELD_RADIUS       80.0f
+#define FLOW_FIELD_MAX_POLYS    1024    // node pool size of the mmap queries
+#define FLOW_FIELD_LIFETIME     5000
+#define FLOW_FIELD_MAX_ENTRIES  32
+#define FLOW_FIELD_MAX_REROOT   4       // polygons a field may follow its moving target before it is rebuilt
+
+// Recently built poly-paths of one map, keyed by their end polygon.
+// Units chasing the same target mostly end in the same polygon, a unit standing on the
+// corridor of another chaser can take the remaining part of that corridor instead of running findPath.
+// Only used from the thread updating the owning map.
+class PathCache
+{
+public:
+    PathCache() { }
+
+    // fills polys with the cached corridor from startPoly to endPoly, returns its length or 0 when nothing usable is cached
+    uint32 GetCorridor(dtNavMeshQuery const* query, dtQueryFilter const& filter, dtPolyRef startPoly, dtPolyRef endPoly,
+        dtPolyRef* polys, uint32 maxLength, uint32 lifetime);
+    void AddCorridor(dtNavMeshQuery const* query, dtQueryFilter const& filter, dtPolyRef const* polys, uint32 length, uint32 lifetime);
+
+    // follows the flow field around endPoly from startPoly, the field is built by one Dijkstra search
+    // around the target polygon and shared by all units chasing into it, when the target steps into
+    // a neighbouring polygon the field is re-rooted there instead of searched again
+    uint32 GetFlowFieldCorridor(dtNavMeshQuery const* query, dtQueryFilter const& filter, dtPolyRef startPoly, dtPolyRef endPoly,
+        float const* endPoint, dtPolyRef* polys, uint32 maxLength);
+
+    static uint64 GetHits() { return _hits; }
+    static uint64 GetMisses() { return _misses; }
+
+private:
+    struct Corridor
+    {
+        dtNavMeshQuery const* Query;
+        unsigned short IncludeFlags;
+        unsigned short ExcludeFlags;
+        uint32 CreateTime;
+        uint32 Length;
+        dtPolyRef Polys[MAX_PATH_LENGTH];
+    };
+
+    typedef std::multimap<dtPolyRef, Corridor> CorridorStore;
+
+    struct FlowField
+    {
+        dtNavMeshQuery const* Query;
+        unsigned short IncludeFlags;
+        unsigned short ExcludeFlags;
+        uint32 CreateTime;
+        uint32 Rerooted;                                // polygons the root moved since the field was built
+        UNORDERED_MAP<dtPolyRef, dtPolyRef> Parents;    // next polygon towards the root, INVALID_POLYREF at the root
+    };
+
+    typedef std::map<dtPolyRef, FlowField> FlowFieldStore;
+
+    void RemoveExpired(uint32 lifetime);
+    FlowField* BuildFlowField(dtNavMeshQuery const* query, dtQueryFilter const& filter, dtPolyRef root, float const* rootPoint);
+    FlowField* RerootFlowField(dtNavMeshQuery const* query, dtQueryFilter const& filter, dtPolyRef root);
+    static bool IsUsable(FlowField const& field, dtNavMeshQuery const* query, dtQueryFilter const& filter, uint32 now);
+
+    CorridorStore _corridors;
+    FlowFieldStore _flowFields;
+
+    static std::atomic<uint64> _hits;
+    static std::atomic<uint64> _misses;
+};
+
+#endif
@@ -8,7 +8,9 @@
 #include "Map.h"
 #include "MMapFactory.h"
 #include "MMapManager.h"
+#include "PathCache.h"
 #include "PathGenerator.h"
+#include "World.h"
 
 #include "DetourCommon.h"
 #include "DetourNavMeshQuery.h"
@@ -16,7 +18,7 @@
 ////////////////// PathGenerator //////////////////
 PathGenerator::PathGenerator(const Unit* owner) :
     _polyLength(0), _type(PATHFIND_BLANK), _useStraightPath(false),
-    _forceDestination(false), _pointPathLimit(MAX_POINT_PATH_LENGTH),
+    _forceDestination(false), _useFlowField(false), _pointPathLimit(MAX_POINT_PATH_LENGTH),
     _endPosition(G3D::Vector3::zero()), _sourceUnit(owner), _navMesh(NULL),
     _navMeshQuery(NULL)
 {
@@ -283,7 +285,7 @@ void PathGenerator::BuildPolyPath(G3D::Vector3 const& startPos, G3D::Vector3 con
         _polyLength = pathEndIndex - pathStartIndex + 1;
         memmove(_pathPolyRefs, _pathPolyRefs + pathStartIndex, _polyLength * sizeof(dtPolyRef));
     }
-    else if (startPolyFound && !endPolyFound)
+    else if (startPolyFound && !endPolyFound && !_useFlowField)
     {
         SF_LOG_DEBUG("maps", "++ BuildPolyPath :: (startPolyFound && !endPolyFound)\n");
 
@@ -357,23 +359,39 @@ void PathGenerator::BuildPolyPath(G3D::Vector3 const& startPos, G3D::Vector3 con
         // free and invalidate old path data
         Clear();
 
-        dtStatus dtResult = _navMeshQuery->findPath(
-            startPoly,          // start polygon
-            endPoly,            // end polygon
-            startPoint,         // start position
-            endPoint,           // end position
-            &_filter,           // polygon search filter
-            _pathPolyRefs,     // [out] path
-            (int*)&_polyLength,
-            MAX_PATH_LENGTH);   // max number of polygons in output path
+        // other units heading to the same polygon may have built a corridor we are standing on
+        uint32 cacheLifetime = sWorld->getIntConfig(WorldIntConfigs::CONFIG_PATH_CACHE_LIFETIME);
+        PathCache* pathCache = _sourceUnit->FindMap() ? _sourceUnit->FindMap()->GetPathCache() : NULL;
+        if (pathCache && _useFlowField)
+            _polyLength = pathCache->GetFlowFieldCorridor(_navMeshQuery, _filter, startPoly, endPoly, endPoint, _pathPolyRefs, MAX_PATH_LENGTH);
 
-        if (!_polyLength || dtStatusFailed(dtResult))
+        if (!_polyLength && pathCache && cacheLifetime)
+            _polyLength = pathCache->GetCorridor(_navMeshQuery, _filter, startPoly, endPoly, _pathPolyRefs, MAX_PATH_LENGTH, cacheLifetime);
+
+        if (!_polyLength)
         {
-            // only happens if we passed bad data to findPath(), or navmesh is messed up
-            SF_LOG_ERROR("maps", "%u's Path Build failed: 0 length path", _sourceUnit->GetGUIDLow());
-            BuildShortcut();
-            _type = PATHFIND_NOPATH;
-            return;
+            dtStatus dtResult = _navMeshQuery->findPath(
+                startPoly,          // start polygon
+                endPoly,            // end polygon
+                startPoint,         // start position
+                endPoint,           // end position
+                &_filter,           // polygon search filter
+                _pathPolyRefs,     // [out] path
+                (int*)&_polyLength,
+                MAX_PATH_LENGTH);   // max number of polygons in output path
+
+            if (!_polyLength || dtStatusFailed(dtResult))
+            {
+                // only happens if we passed bad data to findPath(), or navmesh is messed up
+                SF_LOG_ERROR("maps", "%u's Path Build failed: 0 length path", _sourceUnit->GetGUIDLow());
+                BuildShortcut();
+                _type = PATHFIND_NOPATH;
+                return;
+            }
+
+            // only complete corridors can be handed to other units
+            if (pathCache && cacheLifetime && _pathPolyRefs[_polyLength - 1] == endPoly)
+                pathCache->AddCorridor(_navMeshQuery, _filter, _pathPolyRefs, _polyLength, cacheLifetime);
         }
     }
 
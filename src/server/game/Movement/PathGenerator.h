@@ -48,6 +48,7 @@ public:
 
     // option setters - use optional
     void SetUseStraightPath(bool useStraightPath) { _useStraightPath = useStraightPath; }
+    void SetUseFlowField(bool useFlowField) { _useFlowField = useFlowField; }
     void SetPathLengthLimit(float distance) { _pointPathLimit = std::min<uint32>(uint32(distance / SMOOTH_PATH_STEP_SIZE), MAX_POINT_PATH_LENGTH); }
 
     // result getters
@@ -68,6 +69,7 @@ private:
 
     bool _useStraightPath;  // type of path will be generated
     bool _forceDestination; // when set, we will always arrive at given point
+    bool _useFlowField;     // take the poly-path from the map's flow field around the destination
     uint32 _pointPathLimit; // limit point path size; min(this, MAX_POINT_PATH_LENGTH)
 
     G3D::Vector3 _startPosition;        // {x, y, z} of current location
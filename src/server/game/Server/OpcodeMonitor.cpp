@@ -0,0 +1,149 @@
+/*
+* This file is part of Project SkyFire https://www.projectskyfire.org.
+* See LICENSE.md file for Copyright information
+*/
+
+#include "OpcodeMonitor.h"
+#include "Config.h"
+#include "Log.h"
+#include "Opcodes.h"
+#include "Util.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+
+namespace
+{
+    struct OpcodeCostTimeOrder
+    {
+        bool operator()(std::pair<uint16, OpcodeCost> const& left, std::pair<uint16, OpcodeCost> const& right) const
+        {
+            return left.second.TotalTime > right.second.TotalTime;
+        }
+    };
+}
+
+OpcodeMonitor::OpcodeMonitor()
+{
+    _costs = new SharedOpcodeCost[NUM_OPCODES];
+    Reset();
+}
+
+OpcodeMonitor::~OpcodeMonitor()
+{
+    delete[] _costs;
+}
+
+void OpcodeMonitor::LoadRateLimits()
+{
+    _rateLimits.assign(NUM_OPCODES, OpcodeRateLimit());
+
+    // "CMSG_WHO:1:5 CMSG_AUCTION_LIST_ITEMS:2" - name:packets per second[:burst]
+    std::string config = sConfigMgr->GetStringDefault("PacketRateLimit.Opcodes", "");
+    Tokenizer entries(config, ' ');
+    uint32 count = 0;
+    for (Tokenizer::const_iterator itr = entries.begin(); itr != entries.end(); ++itr)
+    {
+        if (!**itr)
+            continue;
+
+        Tokenizer fields(*itr, ':');
+        uint32 opcode = NUM_OPCODES;
+        for (uint32 i = 0; i < NUM_OPCODES; ++i)
+        {
+            if (clientOpcodeTable[i] && strcmp(clientOpcodeTable[i]->Name, fields[0]) == 0)
+            {
+                opcode = i;
+                break;
+            }
+        }
+
+        if (opcode == NUM_OPCODES || fields.size() < 2 || !atoi(fields[1]))
+        {
+            SF_LOG_ERROR("server.loading", "PacketRateLimit.Opcodes: entry '%s' is not a known client opcode with a rate, skipped", *itr);
+            continue;
+        }
+
+        OpcodeRateLimit& limit = _rateLimits[opcode];
+        limit.PerSecond = uint32(atoi(fields[1]));
+        limit.Burst = fields.size() > 2 ? uint32(atoi(fields[2])) : 0;
+        if (limit.Burst < 1)
+            limit.Burst = limit.PerSecond;
+
+        ++count;
+    }
+
+    SF_LOG_INFO("server.loading", ">> Loaded %u client opcode rate limits", count);
+}
+
+void OpcodeMonitor::AddHandled(uint16 opcode, uint32 bytes, uint32 us)
+{
+    if (opcode >= NUM_OPCODES)
+        return;
+
+    SharedOpcodeCost& cost = _costs[opcode];
+    cost.Count.fetch_add(1, std::memory_order_relaxed);
+    cost.TotalTime.fetch_add(us, std::memory_order_relaxed);
+    cost.Bytes.fetch_add(bytes, std::memory_order_relaxed);
+
+    uint32 max = cost.MaxTime.load(std::memory_order_relaxed);
+    while (us > max && !cost.MaxTime.compare_exchange_weak(max, us, std::memory_order_relaxed))
+        ;
+}
+
+void OpcodeMonitor::AddThrottled(uint16 opcode)
+{
+    if (opcode < NUM_OPCODES)
+        _costs[opcode].Throttled.fetch_add(1, std::memory_order_relaxed);
+}
+
+void OpcodeMonitor::GetCosts(OpcodeCostList& costs) const
+{
+    for (uint32 i = 0; i < NUM_OPCODES; ++i)
+    {
+        SharedOpcodeCost const& shared = _costs[i];
+        if (!shared.Count.load(std::memory_order_relaxed) && !shared.Throttled.load(std::memory_order_relaxed))
+            continue;
+
+        OpcodeCost cost;
+        cost.Count = shared.Count.load(std::memory_order_relaxed);
+        cost.TotalTime = shared.TotalTime.load(std::memory_order_relaxed);
+        cost.MaxTime = shared.MaxTime.load(std::memory_order_relaxed);
+        cost.Bytes = shared.Bytes.load(std::memory_order_relaxed);
+        cost.Throttled = shared.Throttled.load(std::memory_order_relaxed);
+        costs.push_back(std::make_pair(uint16(i), cost));
+    }
+}
+
+void OpcodeMonitor::Reset()
+{
+    for (uint32 i = 0; i < NUM_OPCODES; ++i)
+    {
+        _costs[i].Count.store(0, std::memory_order_relaxed);
+        _costs[i].TotalTime.store(0, std::memory_order_relaxed);
+        _costs[i].MaxTime.store(0, std::memory_order_relaxed);
+        _costs[i].Bytes.store(0, std::memory_order_relaxed);
+        _costs[i].Throttled.store(0, std::memory_order_relaxed);
+    }
+}
+
+void OpcodeMonitor::BuildReport(OpcodeCostList& costs, uint32 count, std::vector<std::string>& lines)
+{
+    std::sort(costs.begin(), costs.end(), OpcodeCostTimeOrder());
+    if (costs.size() > count)
+        costs.erase(costs.begin() + count, costs.end());
+
+    lines.push_back("opcode                                     count  total ms  avg us   max ms      KB  throttled");
+    for (OpcodeCostList::const_iterator itr = costs.begin(); itr != costs.end(); ++itr)
+    {
+        OpcodeCost const& cost = itr->second;
+        OpcodeHandler const* handler = clientOpcodeTable[itr->first];
+
+        char line[256];
+        snprintf(line, sizeof(line), "%-40s %8u %9.1f %7u %8.2f %7u %10u", handler ? handler->Name : "unknown", cost.Count,
+            double(cost.TotalTime) / 1000.0, cost.Count ? uint32(cost.TotalTime / cost.Count) : 0, double(cost.MaxTime) / 1000.0,
+            uint32(cost.Bytes / 1024), cost.Throttled);
+        lines.push_back(line);
+    }
+}
@@ -0,0 +1,96 @@
+/*
+* This file is part of Project SkyFire https://www.projectskyfire.org.
+* See LICENSE.md file for Copyright information
+*/
+
+#ifndef SKYFIRE_OPCODEMONITOR_H
+#define SKYFIRE_OPCODEMONITOR_H
+
+#include "Define.h"
+
+#include <ace/Null_Mutex.h>
+#include <ace/Singleton.h>
+#include <atomic>
+#include <string>
+#include <vector>
+
+/// Handler cost of one client opcode, times in microseconds
+struct OpcodeCost
+{
+    OpcodeCost() : Count(0), TotalTime(0), MaxTime(0), Bytes(0), Throttled(0) { }
+
+    void Add(uint32 bytes, uint32 us)
+    {
+        ++Count;
+        TotalTime += us;
+        if (us > MaxTime)
+            MaxTime = us;
+        Bytes += bytes;
+    }
+
+    uint32 Count;
+    uint64 TotalTime;
+    uint32 MaxTime;
+    uint64 Bytes;
+    uint32 Throttled;                                       // packets dropped by the rate limit
+};
+
+typedef std::vector<std::pair<uint16, OpcodeCost> > OpcodeCostList;
+
+/// Allowed packets per second of one opcode and the number that may be sent at once
+struct OpcodeRateLimit
+{
+    OpcodeRateLimit() : PerSecond(0), Burst(0) { }
+
+    uint32 PerSecond;
+    uint32 Burst;
+};
+
+/// Server wide handler cost of every client opcode and the per opcode rate limits of
+/// PacketRateLimit.Opcodes. The costs are added from the world and the map threads,
+/// every counter is atomic. Each session keeps its own costs and token buckets next to these.
+class OpcodeMonitor
+{
+    friend class ACE_Singleton<OpcodeMonitor, ACE_Null_Mutex>;
+
+public:
+    /// Needs the client opcode table, called again on config reload
+    void LoadRateLimits();
+
+    OpcodeRateLimit const* GetRateLimit(uint16 opcode) const
+    {
+        if (opcode >= _rateLimits.size() || !_rateLimits[opcode].PerSecond)
+            return NULL;
+
+        return &_rateLimits[opcode];
+    }
+
+    void AddHandled(uint16 opcode, uint32 bytes, uint32 us);
+    void AddThrottled(uint16 opcode);
+
+    void GetCosts(OpcodeCostList& costs) const;
+    void Reset();
+
+    /// Table of the count opcodes with the highest total handler time
+    static void BuildReport(OpcodeCostList& costs, uint32 count, std::vector<std::string>& lines);
+
+private:
+    OpcodeMonitor();
+    ~OpcodeMonitor();
+
+    struct SharedOpcodeCost
+    {
+        std::atomic<uint32> Count;
+        std::atomic<uint64> TotalTime;
+        std::atomic<uint32> MaxTime;
+        std::atomic<uint64> Bytes;
+        std::atomic<uint32> Throttled;
+    };
+
+    SharedOpcodeCost* _costs;                               // NUM_OPCODES entries
+    std::vector<OpcodeRateLimit> _rateLimits;
+};
+
+#define sOpcodeMonitor ACE_Singleton<OpcodeMonitor, ACE_Null_Mutex>::instance()
+
+#endif
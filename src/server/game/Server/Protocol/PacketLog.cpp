@@ -5,16 +5,29 @@
 
 #include "ByteBuffer.h"
 #include "Config.h"
+#include "Log.h"
 #include "PacketLog.h"
+#include "Util.h"
 #include "WorldPacket.h"
 
-PacketLog::PacketLog() : _file(NULL)
+PacketLog::PacketLog() : _enabled(false), _file(NULL), _fileIndex(0), _fileSize(0), _flushInterval(1000), _maxBufferSize(0), _maxFileSize(0),
+    _stopping(false), _droppedPackets(0)
 {
     Initialize();
 }
 
 PacketLog::~PacketLog()
 {
+    if (_enabled)
+    {
+        {
+            std::lock_guard<std::mutex> lock(_bufferLock);
+            _stopping = true;
+        }
+        _bufferCondition.notify_one();
+        wait();
+    }
+
     if (_file)
         fclose(_file);
 
@@ -30,23 +43,143 @@ void PacketLog::Initialize()
             logsDir.push_back('/');
 
     std::string logname = sConfigMgr->GetStringDefault("PacketLogFile", "");
-    if (!logname.empty())
-        _file = fopen((logsDir + logname).c_str(), "wb");
+    if (logname.empty())
+        return;
+
+    _fileName = logsDir + logname;
+    _flushInterval = std::max(sConfigMgr->GetIntDefault("PacketLog.FlushInterval", 1000), 10);
+    _maxBufferSize = uint32(std::max(sConfigMgr->GetIntDefault("PacketLog.MaxBufferSize", 16), 1)) * 1024 * 1024;
+    _maxFileSize = uint64(std::max(sConfigMgr->GetIntDefault("PacketLog.MaxFileSize", 0), 0)) * 1024 * 1024;
+
+    Tokenizer opcodes(sConfigMgr->GetStringDefault("PacketLog.Opcodes", ""), ',');
+    for (Tokenizer::const_iterator itr = opcodes.begin(); itr != opcodes.end(); ++itr)
+        _opcodeFilter.insert(uint32(strtoul(*itr, NULL, 0)));
+
+    Tokenizer accounts(sConfigMgr->GetStringDefault("PacketLog.Accounts", ""), ',');
+    for (Tokenizer::const_iterator itr = accounts.begin(); itr != accounts.end(); ++itr)
+        _accountFilter.insert(uint32(strtoul(*itr, NULL, 10)));
+
+    OpenFile();
+    if (_file)
+        _enabled = ACE_Task_Base::activate(THR_NEW_LWP | THR_JOINABLE | THR_INHERIT_SCHED, 1) == 0;
 }
 
-void PacketLog::LogPacket(WorldPacket const& packet, Direction direction)
+void PacketLog::OpenFile()
 {
-    ByteBuffer data(4 + 4 + 4 + 1 + packet.size());
+    std::string name = _fileName;
+    if (_fileIndex)
+    {
+        // keep the .bin extension at the end, WowPacketParser needs it
+        std::ostringstream suffix;
+        suffix << '.' << _fileIndex;
+        size_t extPos = name.find_last_of('.');
+        size_t dirPos = name.find_last_of("/\\");
+        if (extPos != std::string::npos && (dirPos == std::string::npos || extPos > dirPos))
+            name.insert(extPos, suffix.str());
+        else
+            name += suffix.str();
+    }
+
+    _file = fopen(name.c_str(), "wb");
+    _fileSize = 0;
+}
+
+void PacketLog::LogPacket(WorldPacket const& packet, Direction direction, uint32 accountId)
+{
+    if (!_accountFilter.empty() && _accountFilter.find(accountId) == _accountFilter.end())
+        return;
+
     uint32 opcode = direction == CLIENT_TO_SERVER ? const_cast<WorldPacket&>(packet).GetReceivedOpcode() : serverOpcodeTable[packet.GetOpcode()]->OpcodeNumber;
+    if (!_opcodeFilter.empty() && _opcodeFilter.find(opcode) == _opcodeFilter.end())
+        return;
+
+    uint32 size = packet.size();
+    uint32 now = uint32(time(NULL));
+    EndianConvert(opcode);
+    EndianConvert(size);
+    EndianConvert(now);
 
-    data << int32(opcode);
-    data << int32(packet.size());
-    data << uint32(time(NULL));
-    data << uint8(direction);
+    uint8 header[4 + 4 + 4 + 1];
+    memcpy(&header[0], &opcode, 4);
+    memcpy(&header[4], &size, 4);
+    memcpy(&header[8], &now, 4);
+    header[12] = uint8(direction);
 
-    for (uint32 i = 0; i < packet.size(); i++)
-        data << packet[i];
+    bool wakeWriter = false;
+    {
+        std::lock_guard<std::mutex> lock(_bufferLock);
+        size_t oldSize = _buffer.size();
+        if (oldSize + sizeof(header) + packet.size() > _maxBufferSize)
+        {
+            ++_droppedPackets;
+            return;
+        }
 
-    fwrite(data.contents(), 1, data.size(), _file);
+        _buffer.insert(_buffer.end(), header, header + sizeof(header));
+        if (!packet.empty())
+            _buffer.insert(_buffer.end(), packet.contents(), packet.contents() + packet.size());
+
+        // wake up the writer early once half of the buffer is used
+        wakeWriter = oldSize < _maxBufferSize / 2 && _buffer.size() >= _maxBufferSize / 2;
+    }
+
+    if (wakeWriter)
+        _bufferCondition.notify_one();
+}
+
+void PacketLog::WriteBuffer(std::vector<uint8> const& buffer)
+{
+    if (_maxFileSize && _fileSize && _fileSize + buffer.size() > _maxFileSize)
+    {
+        fclose(_file);
+        ++_fileIndex;
+        OpenFile();
+    }
+
+    if (!_file)
+        return;
+
+    fwrite(&buffer[0], 1, buffer.size(), _file);
     fflush(_file);
+    _fileSize += buffer.size();
+}
+
+int PacketLog::svc()
+{
+    // both buffers grow on demand, _maxBufferSize only caps them
+    std::vector<uint8> writeBuffer;
+
+    uint64 reportedDrops = 0;
+    bool stopping = false;
+    while (!stopping)
+    {
+        {
+            std::unique_lock<std::mutex> lock(_bufferLock);
+            if (!_stopping)
+                _bufferCondition.wait_for(lock, std::chrono::milliseconds(_flushInterval));
+
+            _buffer.swap(writeBuffer);
+            stopping = _stopping;
+        }
+
+        if (!writeBuffer.empty())
+        {
+            WriteBuffer(writeBuffer);
+
+            // give back memory left over from a burst, it is swapped in as the next producer buffer
+            if (writeBuffer.size() < writeBuffer.capacity() / 4)
+                std::vector<uint8>().swap(writeBuffer);
+            else
+                writeBuffer.clear();
+        }
+
+        uint64 dropped = _droppedPackets;
+        if (dropped != reportedDrops)
+        {
+            SF_LOG_WARN("network", "PacketLog: buffer full, " UI64FMTD " packets dropped so far", dropped);
+            reportedDrops = dropped;
+        }
+    }
+
+    return 0;
 }
@@ -7,6 +7,11 @@
 
 #include "Common.h"
 #include <ace/Singleton.h>
+#include <ace/Task.h>
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <set>
 
 enum Direction
 {
@@ -16,7 +21,9 @@ enum Direction
 
 class WorldPacket;
 
-class PacketLog
+/// Binary packet dump in WowPacketParser format.
+/// Socket threads only copy the packet into a shared buffer, a background thread does the file I/O.
+class PacketLog : protected ACE_Task_Base
 {
     friend class ACE_Singleton<PacketLog, ACE_Thread_Mutex>;
 
@@ -26,11 +33,33 @@ private:
 
 public:
     void Initialize();
-    bool CanLogPacket() const { return (_file != NULL); }
-    void LogPacket(WorldPacket const& packet, Direction direction);
+    bool CanLogPacket() const { return _enabled; }
+    void LogPacket(WorldPacket const& packet, Direction direction, uint32 accountId);
 
 private:
-    FILE* _file;
+    virtual int svc();
+
+    void WriteBuffer(std::vector<uint8> const& buffer);
+    void OpenFile();
+
+    bool _enabled;
+    FILE* _file;                                        // only touched by svc() once the writer runs
+    std::string _fileName;
+    uint32 _fileIndex;
+    uint64 _fileSize;
+
+    std::set<uint32> _opcodeFilter;                     // wire opcode numbers, empty means all
+    std::set<uint32> _accountFilter;                    // empty means all
+
+    uint32 _flushInterval;
+    uint32 _maxBufferSize;
+    uint64 _maxFileSize;
+
+    std::mutex _bufferLock;
+    std::condition_variable _bufferCondition;
+    std::vector<uint8> _buffer;                         // filled by socket threads, swapped out by svc()
+    bool _stopping;
+    std::atomic<uint64> _droppedPackets;
 };
 
 #define sPacketLog ACE_Singleton<PacketLog, ACE_Thread_Mutex>::instance()
@@ -16,15 +16,15 @@ class WorldPacket : public ByteBuffer
 {
 public:
     // just container for later use
-    WorldPacket() : ByteBuffer(0), m_opcode(UNKNOWN_OPCODE), m_rcvdOpcodeNumber(0), _compressionStream(NULL)
+    WorldPacket() : ByteBuffer(0), m_opcode(UNKNOWN_OPCODE), m_rcvdOpcodeNumber(0), m_rateLimitEvaluated(false), _compressionStream(NULL)
     {
     }
 
-    WorldPacket(Opcodes opcode, size_t res = 200) : ByteBuffer(res), m_opcode(opcode), m_rcvdOpcodeNumber(0), _compressionStream(NULL)
+    WorldPacket(Opcodes opcode, size_t res = 200) : ByteBuffer(res), m_opcode(opcode), m_rcvdOpcodeNumber(0), m_rateLimitEvaluated(false), _compressionStream(NULL)
     {
     }
     // copy constructor
-    WorldPacket(WorldPacket const& packet) : ByteBuffer(packet), m_opcode(packet.m_opcode), m_rcvdOpcodeNumber(0), _compressionStream(NULL)
+    WorldPacket(WorldPacket const& packet) : ByteBuffer(packet), m_opcode(packet.m_opcode), m_rcvdOpcodeNumber(0), m_rateLimitEvaluated(false), _compressionStream(NULL)
     {
     }
 
@@ -41,10 +41,14 @@ public:
     void Compress(z_stream_s* compressionStream, WorldPacket const* source);
     void SetReceivedOpcode(uint16 opcode) { m_rcvdOpcodeNumber = opcode; }
     uint16 GetReceivedOpcode() { return m_rcvdOpcodeNumber; }
+    // received packets are charged against the opcode rate limit once, even when re-enqueued
+    void SetRateLimitEvaluated() { m_rateLimitEvaluated = true; }
+    bool IsRateLimitEvaluated() const { return m_rateLimitEvaluated; }
 
 protected:
     Opcodes m_opcode;
     uint16 m_rcvdOpcodeNumber;
+    bool m_rateLimitEvaluated;
     void Compress(void* dst, uint32* dst_size, const void* src, int src_size);
     z_stream_s* _compressionStream;
 };
@@ -25,6 +25,7 @@
 #include "Player.h"
 #include "ScriptMgr.h"
 #include "SocialMgr.h"
+#include "TickProfiler.h"
 #include "Transport.h"
 #include "Vehicle.h"
 #include "WardenMac.h"
@@ -312,6 +313,8 @@ bool WorldSession::Update(uint32 diff, PacketFilter& updater)
     //! and continue updating others. The re-enqueued packets will be handled in the next Update call for this session.
     uint32 processedPackets = 0;
 
+#define MAX_PROCESSED_PACKETS_IN_SAME_WORLDSESSION_UPDATE 100
+
     while (m_Socket && !m_Socket->IsClosed() &&
         !_recvQueue.empty() && _recvQueue.peek(true) != firstDelayedPacket &&
         _recvQueue.next(packet, updater))
@@ -319,7 +322,22 @@ bool WorldSession::Update(uint32 diff, PacketFilter& updater)
         if (!AntiDOS.EvaluateOpcode(*packet))
             KickPlayer();
 
+        if (!packet->IsRateLimitEvaluated())
+        {
+            packet->SetRateLimitEvaluated();
+            if (!AntiDOS.EvaluateRateLimit(*packet))
+            {
+                delete packet;
+
+                //! dropped packets count toward the per update cap too, a flood must not keep the loop going
+                if (++processedPackets > MAX_PROCESSED_PACKETS_IN_SAME_WORLDSESSION_UPDATE)
+                    break;
+                continue;
+            }
+        }
+
         OpcodeHandler const* opHandle = clientOpcodeTable[packet->GetOpcode()];
+        TickProfiler::Clock::time_point handlerStart = TickProfiler::Clock::now();
         try
         {
             switch (opHandle->Status)
@@ -410,11 +428,21 @@ bool WorldSession::Update(uint32 diff, PacketFilter& updater)
         }
 
         if (deletePacket)
+        {
+            uint32 handlerTime = uint32(std::chrono::duration_cast<std::chrono::microseconds>(TickProfiler::Clock::now() - handlerStart).count());
+            uint16 opcode = uint16(packet->GetOpcode());
+            uint32 size = uint32(packet->size());
+
+            _opcodeCosts[opcode].Add(size, handlerTime);
+            sOpcodeMonitor->AddHandled(opcode, size, handlerTime);
+            if (sTickProfiler->IsEnabled())
+                sTickProfiler->Record(TICK_SECTION_OPCODE, opcode, 0, handlerTime);
+
             delete packet;
+        }
 
         deletePacket = true;
 
-#define MAX_PROCESSED_PACKETS_IN_SAME_WORLDSESSION_UPDATE 100
         processedPackets++;
 
         //process only a max amout of packets in 1 Update() call.
@@ -426,7 +454,10 @@ bool WorldSession::Update(uint32 diff, PacketFilter& updater)
     if (m_Socket && !m_Socket->IsClosed() && _warden)
         _warden->Update();
 
-    ProcessQueryCallbacks();
+    {
+        TickProfileScope profile(TICK_SECTION_QUERY_CALLBACKS);
+        ProcessQueryCallbacks();
+    }
 
     //check if we are safe to proceed with logout
     //logout procedure should happen only in World::UpdateSessions() method!!!
@@ -1257,6 +1288,47 @@ void WorldSession::InvalidateRBACData()
     _RBACData = NULL;
 }
 
+bool WorldSession::DosProtection::EvaluateRateLimit(WorldPacket& p)
+{
+    uint16 opcode = uint16(p.GetOpcode());
+    OpcodeRateLimit const* limit = sOpcodeMonitor->GetRateLimit(opcode);
+    if (!limit)
+        return true;
+
+    uint32 now = getMSTime();
+    TokenBucketMap::iterator itr = _rateLimitBuckets.find(opcode);
+    if (itr == _rateLimitBuckets.end())
+        itr = _rateLimitBuckets.insert(TokenBucketMap::value_type(opcode, TokenBucket(limit->Burst * 1000, now))).first;
+
+    // PerSecond tokens per second are PerSecond thousandths of a token per millisecond
+    TokenBucket& bucket = itr->second;
+    uint64 tokens = bucket.Tokens + uint64(getMSTimeDiff(bucket.LastRefill, now)) * limit->PerSecond;
+    bucket.Tokens = uint32(std::min<uint64>(tokens, limit->Burst * 1000));
+    bucket.LastRefill = now;
+
+    if (bucket.Tokens >= 1000)
+    {
+        bucket.Tokens -= 1000;
+        bucket.Throttling = false;
+        return true;
+    }
+
+    Session->_opcodeCosts[opcode].Throttled++;
+    sOpcodeMonitor->AddThrottled(opcode);
+
+    if (!bucket.Throttling)
+    {
+        bucket.Throttling = true;
+        SF_LOG_INFO("network", "PacketRateLimit: Account %u, IP: %s, exceeded %u packets per second of %s, dropping packets",
+            Session->GetAccountId(), Session->GetRemoteAddress().c_str(), limit->PerSecond, GetOpcodeNameForLogging(p.GetOpcode(), false).c_str());
+
+        if (sWorld->GetBoolConfig(WorldBoolConfigs::CONFIG_PACKET_RATE_LIMIT_KICK))
+            Session->KickPlayer();
+    }
+
+    return false;
+}
+
 bool WorldSession::DosProtection::EvaluateOpcode(WorldPacket& p) const
 {
     if (IsOpcodeAllowed(p.GetOpcode()))
@@ -17,6 +17,7 @@
 #include "Common.h"
 #include "DatabaseEnv.h"
 #include "Object.h"
+#include "OpcodeMonitor.h"
 #include "Opcodes.h"
 #include "SharedDefines.h"
 #include "World.h"
@@ -500,6 +501,10 @@ public:
 
     uint32 GetLatency() const { return m_latency; }
     void SetLatency(uint32 latency) { m_latency = latency; }
+
+    /// Handler cost of the packets of this session per opcode, updated by whichever thread updates the session
+    typedef UNORDERED_MAP<uint16, OpcodeCost> OpcodeCostMap;
+    OpcodeCostMap const& GetOpcodeCosts() const { return _opcodeCosts; }
     void ResetClientTimeDelay() { m_clientTimeDelay = 0; }
     uint32 getDialogStatus(Player* player, Object* questgiver, uint32 defstatus);
 
@@ -1115,6 +1120,8 @@ protected:
     public:
         DosProtection(WorldSession* s) : Session(s), _policy((Policy)sWorld->getIntConfig(WorldIntConfigs::CONFIG_PACKET_SPOOF_POLICY)) { }
         bool EvaluateOpcode(WorldPacket& p) const;
+        /// false if the packet exceeds the PacketRateLimit.Opcodes limit of its opcode and has to be dropped
+        bool EvaluateRateLimit(WorldPacket& p);
         void AllowOpcode(uint16 opcode, bool allow) { _isOpcodeAllowed[opcode] = allow; }
     protected:
         enum Policy
@@ -1140,6 +1147,18 @@ protected:
         OpcodeStatusMap _isOpcodeAllowed; // could be bool array, but wouldn't be practical for game versions with non-linear opcodes
         Policy _policy;
 
+        struct TokenBucket
+        {
+            TokenBucket(uint32 tokens, uint32 now) : Tokens(tokens), LastRefill(now), Throttling(false) { }
+
+            uint32 Tokens;                                  // 1000 per packet
+            uint32 LastRefill;
+            bool Throttling;                                // dropping packets since the last one that was allowed
+        };
+
+        typedef UNORDERED_MAP<uint16, TokenBucket> TokenBucketMap;
+        TokenBucketMap _rateLimitBuckets;
+
         DosProtection(DosProtection const& right) = delete;
         DosProtection& operator=(DosProtection const& right) = delete;
     } AntiDOS;
@@ -1200,6 +1219,7 @@ private:
     ACE_Based::LockedQueue<WorldPacket*, ACE_Thread_Mutex> _recvQueue;
     time_t timeLastWhoCommand;
     z_stream_s* _compressionStream;
+    OpcodeCostMap _opcodeCosts;
     rbac::RBACData* _RBACData;
     WorldSession(WorldSession const& right) = delete;
     WorldSession& operator=(WorldSession const& right) = delete;
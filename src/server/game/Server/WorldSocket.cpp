@@ -148,7 +148,7 @@ int WorldSocket::SendPacket(WorldPacket const& pct)
 
     // Dump outgoing packet
     if (sPacketLog->CanLogPacket())
-        sPacketLog->LogPacket(pct, SERVER_TO_CLIENT);
+        sPacketLog->LogPacket(pct, SERVER_TO_CLIENT, m_Session ? m_Session->GetAccountId() : 0);
 
     WorldPacket const* pkt = &pct;
 
@@ -755,7 +755,7 @@ int WorldSocket::ProcessIncoming(WorldPacket* new_pct)
 
     // Dump received packet.
     if (sPacketLog->CanLogPacket())
-        sPacketLog->LogPacket(*new_pct, CLIENT_TO_SERVER);
+        sPacketLog->LogPacket(*new_pct, CLIENT_TO_SERVER, m_Session ? m_Session->GetAccountId() : 0);
 
     std::string opcodeName = GetOpcodeNameForLogging(opcode, false);
     if (m_Session)
@@ -14,7 +14,7 @@ class Aura;
 
 typedef void(AuraEffect::* pAuraEffectHandler)(AuraApplication const* aurApp, uint8 mode, bool apply) const;
 
-class AuraEffect
+class AuraEffect : public PooledObject<AuraEffect>
 {
     friend void Aura::_InitEffects(uint32 effMask, Unit* caster, int32* baseAmount);
     friend Aura* Unit::_TryStackingOrRefreshingExistingAura(SpellInfo const* newAura, uint32 effMask, Unit* caster, int32* baseAmount, Item* castItem, uint64 casterGUID);
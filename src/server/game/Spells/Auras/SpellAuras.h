@@ -6,6 +6,7 @@
 #ifndef SKYFIRE_SPELLAURAS_H
 #define SKYFIRE_SPELLAURAS_H
 
+#include "ObjectPool.h"
 #include "SpellAuraDefines.h"
 #include "SpellInfo.h"
 #include "Unit.h"
@@ -25,7 +26,7 @@ class ProcInfo;
 // update aura target map every 500 ms instead of every update - reduce amount of grid searcher calls
 #define UPDATE_TARGET_MAP_INTERVAL 500
 
-class AuraApplication
+class AuraApplication : public PooledObject<AuraApplication>
 {
     friend void Unit::_ApplyAura(AuraApplication* aurApp, uint32 effMask);
     friend void Unit::_UnapplyAura(AuraApplicationMap::iterator& i, AuraRemoveMode removeMode);
@@ -254,7 +255,7 @@ private:
     Unit::AuraApplicationList m_removedApplications;
 };
 
-class UnitAura : public Aura
+class UnitAura : public Aura, public PooledObject<UnitAura>
 {
     friend Aura* Aura::Create(SpellInfo const* spellproto, uint32 effMask, WorldObject* owner, Unit* caster, int32* baseAmount, Item* castItem, uint64 casterGUID);
 protected:
@@ -275,7 +276,7 @@ private:
     DiminishingGroup m_AuraDRGroup : 8;               // Diminishing
 };
 
-class DynObjAura : public Aura
+class DynObjAura : public Aura, public PooledObject<DynObjAura>
 {
     friend Aura* Aura::Create(SpellInfo const* spellproto, uint32 effMask, WorldObject* owner, Unit* caster, int32* baseAmount, Item* castItem, uint64 casterGUID);
 protected:
@@ -47,6 +47,98 @@
 
 extern pEffect SpellEffects[TOTAL_SPELL_EFFECTS];
 
+#define MAX_CACHED_TARGET_SEARCH_BUFFERS    8
+#define MAX_CACHED_TARGET_SEARCH_CAPACITY   1024
+
+namespace
+{
+    /// Grid searches of the target selection are filled into buffers of a per thread cache, the
+    /// storage is reused by the next cast instead of allocated per search. Script hooks may cast
+    /// other spells while a buffer is in use, so every search takes a buffer of its own.
+    class TargetSearchBuffer
+    {
+    public:
+        TargetSearchBuffer()
+        {
+            std::vector<std::vector<WorldObject*>*>& buffers = GetCache().Buffers;
+            if (buffers.empty())
+                _targets = new std::vector<WorldObject*>();
+            else
+            {
+                _targets = buffers.back();
+                buffers.pop_back();
+            }
+        }
+
+        ~TargetSearchBuffer()
+        {
+            std::vector<std::vector<WorldObject*>*>& buffers = GetCache().Buffers;
+            if (buffers.size() < MAX_CACHED_TARGET_SEARCH_BUFFERS && _targets->capacity() <= MAX_CACHED_TARGET_SEARCH_CAPACITY)
+            {
+                _targets->clear();
+                buffers.push_back(_targets);
+            }
+            else
+                delete _targets;
+        }
+
+        std::vector<WorldObject*>& operator*() { return *_targets; }
+
+    private:
+        TargetSearchBuffer(TargetSearchBuffer const&);
+        TargetSearchBuffer& operator=(TargetSearchBuffer const&);
+
+        struct BufferCache
+        {
+            ~BufferCache()
+            {
+                for (std::vector<std::vector<WorldObject*>*>::iterator itr = Buffers.begin(); itr != Buffers.end(); ++itr)
+                    delete *itr;
+            }
+
+            std::vector<std::vector<WorldObject*>*> Buffers;
+        };
+
+        static BufferCache& GetCache()
+        {
+            static thread_local BufferCache cache;
+            return cache;
+        }
+
+        std::vector<WorldObject*>* _targets;
+    };
+
+    struct NotInRaidWith
+    {
+        explicit NotInRaidWith(Unit const* unit) : _unit(unit) { }
+
+        bool operator()(Unit const* target) const { return !target->IsInRaidWith(_unit); }
+
+    private:
+        Unit const* _unit;
+    };
+
+    struct NotInFrontOf
+    {
+        explicit NotInFrontOf(Unit const* unit) : _unit(unit) { }
+
+        bool operator()(WorldObject const* target) const { return !_unit->HasInArc(static_cast<float>(M_PI), target); }
+
+    private:
+        Unit const* _unit;
+    };
+
+    struct PowerTypeMismatch
+    {
+        explicit PowerTypeMismatch(Powers power) : _power(power) { }
+
+        bool operator()(Unit const* target) const { return target->getPowerType() != _power; }
+
+    private:
+        Powers _power;
+    };
+}
+
 SpellDestination::SpellDestination()
 {
     _position.Relocate(0, 0, 0, 0);
@@ -759,7 +851,7 @@ void Spell::SelectSpellTargets()
         if (m_spellInfo->IsChanneled())
         {
             uint8 mask = (1 << i);
-            for (std::list<TargetInfo>::iterator ihit = m_UniqueTargetInfo.begin(); ihit != m_UniqueTargetInfo.end(); ++ihit)
+            for (TargetInfoContainer::iterator ihit = m_UniqueTargetInfo.begin(); ihit != m_UniqueTargetInfo.end(); ++ihit)
             {
                 if (ihit->effectMask & mask)
                 {
@@ -771,7 +863,7 @@ void Spell::SelectSpellTargets()
         else if (m_auraScaleMask)
         {
             bool checkLvl = !m_UniqueTargetInfo.empty();
-            for (std::list<TargetInfo>::iterator ihit = m_UniqueTargetInfo.begin(); ihit != m_UniqueTargetInfo.end();)
+            for (TargetInfoContainer::iterator ihit = m_UniqueTargetInfo.begin(); ihit != m_UniqueTargetInfo.end();)
             {
                 // remove targets which did not pass min level check
                 if (m_auraScaleMask && ihit->effectMask == m_auraScaleMask)
@@ -779,7 +871,7 @@ void Spell::SelectSpellTargets()
                     // Do not check for selfcast
                     if (!ihit->scaleAura && ihit->targetGUID != m_caster->GetGUID())
                     {
-                        m_UniqueTargetInfo.erase(ihit++);
+                        ihit = m_UniqueTargetInfo.erase(ihit);
                         continue;
                     }
                 }
@@ -1061,7 +1153,8 @@ void Spell::SelectImplicitConeTargets(SpellEffIndex effIndex, SpellImplicitTarge
         ASSERT(false && "Spell::SelectImplicitConeTargets: received not implemented target reference type");
         return;
     }
-    std::list<WorldObject*> targets;
+    TargetSearchBuffer targetBuffer;
+    std::vector<WorldObject*>& targets = *targetBuffer;
     SpellTargetObjectTypes objectType = targetType.GetObjectType();
     SpellTargetCheckTypes selectionType = targetType.GetCheckType();
     ConditionList* condList = m_spellInfo->Effects[effIndex].ImplicitTargetConditions;
@@ -1071,8 +1164,8 @@ void Spell::SelectImplicitConeTargets(SpellEffIndex effIndex, SpellImplicitTarge
     if (uint32 containerTypeMask = GetSearcherTypeMask(objectType, condList))
     {
         Skyfire::WorldObjectSpellConeTargetCheck check(coneAngle, radius, m_caster, m_spellInfo, selectionType, condList);
-        Skyfire::WorldObjectListSearcher<Skyfire::WorldObjectSpellConeTargetCheck> searcher(m_caster, targets, check, containerTypeMask);
-        SearchTargets<Skyfire::WorldObjectListSearcher<Skyfire::WorldObjectSpellConeTargetCheck> >(searcher, containerTypeMask, m_caster, m_caster, radius);
+        Skyfire::WorldObjectListSearcher<Skyfire::WorldObjectSpellConeTargetCheck, std::vector<WorldObject*> > searcher(m_caster, targets, check, containerTypeMask);
+        SearchTargets<Skyfire::WorldObjectListSearcher<Skyfire::WorldObjectSpellConeTargetCheck, std::vector<WorldObject*> > >(searcher, containerTypeMask, m_caster, m_caster, radius);
 
         CallScriptObjectAreaTargetSelectHandlers(targets, effIndex);
 
@@ -1080,26 +1173,17 @@ void Spell::SelectImplicitConeTargets(SpellEffIndex effIndex, SpellImplicitTarge
         {
             // Other special target selection goes here
             if (uint32 maxTargets = m_spellValue->MaxAffectedTargets)
-                Skyfire::Containers::RandomResizeList(targets, maxTargets);
+                Skyfire::Containers::RandomResize(targets, maxTargets);
 
-            // for compability with older code - add only unit and go targets
+            // for compability with older code - add only unit and go targets, units first
             /// @todo remove this
-            std::list<Unit*> unitTargets;
-            std::list<GameObject*> gObjTargets;
-
-            for (std::list<WorldObject*>::iterator itr = targets.begin(); itr != targets.end(); ++itr)
-            {
+            for (std::vector<WorldObject*>::iterator itr = targets.begin(); itr != targets.end(); ++itr)
                 if (Unit* unitTarget = (*itr)->ToUnit())
-                    unitTargets.push_back(unitTarget);
-                else if (GameObject* gObjTarget = (*itr)->ToGameObject())
-                    gObjTargets.push_back(gObjTarget);
-            }
+                    AddUnitTarget(unitTarget, effMask, false);
 
-            for (std::list<Unit*>::iterator itr = unitTargets.begin(); itr != unitTargets.end(); ++itr)
-                AddUnitTarget(*itr, effMask, false);
-
-            for (std::list<GameObject*>::iterator itr = gObjTargets.begin(); itr != gObjTargets.end(); ++itr)
-                AddGOTarget(*itr, effMask);
+            for (std::vector<WorldObject*>::iterator itr = targets.begin(); itr != targets.end(); ++itr)
+                if (GameObject* gObjTarget = (*itr)->ToGameObject())
+                    AddGOTarget(gObjTarget, effMask);
         }
     }
 }
@@ -1120,7 +1204,7 @@ void Spell::SelectImplicitAreaTargets(SpellEffIndex effIndex, SpellImplicitTarge
         case TARGET_REFERENCE_TYPE_LAST:
         {
             // find last added target for this effect
-            for (std::list<TargetInfo>::reverse_iterator ihit = m_UniqueTargetInfo.rbegin(); ihit != m_UniqueTargetInfo.rend(); ++ihit)
+            for (TargetInfoContainer::reverse_iterator ihit = m_UniqueTargetInfo.rbegin(); ihit != m_UniqueTargetInfo.rend(); ++ihit)
             {
                 if (ihit->effectMask & (1 << effIndex))
                 {
@@ -1155,7 +1239,8 @@ void Spell::SelectImplicitAreaTargets(SpellEffIndex effIndex, SpellImplicitTarge
             ASSERT(false && "Spell::SelectImplicitAreaTargets: received not implemented target reference type");
             return;
     }
-    std::list<WorldObject*> targets;
+    TargetSearchBuffer targetBuffer;
+    std::vector<WorldObject*>& targets = *targetBuffer;
     float radius = m_spellInfo->Effects[effIndex].CalcRadius(m_caster) * m_spellValue->RadiusMod;
     SearchAreaTargets(targets, radius, center, referer, targetType.GetObjectType(), targetType.GetCheckType(), m_spellInfo->Effects[effIndex].ImplicitTargetConditions);
 
@@ -1167,7 +1252,7 @@ void Spell::SelectImplicitAreaTargets(SpellEffIndex effIndex, SpellImplicitTarge
         {
             if (Player* playerCaster = m_caster->ToPlayer())
             {
-                for (std::list<WorldObject*>::iterator itr = targets.begin(); itr != targets.end(); ++itr)
+                for (std::vector<WorldObject*>::iterator itr = targets.begin(); itr != targets.end(); ++itr)
                 {
                     switch ((*itr)->GetTypeId())
                     {
@@ -1206,7 +1291,7 @@ void Spell::SelectImplicitAreaTargets(SpellEffIndex effIndex, SpellImplicitTarge
                 // remove existing targets
                 CleanupTargetList();
 
-                for (std::list<WorldObject*>::iterator itr = targets.begin(); itr != targets.end(); ++itr)
+                for (std::vector<WorldObject*>::iterator itr = targets.begin(); itr != targets.end(); ++itr)
                 {
                     switch ((*itr)->GetTypeId())
                     {
@@ -1232,11 +1317,12 @@ void Spell::SelectImplicitAreaTargets(SpellEffIndex effIndex, SpellImplicitTarge
 
     CallScriptObjectAreaTargetSelectHandlers(targets, effIndex);
 
-    std::list<Unit*> unitTargets;
-    std::list<GameObject*> gObjTargets;
+    std::vector<Unit*> unitTargets;
+    std::vector<GameObject*> gObjTargets;
+    unitTargets.reserve(targets.size());
     // for compability with older code - add only unit and go targets
     /// @todo remove this
-    for (std::list<WorldObject*>::iterator itr = targets.begin(); itr != targets.end(); ++itr)
+    for (std::vector<WorldObject*>::iterator itr = targets.begin(); itr != targets.end(); ++itr)
     {
         if (Unit* unitTarget = (*itr)->ToUnit())
             unitTargets.push_back(unitTarget);
@@ -1299,13 +1385,7 @@ void Spell::SelectImplicitAreaTargets(SpellEffIndex effIndex, SpellImplicitTarge
                     break;
 
                 // Remove targets outside caster's raid
-                for (std::list<Unit*>::iterator itr = unitTargets.begin(); itr != unitTargets.end();)
-                {
-                    if (!(*itr)->IsInRaidWith(m_caster))
-                        itr = unitTargets.erase(itr);
-                    else
-                        ++itr;
-                }
+                unitTargets.erase(std::remove_if(unitTargets.begin(), unitTargets.end(), NotInRaidWith(m_caster)), unitTargets.end());
                 break;
             case SPELLFAMILY_DRUID:
                 if (m_spellInfo->SpellFamilyFlags[1] == 0x04000000) // Wild Growth
@@ -1317,11 +1397,7 @@ void Spell::SelectImplicitAreaTargets(SpellEffIndex effIndex, SpellImplicitTarge
                     break;
 
                 // Remove targets outside caster's raid
-                for (std::list<Unit*>::iterator itr = unitTargets.begin(); itr != unitTargets.end();)
-                    if (!(*itr)->IsInRaidWith(m_caster))
-                        itr = unitTargets.erase(itr);
-                    else
-                        ++itr;
+                unitTargets.erase(std::remove_if(unitTargets.begin(), unitTargets.end(), NotInRaidWith(m_caster)), unitTargets.end());
                 break;
             default:
                 break;
@@ -1331,23 +1407,20 @@ void Spell::SelectImplicitAreaTargets(SpellEffIndex effIndex, SpellImplicitTarge
         {
             if (Powers(power) == POWER_HEALTH)
             {
+                // only the maxSize lowest are needed, their order does not matter
                 if (unitTargets.size() > maxSize)
                 {
-                    unitTargets.sort(Skyfire::HealthPctOrderPred());
+                    std::nth_element(unitTargets.begin(), unitTargets.begin() + maxSize, unitTargets.end(), Skyfire::HealthPctOrderPred());
                     unitTargets.resize(maxSize);
                 }
             }
             else
             {
-                for (std::list<Unit*>::iterator itr = unitTargets.begin(); itr != unitTargets.end();)
-                    if ((*itr)->getPowerType() != (Powers)power)
-                        itr = unitTargets.erase(itr);
-                    else
-                        ++itr;
+                unitTargets.erase(std::remove_if(unitTargets.begin(), unitTargets.end(), PowerTypeMismatch((Powers)power)), unitTargets.end());
 
                 if (unitTargets.size() > maxSize)
                 {
-                    unitTargets.sort(Skyfire::PowerPctOrderPred((Powers)power));
+                    std::nth_element(unitTargets.begin(), unitTargets.begin() + maxSize, unitTargets.end(), Skyfire::PowerPctOrderPred((Powers)power));
                     unitTargets.resize(maxSize);
                 }
             }
@@ -1355,18 +1428,18 @@ void Spell::SelectImplicitAreaTargets(SpellEffIndex effIndex, SpellImplicitTarge
 
         // Other special target selection goes here
         if (uint32 maxTargets = m_spellValue->MaxAffectedTargets)
-            Skyfire::Containers::RandomResizeList(unitTargets, maxTargets);
+            Skyfire::Containers::RandomResize(unitTargets, maxTargets);
 
-        for (std::list<Unit*>::iterator itr = unitTargets.begin(); itr != unitTargets.end(); ++itr)
+        for (std::vector<Unit*>::iterator itr = unitTargets.begin(); itr != unitTargets.end(); ++itr)
             AddUnitTarget(*itr, effMask, false);
     }
 
     if (!gObjTargets.empty())
     {
         if (uint32 maxTargets = m_spellValue->MaxAffectedTargets)
-            Skyfire::Containers::RandomResizeList(gObjTargets, maxTargets);
+            Skyfire::Containers::RandomResize(gObjTargets, maxTargets);
 
-        for (std::list<GameObject*>::iterator itr = gObjTargets.begin(); itr != gObjTargets.end(); ++itr)
+        for (std::vector<GameObject*>::iterator itr = gObjTargets.begin(); itr != gObjTargets.end(); ++itr)
             AddGOTarget(*itr, effMask);
     }
 }
@@ -1595,7 +1668,8 @@ void Spell::SelectImplicitChainTargets(SpellEffIndex effIndex, SpellImplicitTarg
                 m_damageMultipliers[k] = 1.0f;
         m_applyMultiplierMask |= effMask;
 
-        std::list<WorldObject*> targets;
+        TargetSearchBuffer targetBuffer;
+        std::vector<WorldObject*>& targets = *targetBuffer;
         SearchChainTargets(targets, maxTargets - 1, target, targetType.GetObjectType(), targetType.GetCheckType(),
             m_spellInfo->Effects[effIndex].ImplicitTargetConditions, targetType.GetTarget() == TARGET_UNIT_TARGET_CHAINHEAL_ALLY);
 
@@ -1603,13 +1677,9 @@ void Spell::SelectImplicitChainTargets(SpellEffIndex effIndex, SpellImplicitTarg
         CallScriptObjectAreaTargetSelectHandlers(targets, effIndex);
 
         // for backward compability
-        std::list<Unit*> unitTargets;
-        for (std::list<WorldObject*>::iterator itr = targets.begin(); itr != targets.end(); ++itr)
+        for (std::vector<WorldObject*>::iterator itr = targets.begin(); itr != targets.end(); ++itr)
             if (Unit* unitTarget = (*itr)->ToUnit())
-                unitTargets.push_back(unitTarget);
-
-        for (std::list<Unit*>::iterator itr = unitTargets.begin(); itr != unitTargets.end(); ++itr)
-            AddUnitTarget(*itr, effMask, false);
+                AddUnitTarget(unitTarget, effMask, false);
     }
 }
 
@@ -1638,14 +1708,15 @@ void Spell::SelectImplicitTrajTargets()
 
     float srcToDestDelta = m_targets.GetDstPos()->m_positionZ - m_targets.GetSrcPos()->m_positionZ;
 
-    std::list<WorldObject*> targets;
+    TargetSearchBuffer targetBuffer;
+    std::vector<WorldObject*>& targets = *targetBuffer;
     Skyfire::WorldObjectSpellTrajTargetCheck check(dist2d, m_targets.GetSrcPos(), m_caster, m_spellInfo);
-    Skyfire::WorldObjectListSearcher<Skyfire::WorldObjectSpellTrajTargetCheck> searcher(m_caster, targets, check, GRID_MAP_TYPE_MASK_ALL);
-    SearchTargets<Skyfire::WorldObjectListSearcher<Skyfire::WorldObjectSpellTrajTargetCheck> >(searcher, GRID_MAP_TYPE_MASK_ALL, m_caster, m_targets.GetSrcPos(), dist2d);
+    Skyfire::WorldObjectListSearcher<Skyfire::WorldObjectSpellTrajTargetCheck, std::vector<WorldObject*> > searcher(m_caster, targets, check, GRID_MAP_TYPE_MASK_ALL);
+    SearchTargets<Skyfire::WorldObjectListSearcher<Skyfire::WorldObjectSpellTrajTargetCheck, std::vector<WorldObject*> > >(searcher, GRID_MAP_TYPE_MASK_ALL, m_caster, m_targets.GetSrcPos(), dist2d);
     if (targets.empty())
         return;
 
-    targets.sort(Skyfire::ObjectDistanceOrderPred(m_caster));
+    std::sort(targets.begin(), targets.end(), Skyfire::ObjectDistanceOrderPred(m_caster));
 
     float b = tangent(m_targets.GetElevation());
     float a = (srcToDestDelta - dist2d * b) / (dist2d * dist2d);
@@ -1655,7 +1726,7 @@ void Spell::SelectImplicitTrajTargets()
 
         float bestDist = m_spellInfo->GetMaxRange(false);
 
-    std::list<WorldObject*>::const_iterator itr = targets.begin();
+    std::vector<WorldObject*>::const_iterator itr = targets.begin();
     for (; itr != targets.end(); ++itr)
     {
         if (Unit* unitTarget = (*itr)->ToUnit())
@@ -1926,17 +1997,17 @@ WorldObject* Spell::SearchNearbyTarget(float range, SpellTargetObjectTypes objec
     return target;
 }
 
-void Spell::SearchAreaTargets(std::list<WorldObject*>& targets, float range, Position const* position, Unit* referer, SpellTargetObjectTypes objectType, SpellTargetCheckTypes selectionType, ConditionList* condList)
+void Spell::SearchAreaTargets(std::vector<WorldObject*>& targets, float range, Position const* position, Unit* referer, SpellTargetObjectTypes objectType, SpellTargetCheckTypes selectionType, ConditionList* condList)
 {
     uint32 containerTypeMask = GetSearcherTypeMask(objectType, condList);
     if (!containerTypeMask)
         return;
     Skyfire::WorldObjectSpellAreaTargetCheck check(range, position, m_caster, referer, m_spellInfo, selectionType, condList);
-    Skyfire::WorldObjectListSearcher<Skyfire::WorldObjectSpellAreaTargetCheck> searcher(m_caster, targets, check, containerTypeMask);
-    SearchTargets<Skyfire::WorldObjectListSearcher<Skyfire::WorldObjectSpellAreaTargetCheck> >(searcher, containerTypeMask, m_caster, position, range);
+    Skyfire::WorldObjectListSearcher<Skyfire::WorldObjectSpellAreaTargetCheck, std::vector<WorldObject*> > searcher(m_caster, targets, check, containerTypeMask);
+    SearchTargets<Skyfire::WorldObjectListSearcher<Skyfire::WorldObjectSpellAreaTargetCheck, std::vector<WorldObject*> > >(searcher, containerTypeMask, m_caster, position, range);
 }
 
-void Spell::SearchChainTargets(std::list<WorldObject*>& targets, uint32 chainTargets, WorldObject* target, SpellTargetObjectTypes objectType, SpellTargetCheckTypes selectType, ConditionList* condList, bool isChainHeal)
+void Spell::SearchChainTargets(std::vector<WorldObject*>& targets, uint32 chainTargets, WorldObject* target, SpellTargetObjectTypes objectType, SpellTargetCheckTypes selectType, ConditionList* condList, bool isChainHeal)
 {
     // max dist for jump target selection
     float jumpRadius = 0.0f;
@@ -1971,31 +2042,25 @@ void Spell::SearchChainTargets(std::list<WorldObject*>& targets, uint32 chainTar
     if (isBouncingFar)
         searchRadius *= chainTargets;
 
-    std::list<WorldObject*> tempTargets;
+    TargetSearchBuffer tempBuffer;
+    std::vector<WorldObject*>& tempTargets = *tempBuffer;
     SearchAreaTargets(tempTargets, searchRadius, target, m_caster, objectType, selectType, condList);
-    tempTargets.remove(target);
+    tempTargets.erase(std::remove(tempTargets.begin(), tempTargets.end(), target), tempTargets.end());
 
     // remove targets which are always invalid for chain spells
     // for some spells allow only chain targets in front of caster (swipe for example)
     if (!isBouncingFar)
-    {
-        for (std::list<WorldObject*>::iterator itr = tempTargets.begin(); itr != tempTargets.end();)
-        {
-            std::list<WorldObject*>::iterator checkItr = itr++;
-            if (!m_caster->HasInArc(static_cast<float>(M_PI), *checkItr))
-                tempTargets.erase(checkItr);
-        }
-    }
+        tempTargets.erase(std::remove_if(tempTargets.begin(), tempTargets.end(), NotInFrontOf(m_caster)), tempTargets.end());
 
     while (chainTargets)
     {
         // try to get unit for next chain jump
-        std::list<WorldObject*>::iterator foundItr = tempTargets.end();
+        std::vector<WorldObject*>::iterator foundItr = tempTargets.end();
         // get unit with highest hp deficit in dist
         if (isChainHeal)
         {
             uint32 maxHPDeficit = 0;
-            for (std::list<WorldObject*>::iterator itr = tempTargets.begin(); itr != tempTargets.end(); ++itr)
+            for (std::vector<WorldObject*>::iterator itr = tempTargets.begin(); itr != tempTargets.end(); ++itr)
             {
                 if (Unit* unitTarget = (*itr)->ToUnit())
                 {
@@ -2011,7 +2076,7 @@ void Spell::SearchChainTargets(std::list<WorldObject*>& targets, uint32 chainTar
         // get closest object
         else
         {
-            for (std::list<WorldObject*>::iterator itr = tempTargets.begin(); itr != tempTargets.end(); ++itr)
+            for (std::vector<WorldObject*>::iterator itr = tempTargets.begin(); itr != tempTargets.end(); ++itr)
             {
                 if (foundItr == tempTargets.end())
                 {
@@ -2151,7 +2216,7 @@ void Spell::AddUnitTarget(Unit* target, uint32 effectMask, bool checkIfValid /*=
     uint64 targetGUID = target->GetGUID();
 
     // Lookup target in already in list
-    for (std::list<TargetInfo>::iterator ihit = m_UniqueTargetInfo.begin(); ihit != m_UniqueTargetInfo.end(); ++ihit)
+    for (TargetInfoContainer::iterator ihit = m_UniqueTargetInfo.begin(); ihit != m_UniqueTargetInfo.end(); ++ihit)
     {
         if (targetGUID == ihit->targetGUID)             // Found in list
         {
@@ -2237,6 +2302,18 @@ void Spell::AddUnitTarget(Unit* target, uint32 effectMask, bool checkIfValid /*=
     m_UniqueTargetInfo.push_back(targetInfo);
 }
 
+void Spell::AddDeferredUnitTargets()
+{
+    if (m_deferredUnitTargets.empty())
+        return;
+
+    // AddUnitTarget may grow the container, no TargetInfo may be referenced while this runs
+    std::vector<std::pair<Unit*, uint32> > targets;
+    targets.swap(m_deferredUnitTargets);
+    for (std::vector<std::pair<Unit*, uint32> >::const_iterator itr = targets.begin(); itr != targets.end(); ++itr)
+        AddUnitTarget(itr->first, itr->second);
+}
+
 void Spell::AddGOTarget(GameObject* go, uint32 effectMask)
 {
     for (uint32 effIndex = 0; effIndex < MAX_SPELL_EFFECTS; ++effIndex)
@@ -2265,7 +2342,7 @@ void Spell::AddGOTarget(GameObject* go, uint32 effectMask)
     uint64 targetGUID = go->GetGUID();
 
     // Lookup target in already in list
-    for (std::list<GOTargetInfo>::iterator ihit = m_UniqueGOTargetInfo.begin(); ihit != m_UniqueGOTargetInfo.end(); ++ihit)
+    for (GOTargetInfoContainer::iterator ihit = m_UniqueGOTargetInfo.begin(); ihit != m_UniqueGOTargetInfo.end(); ++ihit)
     {
         if (targetGUID == ihit->targetGUID)                 // Found in list
         {
@@ -2315,7 +2392,7 @@ void Spell::AddItemTarget(Item* item, uint32 effectMask)
         return;
 
     // Lookup target in already in list
-    for (std::list<ItemTargetInfo>::iterator ihit = m_UniqueItemInfo.begin(); ihit != m_UniqueItemInfo.end(); ++ihit)
+    for (ItemTargetInfoContainer::iterator ihit = m_UniqueItemInfo.begin(); ihit != m_UniqueItemInfo.end(); ++ihit)
     {
         if (item == ihit->item)                            // Found in list
         {
@@ -2897,7 +2974,7 @@ bool Spell::UpdateChanneledTargetList()
             modOwner->ApplySpellMod(m_spellInfo->Id, SPELLMOD_RANGE, range, this);
     }
 
-    for (std::list<TargetInfo>::iterator ihit = m_UniqueTargetInfo.begin(); ihit != m_UniqueTargetInfo.end(); ++ihit)
+    for (TargetInfoContainer::iterator ihit = m_UniqueTargetInfo.begin(); ihit != m_UniqueTargetInfo.end(); ++ihit)
     {
         if (ihit->missCondition == SPELL_MISS_NONE && (channelTargetEffectMask & ihit->effectMask))
         {
@@ -3224,7 +3301,7 @@ void Spell::cancel()
             break;
 
         case SPELL_STATE_CASTING:
-            for (std::list<TargetInfo>::const_iterator ihit = m_UniqueTargetInfo.begin(); ihit != m_UniqueTargetInfo.end(); ++ihit)
+            for (TargetInfoContainer::const_iterator ihit = m_UniqueTargetInfo.begin(); ihit != m_UniqueTargetInfo.end(); ++ihit)
                 if ((*ihit).missCondition == SPELL_MISS_NONE)
                     if (Unit* unit = m_caster->GetGUID() == ihit->targetGUID ? m_caster : ObjectAccessor::GetUnit(*m_caster, ihit->targetGUID))
                         unit->RemoveOwnedAura(m_spellInfo->Id, m_originalCasterGUID, 0, AURA_REMOVE_BY_CANCEL);
@@ -3487,10 +3564,14 @@ void Spell::handle_immediate()
     // process immediate effects (items, ground, etc.) also initialize some variables
     _handle_immediate_phase();
 
-    for (std::list<TargetInfo>::iterator ihit = m_UniqueTargetInfo.begin(); ihit != m_UniqueTargetInfo.end(); ++ihit)
-        DoAllEffectOnTarget(&(*ihit));
+    // walked by index, targets added by effect handlers are appended and handled by this loop too
+    for (uint32 i = 0; i < m_UniqueTargetInfo.size(); ++i)
+    {
+        DoAllEffectOnTarget(&m_UniqueTargetInfo[i]);
+        AddDeferredUnitTargets();
+    }
 
-    for (std::list<GOTargetInfo>::iterator ihit = m_UniqueGOTargetInfo.begin(); ihit != m_UniqueGOTargetInfo.end(); ++ihit)
+    for (GOTargetInfoContainer::iterator ihit = m_UniqueGOTargetInfo.begin(); ihit != m_UniqueGOTargetInfo.end(); ++ihit)
         DoAllEffectOnTarget(&(*ihit));
 
     FinishTargetProcessing();
@@ -3529,22 +3610,25 @@ uint64 Spell::handle_delayed(uint64 t_offset)
     bool single_missile = (m_targets.HasDst());
 
     // now recheck units targeting correctness (need before any effects apply to prevent adding immunity at first effect not allow apply second spell effect and similar cases)
-    for (std::list<TargetInfo>::iterator ihit = m_UniqueTargetInfo.begin(); ihit != m_UniqueTargetInfo.end(); ++ihit)
+    // walked by index, targets added by effect handlers are appended and handled by this loop too
+    for (uint32 i = 0; i < m_UniqueTargetInfo.size(); ++i)
     {
-        if (ihit->processed == false)
+        TargetInfo& target = m_UniqueTargetInfo[i];
+        if (target.processed == false)
         {
-            if (single_missile || ihit->timeDelay <= t_offset)
+            if (single_missile || target.timeDelay <= t_offset)
             {
-                ihit->timeDelay = t_offset;
-                DoAllEffectOnTarget(&(*ihit));
+                target.timeDelay = t_offset;
+                DoAllEffectOnTarget(&target);
+                AddDeferredUnitTargets();
             }
-            else if (next_time == 0 || ihit->timeDelay < next_time)
-                next_time = ihit->timeDelay;
+            else if (next_time == 0 || target.timeDelay < next_time)
+                next_time = target.timeDelay;
         }
     }
 
     // now recheck gameobject targeting correctness
-    for (std::list<GOTargetInfo>::iterator ighit = m_UniqueGOTargetInfo.begin(); ighit != m_UniqueGOTargetInfo.end(); ++ighit)
+    for (GOTargetInfoContainer::iterator ighit = m_UniqueGOTargetInfo.begin(); ighit != m_UniqueGOTargetInfo.end(); ++ighit)
     {
         if (ighit->processed == false)
         {
@@ -3602,7 +3686,7 @@ void Spell::_handle_immediate_phase()
     }
 
     // process items
-    for (std::list<ItemTargetInfo>::iterator ihit = m_UniqueItemInfo.begin(); ihit != m_UniqueItemInfo.end(); ++ihit)
+    for (ItemTargetInfoContainer::iterator ihit = m_UniqueItemInfo.begin(); ihit != m_UniqueItemInfo.end(); ++ihit)
         DoAllEffectOnTarget(&(*ihit));
 
     if (!m_originalCaster)
@@ -4395,7 +4479,7 @@ void Spell::SendSpellGo()
 
     // This function also fill data for channeled spells:
     // m_needAliveTargetMask req for stop channelig if one target die
-    for (std::list<TargetInfo>::iterator ihit = m_UniqueTargetInfo.begin(); ihit != m_UniqueTargetInfo.end(); ++ihit)
+    for (TargetInfoContainer::iterator ihit = m_UniqueTargetInfo.begin(); ihit != m_UniqueTargetInfo.end(); ++ihit)
     {
         if ((*ihit).effectMask == 0)                  // No effect apply - all immuned add state
             // possibly SPELL_MISS_IMMUNE2 for this??
@@ -4438,7 +4522,7 @@ void Spell::SendSpellGo()
     data.WriteBits(0, 13); // Unknown bits
 
     uint32 missCount = 0;
-    for (std::list<TargetInfo>::const_iterator ihit = m_UniqueTargetInfo.begin(); ihit != m_UniqueTargetInfo.end(); ++ihit)
+    for (TargetInfoContainer::const_iterator ihit = m_UniqueTargetInfo.begin(); ihit != m_UniqueTargetInfo.end(); ++ihit)
     {
         if (ihit->missCondition != SPELL_MISS_NONE)
         {
@@ -4516,7 +4600,7 @@ void Spell::SendSpellGo()
     data.WriteBit(casterUnitGuid[0]);
 
     uint32 missTypeCount = 0;
-    for (std::list<TargetInfo>::const_iterator ihit = m_UniqueTargetInfo.begin(); ihit != m_UniqueTargetInfo.end(); ++ihit)
+    for (TargetInfoContainer::const_iterator ihit = m_UniqueTargetInfo.begin(); ihit != m_UniqueTargetInfo.end(); ++ihit)
     {
         if (ihit->missCondition != SPELL_MISS_NONE)
         {
@@ -4557,7 +4641,7 @@ void Spell::SendSpellGo()
     data.WriteBit(casterUnitGuid[4]);
 
     uint32 hitCount = 0;
-    for (std::list<TargetInfo>::const_iterator ihit = m_UniqueTargetInfo.begin(); ihit != m_UniqueTargetInfo.end(); ++ihit)
+    for (TargetInfoContainer::const_iterator ihit = m_UniqueTargetInfo.begin(); ihit != m_UniqueTargetInfo.end(); ++ihit)
     {
         if ((*ihit).missCondition == SPELL_MISS_NONE)
         {
@@ -4575,7 +4659,7 @@ void Spell::SendSpellGo()
         }
     }
 
-    for (std::list<GOTargetInfo>::const_iterator ighit = m_UniqueGOTargetInfo.begin(); ighit != m_UniqueGOTargetInfo.end(); ++ighit)
+    for (GOTargetInfoContainer::const_iterator ighit = m_UniqueGOTargetInfo.begin(); ighit != m_UniqueGOTargetInfo.end(); ++ighit)
     {
         ObjectGuid hitGuid = ighit->targetGUID; // Always hits
         data.WriteBit(hitGuid[2]);
@@ -4620,7 +4704,7 @@ void Spell::SendSpellGo()
     //{
     //}
 
-    for (std::list<TargetInfo>::const_iterator ihit = m_UniqueTargetInfo.begin(); ihit != m_UniqueTargetInfo.end(); ++ihit)
+    for (TargetInfoContainer::const_iterator ihit = m_UniqueTargetInfo.begin(); ihit != m_UniqueTargetInfo.end(); ++ihit)
     {
         if ((*ihit).missCondition == SPELL_MISS_NONE)
         {
@@ -4636,7 +4720,7 @@ void Spell::SendSpellGo()
         }
     }
 
-    for (std::list<GOTargetInfo>::const_iterator ighit = m_UniqueGOTargetInfo.begin(); ighit != m_UniqueGOTargetInfo.end(); ++ighit)
+    for (GOTargetInfoContainer::const_iterator ighit = m_UniqueGOTargetInfo.begin(); ighit != m_UniqueGOTargetInfo.end(); ++ighit)
     {
         ObjectGuid hitGuid = ighit->targetGUID; // Always hits
         data.WriteByteSeq(hitGuid[0]);
@@ -4663,7 +4747,7 @@ void Spell::SendSpellGo()
 
     data << uint32(getMSTime());
 
-    for (std::list<TargetInfo>::const_iterator ihit = m_UniqueTargetInfo.begin(); ihit != m_UniqueTargetInfo.end(); ++ihit)
+    for (TargetInfoContainer::const_iterator ihit = m_UniqueTargetInfo.begin(); ihit != m_UniqueTargetInfo.end(); ++ihit)
     {
         if (ihit->missCondition != SPELL_MISS_NONE)
         {
@@ -5204,7 +5288,7 @@ void Spell::TakePower()
     {
         if (powerType == POWER_RAGE || powerType == POWER_ENERGY || powerType == POWER_RUNES || powerType == POWER_CHI)
             if (uint64 targetGUID = m_targets.GetUnitTargetGUID())
-                for (std::list<TargetInfo>::iterator ihit = m_UniqueTargetInfo.begin(); ihit != m_UniqueTargetInfo.end(); ++ihit)
+                for (TargetInfoContainer::iterator ihit = m_UniqueTargetInfo.begin(); ihit != m_UniqueTargetInfo.end(); ++ihit)
                     if (ihit->targetGUID == targetGUID)
                     {
                         if (ihit->missCondition != SPELL_MISS_NONE)
@@ -5431,7 +5515,7 @@ void Spell::HandleThreatSpells()
     // since 2.0.1 threat from positive effects also is distributed among all targets, so the overall caused threat is at most the defined bonus
     threat /= m_UniqueTargetInfo.size();
 
-    for (std::list<TargetInfo>::iterator ihit = m_UniqueTargetInfo.begin(); ihit != m_UniqueTargetInfo.end(); ++ihit)
+    for (TargetInfoContainer::iterator ihit = m_UniqueTargetInfo.begin(); ihit != m_UniqueTargetInfo.end(); ++ihit)
     {
         if (ihit->missCondition != SPELL_MISS_NONE)
             continue;
@@ -5470,7 +5554,7 @@ void Spell::HandleHolyPower(Player* caster)
 
     if (uint64 targetGUID = m_targets.GetUnitTargetGUID())
     {
-        for (std::list<TargetInfo>::iterator ihit = m_UniqueTargetInfo.begin(); ihit != m_UniqueTargetInfo.end(); ++ihit)
+        for (TargetInfoContainer::iterator ihit = m_UniqueTargetInfo.begin(); ihit != m_UniqueTargetInfo.end(); ++ihit)
         {
             if (ihit->targetGUID == targetGUID)
             {
@@ -6564,7 +6648,7 @@ bool Spell::CanAutoCast(Unit* target)
     {
         SelectSpellTargets();
         //check if among target units, our WANTED target is as well (->only self cast spells return false)
-        for (std::list<TargetInfo>::iterator ihit = m_UniqueTargetInfo.begin(); ihit != m_UniqueTargetInfo.end(); ++ihit)
+        for (TargetInfoContainer::iterator ihit = m_UniqueTargetInfo.begin(); ihit != m_UniqueTargetInfo.end(); ++ihit)
             if (ihit->targetGUID == targetguid)
                 return true;
     }
@@ -7183,7 +7267,7 @@ void Spell::DelayedChannel()
 
     SF_LOG_DEBUG("spells", "Spell %u partially interrupted for %i ms, new duration: %u ms", m_spellInfo->Id, delaytime, m_timer);
 
-    for (std::list<TargetInfo>::const_iterator ihit = m_UniqueTargetInfo.begin(); ihit != m_UniqueTargetInfo.end(); ++ihit)
+    for (TargetInfoContainer::const_iterator ihit = m_UniqueTargetInfo.begin(); ihit != m_UniqueTargetInfo.end(); ++ihit)
         if ((*ihit).missCondition == SPELL_MISS_NONE)
             if (Unit* unit = (m_caster->GetGUID() == ihit->targetGUID) ? m_caster : ObjectAccessor::GetUnit(*m_caster, ihit->targetGUID))
                 unit->DelayOwnedAuras(m_spellInfo->Id, m_originalCasterGUID, delaytime);
@@ -7331,15 +7415,15 @@ bool Spell::IsNeedSendToClient() const
 
 bool Spell::HaveTargetsForEffect(uint8 effect) const
 {
-    for (std::list<TargetInfo>::const_iterator itr = m_UniqueTargetInfo.begin(); itr != m_UniqueTargetInfo.end(); ++itr)
+    for (TargetInfoContainer::const_iterator itr = m_UniqueTargetInfo.begin(); itr != m_UniqueTargetInfo.end(); ++itr)
         if (itr->effectMask & (1 << effect))
             return true;
 
-    for (std::list<GOTargetInfo>::const_iterator itr = m_UniqueGOTargetInfo.begin(); itr != m_UniqueGOTargetInfo.end(); ++itr)
+    for (GOTargetInfoContainer::const_iterator itr = m_UniqueGOTargetInfo.begin(); itr != m_UniqueGOTargetInfo.end(); ++itr)
         if (itr->effectMask & (1 << effect))
             return true;
 
-    for (std::list<ItemTargetInfo>::const_iterator itr = m_UniqueItemInfo.begin(); itr != m_UniqueItemInfo.end(); ++itr)
+    for (ItemTargetInfoContainer::const_iterator itr = m_UniqueItemInfo.begin(); itr != m_UniqueItemInfo.end(); ++itr)
         if (itr->effectMask & (1 << effect))
             return true;
 
@@ -7495,7 +7579,7 @@ void Spell::HandleLaunchPhase()
 
     bool usesAmmo = m_spellInfo->AttributesCu & SPELL_ATTR0_CU_DIRECT_DAMAGE;
 
-    for (std::list<TargetInfo>::iterator ihit = m_UniqueTargetInfo.begin(); ihit != m_UniqueTargetInfo.end(); ++ihit)
+    for (TargetInfoContainer::iterator ihit = m_UniqueTargetInfo.begin(); ihit != m_UniqueTargetInfo.end(); ++ihit)
     {
         TargetInfo& target = *ihit;
 
@@ -7872,18 +7956,34 @@ void Spell::CallScriptAfterHitHandlers()
     }
 }
 
-void Spell::CallScriptObjectAreaTargetSelectHandlers(std::list<WorldObject*>& targets, SpellEffIndex effIndex)
+void Spell::CallScriptObjectAreaTargetSelectHandlers(std::vector<WorldObject*>& targets, SpellEffIndex effIndex)
 {
+    // script hooks work on a list, only build one when a script of this spell hooks the effect
+    std::list<WorldObject*> targetList;
+    bool hooked = false;
     for (std::list<SpellScript*>::iterator scritr = m_loadedScripts.begin(); scritr != m_loadedScripts.end(); ++scritr)
     {
         (*scritr)->_PrepareScriptCall(SPELL_SCRIPT_HOOK_OBJECT_AREA_TARGET_SELECT);
         std::list<SpellScript::ObjectAreaTargetSelectHandler>::iterator hookItrEnd = (*scritr)->OnObjectAreaTargetSelect.end(), hookItr = (*scritr)->OnObjectAreaTargetSelect.begin();
         for (; hookItr != hookItrEnd; ++hookItr)
+        {
             if ((*hookItr).IsEffectAffected(m_spellInfo, effIndex))
-                (*hookItr).Call(*scritr, targets);
+            {
+                if (!hooked)
+                {
+                    targetList.assign(targets.begin(), targets.end());
+                    hooked = true;
+                }
+
+                (*hookItr).Call(*scritr, targetList);
+            }
+        }
 
         (*scritr)->_FinishScriptCall();
     }
+
+    if (hooked)
+        targets.assign(targetList.begin(), targetList.end());
 }
 
 void Spell::CallScriptObjectTargetSelectHandlers(WorldObject*& target, SpellEffIndex effIndex)
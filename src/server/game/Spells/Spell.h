@@ -7,8 +7,10 @@
 #define SF_SPELL_H
 
 #include "GridDefines.h"
+#include "InlineVector.h"
 #include "ObjectMgr.h"
 #include "PathGenerator.h"
+#include "ObjectPool.h"
 #include "SharedDefines.h"
 #include "SpellInfo.h"
 
@@ -224,7 +226,7 @@ struct SpellResearchData
     uint32 fragmentCount;
 };
 
-class Spell
+class Spell : public PooledObject<Spell>
 {
     friend void Unit::SetCurrentCastedSpell(Spell* pSpell);
     friend class SpellScript;
@@ -391,8 +393,8 @@ public:
     template<class SEARCHER> void SearchTargets(SEARCHER& searcher, uint32 containerMask, Unit* referer, Position const* pos, float radius);
 
     WorldObject* SearchNearbyTarget(float range, SpellTargetObjectTypes objectType, SpellTargetCheckTypes selectionType, ConditionList* condList = NULL);
-    void SearchAreaTargets(std::list<WorldObject*>& targets, float range, Position const* position, Unit* referer, SpellTargetObjectTypes objectType, SpellTargetCheckTypes selectionType, ConditionList* condList);
-    void SearchChainTargets(std::list<WorldObject*>& targets, uint32 chainTargets, WorldObject* target, SpellTargetObjectTypes objectType, SpellTargetCheckTypes selectType, ConditionList* condList, bool isChainHeal);
+    void SearchAreaTargets(std::vector<WorldObject*>& targets, float range, Position const* position, Unit* referer, SpellTargetObjectTypes objectType, SpellTargetCheckTypes selectionType, ConditionList* condList);
+    void SearchChainTargets(std::vector<WorldObject*>& targets, uint32 chainTargets, WorldObject* target, SpellTargetObjectTypes objectType, SpellTargetCheckTypes selectType, ConditionList* condList, bool isChainHeal);
 
     GameObject* SearchSpellFocus();
 
@@ -606,7 +608,9 @@ protected:
         bool   scaleAura : 1;
         int32  damage;
     };
-    std::list<TargetInfo> m_UniqueTargetInfo;
+    // most casts hit a handful of targets, keep those inside the spell instead of one heap node each
+    typedef InlineVector<TargetInfo, 8> TargetInfoContainer;
+    TargetInfoContainer m_UniqueTargetInfo;
     uint8 m_channelTargetEffectMask;                        // Mask req. alive targets
 
     struct GOTargetInfo
@@ -616,18 +620,25 @@ protected:
         uint8  effectMask : 8;
         bool   processed : 1;
     };
-    std::list<GOTargetInfo> m_UniqueGOTargetInfo;
+    typedef InlineVector<GOTargetInfo, 2> GOTargetInfoContainer;
+    GOTargetInfoContainer m_UniqueGOTargetInfo;
 
     struct ItemTargetInfo
     {
         Item* item;
         uint8 effectMask;
     };
-    std::list<ItemTargetInfo> m_UniqueItemInfo;
+    typedef InlineVector<ItemTargetInfo, 2> ItemTargetInfoContainer;
+    ItemTargetInfoContainer m_UniqueItemInfo;
 
     SpellDestination m_destTargets[MAX_SPELL_EFFECTS];
 
+    std::vector<std::pair<Unit*, uint32> > m_deferredUnitTargets;
+
     void AddUnitTarget(Unit* target, uint32 effectMask, bool checkIfValid = true, bool implicit = true);
+    // effect handlers run while m_UniqueTargetInfo is walked, targets they add wait until the current target is done
+    void AddUnitTargetDeferred(Unit* target, uint32 effectMask) { m_deferredUnitTargets.push_back(std::make_pair(target, effectMask)); }
+    void AddDeferredUnitTargets();
     void AddGOTarget(GameObject* target, uint32 effectMask);
     void AddItemTarget(Item* item, uint32 effectMask);
     void AddDestTarget(SpellDestination const& dest, uint32 effIndex);
@@ -660,7 +671,7 @@ protected:
     void CallScriptBeforeHitHandlers();
     void CallScriptOnHitHandlers();
     void CallScriptAfterHitHandlers();
-    void CallScriptObjectAreaTargetSelectHandlers(std::list<WorldObject*>& targets, SpellEffIndex effIndex);
+    void CallScriptObjectAreaTargetSelectHandlers(std::vector<WorldObject*>& targets, SpellEffIndex effIndex);
     void CallScriptObjectTargetSelectHandlers(WorldObject*& target, SpellEffIndex effIndex);
     bool CheckScriptEffectImplicitTargets(uint32 effIndex, uint32 effIndexToCheck);
     std::list<SpellScript*> m_loadedScripts;
@@ -765,7 +776,7 @@ namespace Skyfire
 
 typedef void(Spell::* pEffect)(SpellEffIndex effIndex);
 
-class SpellEvent : public BasicEvent
+class SpellEvent : public BasicEvent, public PooledObject<SpellEvent>
 {
 public:
     SpellEvent(Spell* spell);
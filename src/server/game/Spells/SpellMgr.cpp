@@ -2480,7 +2480,12 @@ void SpellMgr::LoadSpellAreas()
         if (SpellInfo const* spellInfo = GetSpellInfo(spell))
         {
             if (spellArea.autocast)
+            {
                 const_cast<SpellInfo*>(spellInfo)->Attributes |= SPELL_ATTR0_CANT_CANCEL;
+                // hot data is built before spell areas, keep it in sync
+                if (spell < mSpellHotData.size())
+                    mSpellHotData[spell].Attributes |= SPELL_ATTR0_CANT_CANCEL;
+            }
         }
         else
         {
@@ -2671,6 +2676,7 @@ void SpellMgr::UnloadSpellInfoStore()
         delete mSpellInfoMap[i];
 
     mSpellInfoMap.clear();
+    mSpellHotData.clear();
 }
 
 void SpellMgr::UnloadSpellInfoImplicitTargetConditionLists()
@@ -3575,3 +3581,48 @@ void SpellMgr::LoadSpellInfoCorrections()
 
     SF_LOG_INFO("server.loading", ">> Loaded SpellInfo corrections in %u ms", GetMSTimeDiffToNow(oldMSTime));
 }
+
+void SpellMgr::LoadSpellInfoHotData()
+{
+    uint32 oldMSTime = getMSTime();
+
+    mSpellHotData.assign(GetSpellInfoStoreSize(), SpellHotData());
+
+    uint32 count = 0;
+    for (uint32 i = 0; i < GetSpellInfoStoreSize(); ++i)
+    {
+        SpellInfo const* spellInfo = mSpellInfoMap[i];
+        if (!spellInfo)
+            continue;
+
+        SpellHotData& data = mSpellHotData[i];
+        data.Attributes = spellInfo->Attributes;
+        data.AttributesEx = spellInfo->AttributesEx;
+        data.AttributesEx3 = spellInfo->AttributesEx3;
+
+        for (uint8 j = 0; j < MAX_SPELL_EFFECTS; ++j)
+            if (spellInfo->Effects[j].IsEffect())
+                data.EffectMask |= 1 << j;
+
+        if (spellInfo->RangeEntry)
+        {
+            data.MinRangeHostile = spellInfo->RangeEntry->minRangeHostile;
+            data.MaxRangeHostile = spellInfo->RangeEntry->maxRangeHostile;
+            data.MinRangeFriend = spellInfo->RangeEntry->minRangeFriend;
+            data.MaxRangeFriend = spellInfo->RangeEntry->maxRangeFriend;
+        }
+
+        data.SchoolMask = uint8(spellInfo->SchoolMask);
+        data.DmgClass = uint8(spellInfo->DmgClass);
+        data.Dispel = uint8(spellInfo->Dispel);
+        data.Mechanic = uint8(spellInfo->Mechanic);
+
+        data.Flags = SPELL_HOT_DATA_LOADED;
+        if (spellInfo->IsPositive())
+            data.Flags |= SPELL_HOT_DATA_POSITIVE;
+
+        ++count;
+    }
+
+    SF_LOG_INFO("server.loading", ">> Loaded hot data of %u spells (%u KB) in %u ms", count, uint32(mSpellHotData.size() * sizeof(SpellHotData) / 1024), GetMSTimeDiffToNow(oldMSTime));
+}
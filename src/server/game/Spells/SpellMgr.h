@@ -562,6 +562,54 @@ typedef std::vector<bool> EnchantCustomAttribute;
 
 typedef std::vector<SpellInfo*> SpellInfoMap;
 
+enum SpellHotDataFlags
+{
+    SPELL_HOT_DATA_LOADED               = 0x01,
+    SPELL_HOT_DATA_POSITIVE             = 0x02
+};
+
+/// Copy of the SpellInfo fields read by hit, immunity and range checks, one cache line per spell.
+/// SpellInfo itself spans several kilobytes (32 effect slots), so checks against other spells,
+/// e.g. the sources of school immunities, would otherwise pull in a cold SpellInfo each time.
+/// Built once by LoadSpellInfoHotData after all SpellInfo corrections are applied.
+struct alignas(64) SpellHotData
+{
+    bool IsLoaded() const { return (Flags & SPELL_HOT_DATA_LOADED) != 0; }
+    bool IsPositive() const { return (Flags & SPELL_HOT_DATA_POSITIVE) != 0; }
+
+    SpellSchoolMask GetSchoolMask() const { return SpellSchoolMask(SchoolMask); }
+    float GetMinRange(bool positive) const { return positive ? MinRangeFriend : MinRangeHostile; }
+    float GetMaxRange(bool positive) const { return positive ? MaxRangeFriend : MaxRangeHostile; }
+
+    /// Same rules as SpellInfo::CanPierceImmuneAura
+    bool CanPierceImmuneAura(SpellHotData const* aura) const
+    {
+        if (Attributes & SPELL_ATTR0_UNAFFECTED_BY_INVULNERABILITY)
+            return true;
+
+        return (AttributesEx & SPELL_ATTR1_UNAFFECTED_BY_SCHOOL_IMMUNE)
+            && !(aura && (aura->Mechanic == MECHANIC_IMMUNE_SHIELD || aura->Mechanic == MECHANIC_INVULNERABILITY));
+    }
+
+    uint32 Attributes;
+    uint32 AttributesEx;
+    uint32 AttributesEx3;
+    uint32 EffectMask;                                      // bit per effect slot holding an effect
+    float MinRangeHostile;
+    float MaxRangeHostile;
+    float MinRangeFriend;
+    float MaxRangeFriend;
+    uint8 SchoolMask;
+    uint8 DmgClass;
+    uint8 Dispel;
+    uint8 Mechanic;
+    uint8 Flags;                                            // SpellHotDataFlags
+};
+
+static_assert(sizeof(SpellHotData) == 64, "SpellHotData must fill exactly one cache line");
+
+typedef std::vector<SpellHotData> SpellHotDataMap;
+
 typedef std::map<int32, std::vector<int32> > SpellLinkedMap;
 
 bool IsPrimaryProfessionSkill(uint32 skill);
@@ -678,6 +726,9 @@ public:
     // SpellInfo object management
     SpellInfo const* GetSpellInfo(uint32 spellId) const { return spellId < GetSpellInfoStoreSize() ? mSpellInfoMap[spellId] : NULL; }
     uint32 GetSpellInfoStoreSize() const { return mSpellInfoMap.size(); }
+    SpellHotData const* GetSpellHotData(uint32 spellId) const { return spellId < mSpellHotData.size() && mSpellHotData[spellId].IsLoaded() ? &mSpellHotData[spellId] : NULL; }
+    /// for ids of spells known to be in the store, every SpellInfo has its hot data once the world is loaded
+    SpellHotData const& GetSpellHotDataUnchecked(uint32 spellId) const { return mSpellHotData[spellId]; }
 
 private:
     SpellInfo* _GetSpellInfo(uint32 spellId) { return spellId < GetSpellInfoStoreSize() ? mSpellInfoMap[spellId] : NULL; }
@@ -711,6 +762,7 @@ public:
     void UnloadSpellInfoImplicitTargetConditionLists();
     void LoadSpellInfoCustomAttributes();
     void LoadSpellInfoCorrections();
+    void LoadSpellInfoHotData();
 
 private:
     SpellDifficultySearcherMap mSpellDifficultySearcherMap;
@@ -740,6 +792,7 @@ private:
     PetLevelupSpellMap         mPetLevelupSpellMap;
     PetDefaultSpellsMap        mPetDefaultSpellsMap;           // only spells not listed in related mPetLevelupSpellMap entry
     SpellInfoMap               mSpellInfoMap;
+    SpellHotDataMap            mSpellHotData;
 };
 
 #define sSpellMgr ACE_Singleton<SpellMgr, ACE_Null_Mutex>::instance()
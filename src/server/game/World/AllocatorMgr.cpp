@@ -0,0 +1,226 @@
+/*
+* This file is part of Project SkyFire https://www.projectskyfire.org.
+* See LICENSE.md file for Copyright information
+*/
+
+#include "AllocatorMgr.h"
+#include "Log.h"
+#include "TickProfiler.h"
+#include "World.h"
+
+#include <cstdio>
+
+#if defined(SF_ALLOCATOR_JEMALLOC)
+// dep/jemalloc is built without symbol prefix, so its control interface is plain mallctl
+extern "C" int mallctl(char const* name, void* oldp, size_t* oldlenp, void* newp, size_t newlen);
+#elif defined(SF_ALLOCATOR_MIMALLOC)
+#include <mimalloc.h>
+#elif defined(__GLIBC__)
+#include <malloc.h>
+#endif
+
+#ifdef __linux__
+#include <unistd.h>
+#endif
+
+namespace
+{
+    double ToMB(uint64 bytes)
+    {
+        return double(bytes) / (1024.0 * 1024.0);
+    }
+
+    uint64 GetResidentSize()
+    {
+#ifdef __linux__
+        FILE* statm = fopen("/proc/self/statm", "r");
+        if (!statm)
+            return 0;
+
+        unsigned long size = 0, resident = 0;
+        int read = fscanf(statm, "%lu %lu", &size, &resident);
+        fclose(statm);
+        return read == 2 ? uint64(resident) * uint64(sysconf(_SC_PAGESIZE)) : 0;
+#else
+        return 0;
+#endif
+    }
+
+#if defined(SF_ALLOCATOR_JEMALLOC)
+    template<class T>
+    T ReadMallctl(char const* name)
+    {
+        T value = T();
+        size_t length = sizeof(value);
+        if (mallctl(name, &value, &length, NULL, 0) != 0)
+            return T();
+
+        return value;
+    }
+
+    template<class T>
+    T ReadArenaMallctl(uint32 arena, char const* stat)
+    {
+        char name[128];
+        snprintf(name, sizeof(name), "stats.arenas.%u.%s", arena, stat);
+        return ReadMallctl<T>(name);
+    }
+#endif
+}
+
+AllocatorMgr::AllocatorMgr() : _purgeTimer(0), _diffSum(0), _diffCount(0)
+{
+}
+
+char const* AllocatorMgr::GetAllocatorName() const
+{
+#if defined(SF_ALLOCATOR_JEMALLOC)
+    return "jemalloc";
+#elif defined(SF_ALLOCATOR_MIMALLOC)
+    return "mimalloc";
+#else
+    return "system";
+#endif
+}
+
+void AllocatorMgr::InitMapThread()
+{
+#if defined(SF_ALLOCATOR_JEMALLOC)
+    if (!sWorld->GetBoolConfig(WorldBoolConfigs::CONFIG_MEMORY_MAP_THREAD_ARENAS))
+        return;
+
+    unsigned arena = 0;
+    size_t length = sizeof(arena);
+    if (mallctl("arenas.extend", &arena, &length, NULL, 0) != 0 || mallctl("thread.arena", NULL, NULL, &arena, sizeof(arena)) != 0)
+    {
+        SF_LOG_ERROR("misc", "AllocatorMgr: could not give a map update thread an arena of its own");
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(_arenaLock);
+    _mapThreadArenas.insert(arena);
+    SF_LOG_DEBUG("misc", "AllocatorMgr: map update thread uses arena %u", arena);
+#endif
+    // mimalloc and the system allocator already keep a heap per thread
+}
+
+void AllocatorMgr::GetStats(AllocatorStats& stats)
+{
+    stats.Resident = GetResidentSize();
+
+#if defined(SF_ALLOCATOR_JEMALLOC)
+    // statistics are a snapshot taken when the epoch is advanced
+    uint64 epoch = 1;
+    size_t length = sizeof(epoch);
+    mallctl("epoch", &epoch, &length, &epoch, length);
+
+    stats.Allocated = ReadMallctl<size_t>("stats.allocated");
+    stats.Active = ReadMallctl<size_t>("stats.active");
+    stats.Mapped = ReadMallctl<size_t>("stats.mapped");
+    stats.Huge = ReadMallctl<size_t>("stats.huge.allocated");
+
+    size_t page = ReadMallctl<size_t>("arenas.page");
+    unsigned arenaCount = ReadMallctl<unsigned>("arenas.narenas");
+    if (!arenaCount)
+        return;
+
+    bool* initialized = new bool[arenaCount];
+    length = sizeof(bool) * arenaCount;
+    if (mallctl("arenas.initialized", initialized, &length, NULL, 0) == 0)
+    {
+        std::lock_guard<std::mutex> lock(_arenaLock);
+        for (uint32 i = 0; i < arenaCount; ++i)
+        {
+            if (!initialized[i])
+                continue;
+
+            AllocatorArenaStats arena;
+            arena.Index = i;
+            arena.Threads = ReadArenaMallctl<unsigned>(i, "nthreads");
+            arena.Allocated = ReadArenaMallctl<size_t>(i, "small.allocated") + ReadArenaMallctl<size_t>(i, "large.allocated");
+            arena.Active = uint64(ReadArenaMallctl<size_t>(i, "pactive")) * page;
+            arena.Dirty = uint64(ReadArenaMallctl<size_t>(i, "pdirty")) * page;
+            arena.Mapped = ReadArenaMallctl<size_t>(i, "mapped");
+            arena.MapThread = _mapThreadArenas.find(i) != _mapThreadArenas.end();
+
+            stats.Dirty += arena.Dirty;
+            stats.Arenas.push_back(arena);
+        }
+    }
+
+    delete[] initialized;
+#elif defined(SF_ALLOCATOR_MIMALLOC)
+    size_t elapsed, user, system, resident, peakResident, commit, peakCommit, pageFaults;
+    mi_process_info(&elapsed, &user, &system, &resident, &peakResident, &commit, &peakCommit, &pageFaults);
+    stats.Mapped = commit;
+    if (resident)
+        stats.Resident = resident;
+#elif defined(__GLIBC__) && (__GLIBC__ > 2 || (__GLIBC__ == 2 && __GLIBC_MINOR__ >= 33))
+    struct mallinfo2 info = mallinfo2();
+    stats.Allocated = info.uordblks + info.hblkhd;
+    stats.Active = info.arena + info.hblkhd;
+    stats.Dirty = info.fordblks;
+    stats.Mapped = info.arena + info.hblkhd;
+#endif
+}
+
+void AllocatorMgr::Purge()
+{
+#if defined(SF_ALLOCATOR_JEMALLOC)
+    mallctl("arenas.purge", NULL, NULL, NULL, 0);
+#elif defined(SF_ALLOCATOR_MIMALLOC)
+    mi_collect(true);
+#elif defined(__GLIBC__)
+    malloc_trim(0);
+#endif
+}
+
+void AllocatorMgr::Update(uint32 diff)
+{
+    uint32 interval = sWorld->getIntConfig(WorldIntConfigs::CONFIG_MEMORY_PURGE_INTERVAL);
+    if (!interval)
+        return;
+
+    _purgeTimer += diff;
+    _diffSum += diff;
+    ++_diffCount;
+    if (_purgeTimer < interval * IN_MILLISECONDS)
+        return;
+
+    // purging walks every dirty page, leave it for a quieter moment while the server is busy
+    uint32 averageDiff = uint32(_diffSum / _diffCount);
+    if (averageDiff <= sWorld->getIntConfig(WorldIntConfigs::CONFIG_MEMORY_PURGE_MAX_UPDATE_DIFF))
+    {
+        TickProfileScope profile(TICK_SECTION_ALLOCATOR_PURGE);
+        Purge();
+    }
+    else
+        SF_LOG_DEBUG("misc", "AllocatorMgr: purge skipped, average update diff %u ms", averageDiff);
+
+    _purgeTimer = 0;
+    _diffSum = 0;
+    _diffCount = 0;
+}
+
+void AllocatorMgr::BuildReport(AllocatorStats const& stats, bool arenas, std::vector<std::string>& lines)
+{
+    char line[256];
+    snprintf(line, sizeof(line), "Allocator %s: allocated %.1f MB, active %.1f MB, dirty %.1f MB, mapped %.1f MB, resident %.1f MB, fragmentation %.1f%%",
+        sAllocatorMgr->GetAllocatorName(), ToMB(stats.Allocated), ToMB(stats.Active), ToMB(stats.Dirty), ToMB(stats.Mapped), ToMB(stats.Resident),
+        stats.GetFragmentation());
+    lines.push_back(line);
+
+    if (!arenas || stats.Arenas.empty())
+        return;
+
+    snprintf(line, sizeof(line), "Huge allocations (not counted per arena): %.1f MB", ToMB(stats.Huge));
+    lines.push_back(line);
+
+    lines.push_back("arena  threads  small+large MB  active MB  dirty MB  mapped MB");
+    for (std::vector<AllocatorArenaStats>::const_iterator itr = stats.Arenas.begin(); itr != stats.Arenas.end(); ++itr)
+    {
+        snprintf(line, sizeof(line), "%5u %8u %15.1f %10.1f %9.1f %10.1f%s", itr->Index, itr->Threads, ToMB(itr->Allocated), ToMB(itr->Active),
+            ToMB(itr->Dirty), ToMB(itr->Mapped), itr->MapThread ? "  map thread" : "");
+        lines.push_back(line);
+    }
+}
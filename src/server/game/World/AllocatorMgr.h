@@ -0,0 +1,86 @@
+/*
+* This file is part of Project SkyFire https://www.projectskyfire.org.
+* See LICENSE.md file for Copyright information
+*/
+
+#ifndef SKYFIRE_ALLOCATORMGR_H
+#define SKYFIRE_ALLOCATORMGR_H
+
+#include "Define.h"
+
+#include <ace/Null_Mutex.h>
+#include <ace/Singleton.h>
+#include <mutex>
+#include <set>
+#include <string>
+#include <vector>
+
+/// Usage of one allocator arena, in bytes
+struct AllocatorArenaStats
+{
+    AllocatorArenaStats() : Index(0), Threads(0), Allocated(0), Active(0), Dirty(0), Mapped(0), MapThread(false) { }
+
+    uint32 Index;
+    uint32 Threads;
+    uint64 Allocated;                                       // small and large allocations, jemalloc 3 keeps no per arena huge figure
+    uint64 Active;                                          // pages holding at least one allocation
+    uint64 Dirty;                                           // unused pages not yet given back to the system
+    uint64 Mapped;
+    bool MapThread;                                         // dedicated arena of a map update thread
+};
+
+/// Process wide allocator usage in bytes, only Resident is known with the system allocator
+struct AllocatorStats
+{
+    AllocatorStats() : Allocated(0), Active(0), Dirty(0), Mapped(0), Resident(0), Huge(0) { }
+
+    /// share of the active pages not holding allocations
+    float GetFragmentation() const { return Active > Allocated ? float(Active - Allocated) * 100.0f / float(Active) : 0.0f; }
+
+    uint64 Allocated;
+    uint64 Active;
+    uint64 Dirty;
+    uint64 Mapped;
+    uint64 Resident;                                        // resident set size of the process
+    uint64 Huge;                                            // jemalloc huge allocations, not part of any arena figure
+    std::vector<AllocatorArenaStats> Arenas;
+};
+
+/// Runtime control of the allocator selected with the MEMORY_ALLOCATOR build option.
+/// With jemalloc every map update thread gets an arena of its own (Memory.MapThreadArenas), so
+/// the allocation patterns of busy maps do not fragment the arenas shared by the other threads.
+/// Dirty pages are given back to the system every Memory.PurgeInterval, but only while the
+/// average world update diff stays below Memory.PurgeMaxUpdateDiff.
+class AllocatorMgr
+{
+    friend class ACE_Singleton<AllocatorMgr, ACE_Null_Mutex>;
+
+public:
+    char const* GetAllocatorName() const;
+
+    /// Called by each map update thread before it handles its first map
+    void InitMapThread();
+
+    void GetStats(AllocatorStats& stats);
+    /// Gives unused dirty pages of all arenas back to the system
+    void Purge();
+
+    void Update(uint32 diff);
+
+    static void BuildReport(AllocatorStats const& stats, bool arenas, std::vector<std::string>& lines);
+
+private:
+    AllocatorMgr();
+    ~AllocatorMgr() { }
+
+    std::mutex _arenaLock;
+    std::set<uint32> _mapThreadArenas;
+
+    uint32 _purgeTimer;
+    uint64 _diffSum;
+    uint32 _diffCount;
+};
+
+#define sAllocatorMgr ACE_Singleton<AllocatorMgr, ACE_Null_Mutex>::instance()
+
+#endif
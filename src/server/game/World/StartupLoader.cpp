@@ -0,0 +1,136 @@
+/*
+* This file is part of Project SkyFire https://www.projectskyfire.org.
+* See LICENSE.md file for Copyright information
+*/
+
+#include "DatabaseEnv.h"
+#include "Errors.h"
+#include "Log.h"
+#include "StartupLoader.h"
+#include "Timer.h"
+
+#include <algorithm>
+
+StartupLoader::TimingStore StartupLoader::_timings;
+std::mutex StartupLoader::_timingsLock;
+
+StartupLoader::StartupLoader() : _unfinished(0) { }
+
+StartupLoader::~StartupLoader()
+{
+    for (std::vector<Task*>::iterator itr = _tasks.begin(); itr != _tasks.end(); ++itr)
+        delete *itr;
+}
+
+uint32 StartupLoader::AddTask(char const* name, LoadFunction function)
+{
+    return AddTask(new FunctionTask(name, function));
+}
+
+uint32 StartupLoader::AddTask(Task* task)
+{
+    _tasks.push_back(task);
+    return uint32(_tasks.size() - 1);
+}
+
+void StartupLoader::AddDependency(uint32 task, uint32 dependency)
+{
+    // adding tasks in dependency order keeps the single threaded run a plain loop and rules out cycles
+    ASSERT(dependency < task && task < _tasks.size());
+
+    _tasks[dependency]->Dependents.push_back(task);
+    ++_tasks[task]->PendingDependencies;
+}
+
+void StartupLoader::Execute(uint32 index)
+{
+    Task* task = _tasks[index];
+
+    uint32 oldMSTime = getMSTime();
+    task->Call();
+    uint32 diff = GetMSTimeDiffToNow(oldMSTime);
+
+    std::lock_guard<std::mutex> lock(_timingsLock);
+    _timings.push_back(std::make_pair(task->Name, diff));
+}
+
+void StartupLoader::Run(uint32 threads)
+{
+    if (threads <= 1 || _tasks.size() <= 1)
+    {
+        for (uint32 i = 0; i < _tasks.size(); ++i)
+            Execute(i);
+        return;
+    }
+
+    _unfinished = uint32(_tasks.size());
+    for (uint32 i = 0; i < _tasks.size(); ++i)
+        if (!_tasks[i]->PendingDependencies)
+            _ready.push_back(i);
+
+    // lowest index first, close to the order the loaders are written in
+    std::reverse(_ready.begin(), _ready.end());
+
+    if (ACE_Task_Base::activate(THR_NEW_LWP | THR_JOINABLE | THR_INHERIT_SCHED, int(std::min<size_t>(threads, _tasks.size()))) == -1)
+    {
+        SF_LOG_ERROR("server.loading", "StartupLoader: can't start loader threads, loading sequentially");
+        for (uint32 i = 0; i < _tasks.size(); ++i)
+            Execute(i);
+        return;
+    }
+
+    wait();
+}
+
+int StartupLoader::svc()
+{
+    MySQL::Thread_Init();
+
+    while (true)
+    {
+        uint32 index;
+        {
+            std::unique_lock<std::mutex> lock(_lock);
+            while (_ready.empty() && _unfinished)
+                _condition.wait(lock);
+
+            if (!_unfinished)
+                break;
+
+            index = _ready.back();
+            _ready.pop_back();
+        }
+
+        Execute(index);
+
+        {
+            std::lock_guard<std::mutex> lock(_lock);
+            std::vector<uint32> const& dependents = _tasks[index]->Dependents;
+            for (std::vector<uint32>::const_iterator itr = dependents.begin(); itr != dependents.end(); ++itr)
+                if (!--_tasks[*itr]->PendingDependencies)
+                    _ready.insert(_ready.begin(), *itr);
+
+            --_unfinished;
+        }
+
+        _condition.notify_all();
+    }
+
+    MySQL::Thread_End();
+    return 0;
+}
+
+static bool TimingGreater(std::pair<std::string, uint32> const& left, std::pair<std::string, uint32> const& right)
+{
+    return left.second > right.second;
+}
+
+void StartupLoader::LogTimings(uint32 count)
+{
+    std::lock_guard<std::mutex> lock(_timingsLock);
+    std::sort(_timings.begin(), _timings.end(), TimingGreater);
+
+    SF_LOG_INFO("server.loading", "Slowest startup loaders:");
+    for (uint32 i = 0; i < _timings.size() && i < count; ++i)
+        SF_LOG_INFO("server.loading", "  %-40s %u ms", _timings[i].first.c_str(), _timings[i].second);
+}
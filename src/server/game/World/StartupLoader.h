@@ -0,0 +1,90 @@
+/*
+* This file is part of Project SkyFire https://www.projectskyfire.org.
+* See LICENSE.md file for Copyright information
+*/
+
+#ifndef SKYFIRE_STARTUPLOADER_H
+#define SKYFIRE_STARTUPLOADER_H
+
+#include "Define.h"
+
+#include <ace/Task.h>
+#include <condition_variable>
+#include <mutex>
+#include <string>
+#include <vector>
+
+/// Group of startup loaders with their ordering constraints.
+/// Run() executes every loader once all loaders it depends on are done, with more than
+/// one thread independent loaders run at the same time.
+class StartupLoader : protected ACE_Task_Base
+{
+public:
+    typedef void (*LoadFunction)();
+
+    StartupLoader();
+    ~StartupLoader();
+
+    uint32 AddTask(char const* name, LoadFunction function);
+
+    template<class T>
+    uint32 AddTask(char const* name, T* object, void (T::*method)())
+    {
+        return AddTask(new MethodTask<T>(name, object, method));
+    }
+
+    /// task is not started before dependency finished, dependency must be added first
+    void AddDependency(uint32 task, uint32 dependency);
+
+    void Run(uint32 threads);
+
+    /// Logs the slowest loaders of all groups run so far
+    static void LogTimings(uint32 count);
+
+private:
+    struct Task
+    {
+        explicit Task(char const* name) : Name(name), PendingDependencies(0) { }
+        virtual ~Task() { }
+        virtual void Call() = 0;
+
+        std::string Name;
+        std::vector<uint32> Dependents;
+        uint32 PendingDependencies;
+    };
+
+    struct FunctionTask : public Task
+    {
+        FunctionTask(char const* name, LoadFunction function) : Task(name), Function(function) { }
+        void Call() { Function(); }
+
+        LoadFunction Function;
+    };
+
+    template<class T>
+    struct MethodTask : public Task
+    {
+        MethodTask(char const* name, T* object, void (T::*method)()) : Task(name), Object(object), Method(method) { }
+        void Call() { (Object->*Method)(); }
+
+        T* Object;
+        void (T::*Method)();
+    };
+
+    uint32 AddTask(Task* task);
+    void Execute(uint32 index);
+    virtual int svc();
+
+    std::vector<Task*> _tasks;
+
+    std::mutex _lock;
+    std::condition_variable _condition;
+    std::vector<uint32> _ready;
+    uint32 _unfinished;
+
+    typedef std::vector<std::pair<std::string, uint32> > TimingStore;
+    static TimingStore _timings;
+    static std::mutex _timingsLock;
+};
+
+#endif
@@ -0,0 +1,397 @@
+/*
+* This file is part of Project SkyFire https://www.projectskyfire.org.
+* See LICENSE.md file for Copyright information
+*/
+
+#include "TickProfiler.h"
+#include "AllocatorMgr.h"
+#include "Log.h"
+#include "Opcodes.h"
+#include "World.h"
+
+#include <algorithm>
+#include <cstdio>
+
+namespace
+{
+    char const* const TickSectionNames[MAX_TICK_SECTIONS] =
+    {
+        "World::Update",
+        "UpdateSessions",
+        "MapManager::Update",
+        "Map::Update",
+        "Map sessions",
+        "Map objects",
+        "Relocation notifies",
+        "ObjectAccessor::Update",
+        "BattlegroundMgr",
+        "OutdoorPvPMgr",
+        "BattlefieldMgr",
+        "LFGMgr",
+        "Query callbacks",
+        "Opcode handlers",
+        "Allocator purge"
+    };
+
+    double ToMS(uint64 us)
+    {
+        return double(us) / 1000.0;
+    }
+
+    std::string FormatHistogram(char const* name, TickHistogram const& histogram)
+    {
+        char line[256];
+        snprintf(line, sizeof(line), "%-28s %9u %9.1f %8.2f %8.2f %8.2f %8.2f", name, histogram.GetCount(), ToMS(histogram.GetTotal()),
+            ToMS(histogram.GetPercentile(50.0f)), ToMS(histogram.GetPercentile(90.0f)), ToMS(histogram.GetPercentile(99.0f)), ToMS(histogram.GetMax()));
+        return line;
+    }
+
+    std::string GetOpcodeName(uint32 opcode)
+    {
+        if (OpcodeHandler const* handler = clientOpcodeTable[opcode])
+            return handler->Name;
+
+        char name[32];
+        snprintf(name, sizeof(name), "opcode %u", opcode);
+        return name;
+    }
+
+    struct HistogramTotalOrder
+    {
+        bool operator()(std::pair<uint32, TickHistogram const*> const& left, std::pair<uint32, TickHistogram const*> const& right) const
+        {
+            return left.second->GetTotal() > right.second->GetTotal();
+        }
+    };
+
+    struct OpcodeTickTime
+    {
+        OpcodeTickTime(uint32 opcode, uint32 count, uint32 us) : Opcode(opcode), Count(count), Time(us) { }
+
+        uint32 Opcode;
+        uint32 Count;
+        uint32 Time;
+    };
+
+    struct TickTimeOrder
+    {
+        template<class T>
+        bool operator()(T const& left, T const& right) const
+        {
+            return left.Time > right.Time;
+        }
+    };
+
+    std::string const TableHeader = "                             count  total ms  p50 ms   p90 ms   p99 ms   max ms";
+}
+
+void TickHistogram::Add(uint32 us)
+{
+    _buckets[GetBucket(us)].fetch_add(1, std::memory_order_relaxed);
+    _count.fetch_add(1, std::memory_order_relaxed);
+    _total.fetch_add(us, std::memory_order_relaxed);
+
+    uint32 max = _max.load(std::memory_order_relaxed);
+    while (us > max && !_max.compare_exchange_weak(max, us, std::memory_order_relaxed))
+        ;
+}
+
+void TickHistogram::Reset()
+{
+    for (uint32 i = 0; i < TICK_HISTOGRAM_BUCKETS; ++i)
+        _buckets[i].store(0, std::memory_order_relaxed);
+
+    _count.store(0, std::memory_order_relaxed);
+    _total.store(0, std::memory_order_relaxed);
+    _max.store(0, std::memory_order_relaxed);
+}
+
+uint32 TickHistogram::GetPercentile(float percent) const
+{
+    uint32 count = GetCount();
+    if (!count)
+        return 0;
+
+    uint64 wanted = uint64(count * percent / 100.0f + 0.5f);
+    if (!wanted)
+        wanted = 1;
+
+    uint64 seen = 0;
+    for (uint32 i = 0; i < TICK_HISTOGRAM_BUCKETS; ++i)
+    {
+        seen += _buckets[i].load(std::memory_order_relaxed);
+        if (seen >= wanted)
+            return std::min(GetBucketLimit(i), GetMax());
+    }
+
+    return GetMax();
+}
+
+uint32 TickHistogram::GetBucket(uint32 us)
+{
+    if (us < TICK_HISTOGRAM_SUB_BUCKETS)
+        return us;
+
+    uint32 exponent = TICK_HISTOGRAM_SUB_BUCKET_BITS;
+    while (exponent < 31 && (us >> (exponent + 1)))
+        ++exponent;
+
+    uint32 shift = exponent - TICK_HISTOGRAM_SUB_BUCKET_BITS;
+    uint32 subBucket = (us >> shift) & (TICK_HISTOGRAM_SUB_BUCKETS - 1);
+    return TICK_HISTOGRAM_SUB_BUCKETS * (shift + 1) + subBucket;
+}
+
+uint32 TickHistogram::GetBucketLimit(uint32 bucket)
+{
+    if (bucket < TICK_HISTOGRAM_SUB_BUCKETS)
+        return bucket;
+
+    uint32 shift = bucket / TICK_HISTOGRAM_SUB_BUCKETS - 1;
+    uint64 lower = uint64(TICK_HISTOGRAM_SUB_BUCKETS + bucket % TICK_HISTOGRAM_SUB_BUCKETS) << shift;
+    return uint32(lower + (uint64(1) << shift) - 1);
+}
+
+TickProfiler::TickProfiler() : _enabled(false), _dumpTimer(0), _ticks(0)
+{
+    _opcodes = new TickHistogram[NUM_OPCODES];
+    _tickOpcodeTime = new std::atomic<uint32>[NUM_OPCODES];
+    _tickOpcodeCount = new std::atomic<uint32>[NUM_OPCODES];
+
+    for (uint32 i = 0; i < NUM_OPCODES; ++i)
+    {
+        _tickOpcodeTime[i].store(0, std::memory_order_relaxed);
+        _tickOpcodeCount[i].store(0, std::memory_order_relaxed);
+    }
+
+    for (uint8 i = 0; i < MAX_TICK_SECTIONS; ++i)
+        _tickSections[i].store(0, std::memory_order_relaxed);
+
+    _intervalStart = Clock::now();
+}
+
+TickProfiler::~TickProfiler()
+{
+    for (std::map<uint32, TickHistogram*>::iterator itr = _maps.begin(); itr != _maps.end(); ++itr)
+        delete itr->second;
+
+    delete[] _opcodes;
+    delete[] _tickOpcodeTime;
+    delete[] _tickOpcodeCount;
+}
+
+void TickProfiler::BeginTick()
+{
+    bool enabled = sWorld->GetBoolConfig(WorldBoolConfigs::CONFIG_PROFILER_ENABLED);
+    if (enabled != IsEnabled())
+    {
+        _enabled.store(enabled, std::memory_order_relaxed);
+        Reset();
+    }
+
+    if (!enabled)
+        return;
+
+    for (uint8 i = 0; i < MAX_TICK_SECTIONS; ++i)
+        _tickSections[i].store(0, std::memory_order_relaxed);
+
+    for (uint32 i = 0; i < NUM_OPCODES; ++i)
+    {
+        if (_tickOpcodeCount[i].load(std::memory_order_relaxed))
+        {
+            _tickOpcodeTime[i].store(0, std::memory_order_relaxed);
+            _tickOpcodeCount[i].store(0, std::memory_order_relaxed);
+        }
+    }
+
+    _tickMaps.clear();
+    _tickStart = Clock::now();
+}
+
+void TickProfiler::EndTick(uint32 diff)
+{
+    if (!IsEnabled())
+        return;
+
+    uint32 us = uint32(std::chrono::duration_cast<std::chrono::microseconds>(Clock::now() - _tickStart).count());
+    Record(TICK_SECTION_WORLD, 0, 0, us);
+    ++_ticks;
+
+    uint32 threshold = sWorld->getIntConfig(WorldIntConfigs::CONFIG_PROFILER_SLOW_TICK_THRESHOLD);
+    if (threshold && us >= threshold * 1000)
+        CaptureSlowTick(us);
+
+    if (uint32 interval = sWorld->getIntConfig(WorldIntConfigs::CONFIG_PROFILER_DUMP_INTERVAL))
+    {
+        _dumpTimer += diff;
+        if (_dumpTimer >= interval * IN_MILLISECONDS)
+        {
+            Dump();
+            Reset();
+        }
+    }
+}
+
+void TickProfiler::Record(TickProfileSection section, uint32 id, uint32 instanceId, uint32 us)
+{
+    _sections[section].Add(us);
+    _tickSections[section].fetch_add(us, std::memory_order_relaxed);
+
+    if (section == TICK_SECTION_OPCODE)
+    {
+        if (id >= NUM_OPCODES)
+            return;
+
+        _opcodes[id].Add(us);
+        _tickOpcodeTime[id].fetch_add(us, std::memory_order_relaxed);
+        _tickOpcodeCount[id].fetch_add(1, std::memory_order_relaxed);
+    }
+    else if (section == TICK_SECTION_MAP)
+    {
+        std::lock_guard<std::mutex> lock(_mapLock);
+        TickHistogram*& histogram = _maps[id];
+        if (!histogram)
+            histogram = new TickHistogram();
+
+        histogram->Add(us);
+        _tickMaps.push_back(MapTickTime(id, instanceId, us));
+    }
+}
+
+void TickProfiler::BuildReport(std::vector<std::string>& lines, uint32 topCount)
+{
+    char line[256];
+    uint32 seconds = uint32(std::chrono::duration_cast<std::chrono::seconds>(Clock::now() - _intervalStart).count());
+    snprintf(line, sizeof(line), "Tick profile of the last %u s, %u ticks:", seconds, _ticks);
+    lines.push_back(line);
+    lines.push_back(TableHeader);
+
+    for (uint8 i = 0; i < MAX_TICK_SECTIONS; ++i)
+        lines.push_back(FormatHistogram(TickSectionNames[i], _sections[i]));
+
+    std::vector<std::pair<uint32, TickHistogram const*> > sorted;
+    {
+        std::lock_guard<std::mutex> lock(_mapLock);
+        for (std::map<uint32, TickHistogram*>::const_iterator itr = _maps.begin(); itr != _maps.end(); ++itr)
+            if (itr->second->GetCount())
+                sorted.push_back(std::make_pair(itr->first, itr->second));
+    }
+
+    std::sort(sorted.begin(), sorted.end(), HistogramTotalOrder());
+    if (sorted.size() > topCount)
+        sorted.resize(topCount);
+
+    snprintf(line, sizeof(line), "Top %u maps by total update time:", uint32(sorted.size()));
+    lines.push_back(line);
+    for (size_t i = 0; i < sorted.size(); ++i)
+    {
+        char name[32];
+        snprintf(name, sizeof(name), "map %u", sorted[i].first);
+        lines.push_back(FormatHistogram(name, *sorted[i].second));
+    }
+
+    sorted.clear();
+    for (uint32 i = 0; i < NUM_OPCODES; ++i)
+        if (_opcodes[i].GetCount())
+            sorted.push_back(std::make_pair(i, &_opcodes[i]));
+
+    std::sort(sorted.begin(), sorted.end(), HistogramTotalOrder());
+    if (sorted.size() > topCount)
+        sorted.resize(topCount);
+
+    snprintf(line, sizeof(line), "Top %u opcodes by total handler time:", uint32(sorted.size()));
+    lines.push_back(line);
+    for (size_t i = 0; i < sorted.size(); ++i)
+        lines.push_back(FormatHistogram(GetOpcodeName(sorted[i].first).c_str(), *sorted[i].second));
+
+    // memory usage next to the timings, a slow drift of one usually shows in the other
+    AllocatorStats allocator;
+    sAllocatorMgr->GetStats(allocator);
+    AllocatorMgr::BuildReport(allocator, false, lines);
+}
+
+void TickProfiler::GetLastSlowTick(std::vector<std::string>& lines)
+{
+    lines = _lastSlowTick;
+}
+
+void TickProfiler::Reset()
+{
+    for (uint8 i = 0; i < MAX_TICK_SECTIONS; ++i)
+        _sections[i].Reset();
+
+    for (uint32 i = 0; i < NUM_OPCODES; ++i)
+        if (_opcodes[i].GetCount())
+            _opcodes[i].Reset();
+
+    {
+        std::lock_guard<std::mutex> lock(_mapLock);
+        for (std::map<uint32, TickHistogram*>::iterator itr = _maps.begin(); itr != _maps.end(); ++itr)
+            itr->second->Reset();
+    }
+
+    _intervalStart = Clock::now();
+    _dumpTimer = 0;
+    _ticks = 0;
+}
+
+void TickProfiler::CaptureSlowTick(uint32 us)
+{
+    static uint32 const TopCount = 5;
+
+    char line[256];
+    _lastSlowTick.clear();
+
+    snprintf(line, sizeof(line), "Slow tick: %.1f ms, %u sessions online. Sections (map sections summed over all map threads):",
+        ToMS(us), sWorld->GetActiveSessionCount());
+    _lastSlowTick.push_back(line);
+
+    for (uint8 i = 0; i < MAX_TICK_SECTIONS; ++i)
+    {
+        uint64 sectionTime = _tickSections[i].load(std::memory_order_relaxed);
+        if (!sectionTime)
+            continue;
+
+        snprintf(line, sizeof(line), "  %-28s %9.1f ms", TickSectionNames[i], ToMS(sectionTime));
+        _lastSlowTick.push_back(line);
+    }
+
+    // map threads are done for this tick, the list can be used unlocked
+    std::vector<MapTickTime> maps;
+    maps.swap(_tickMaps);
+    std::sort(maps.begin(), maps.end(), TickTimeOrder());
+    if (maps.size() > TopCount)
+        maps.erase(maps.begin() + TopCount, maps.end());
+
+    for (size_t i = 0; i < maps.size(); ++i)
+    {
+        snprintf(line, sizeof(line), "  map %u instance %u %9.1f ms", maps[i].MapId, maps[i].InstanceId, ToMS(maps[i].Time));
+        _lastSlowTick.push_back(line);
+    }
+
+    std::vector<OpcodeTickTime> opcodes;
+    for (uint32 i = 0; i < NUM_OPCODES; ++i)
+        if (uint32 count = _tickOpcodeCount[i].load(std::memory_order_relaxed))
+            opcodes.push_back(OpcodeTickTime(i, count, _tickOpcodeTime[i].load(std::memory_order_relaxed)));
+
+    std::sort(opcodes.begin(), opcodes.end(), TickTimeOrder());
+    if (opcodes.size() > TopCount)
+        opcodes.erase(opcodes.begin() + TopCount, opcodes.end());
+
+    for (size_t i = 0; i < opcodes.size(); ++i)
+    {
+        snprintf(line, sizeof(line), "  %s x%u %9.1f ms", GetOpcodeName(opcodes[i].Opcode).c_str(), opcodes[i].Count, ToMS(opcodes[i].Time));
+        _lastSlowTick.push_back(line);
+    }
+
+    for (size_t i = 0; i < _lastSlowTick.size(); ++i)
+        SF_LOG_WARN("server.profiler", "%s", _lastSlowTick[i].c_str());
+}
+
+void TickProfiler::Dump()
+{
+    std::vector<std::string> lines;
+    BuildReport(lines, 10);
+
+    for (size_t i = 0; i < lines.size(); ++i)
+        SF_LOG_INFO("server.profiler", "%s", lines[i].c_str());
+}
@@ -0,0 +1,166 @@
+/*
+* This file is part of Project SkyFire https://www.projectskyfire.org.
+* See LICENSE.md file for Copyright information
+*/
+
+#ifndef SKYFIRE_TICKPROFILER_H
+#define SKYFIRE_TICKPROFILER_H
+
+#include "Define.h"
+
+#include <ace/Null_Mutex.h>
+#include <ace/Singleton.h>
+#include <atomic>
+#include <chrono>
+#include <map>
+#include <mutex>
+#include <string>
+#include <vector>
+
+enum TickProfileSection
+{
+    TICK_SECTION_WORLD,                                     // whole World::Update
+    TICK_SECTION_SESSIONS,                                  // World::UpdateSessions, thread unsafe packets included
+    TICK_SECTION_MAP_MANAGER,                               // MapManager::Update, all maps
+    TICK_SECTION_MAP,                                       // one Map::Update, id is the map id
+    TICK_SECTION_MAP_SESSIONS,                              // thread safe packets handled in Map::Update
+    TICK_SECTION_OBJECT_UPDATE,                             // player, cell and transport updates in Map::Update
+    TICK_SECTION_RELOCATION_NOTIFY,                         // Map::ProcessRelocationNotifies
+    TICK_SECTION_OBJECT_ACCESSOR,                           // ObjectAccessor::Update
+    TICK_SECTION_BATTLEGROUNDS,
+    TICK_SECTION_OUTDOOR_PVP,
+    TICK_SECTION_BATTLEFIELDS,
+    TICK_SECTION_LFG,
+    TICK_SECTION_QUERY_CALLBACKS,                           // world and session database callbacks
+    TICK_SECTION_OPCODE,                                    // one client packet handler, id is the opcode
+    TICK_SECTION_ALLOCATOR_PURGE,                           // periodic AllocatorMgr::Purge
+
+    MAX_TICK_SECTIONS
+};
+
+/// Log-linear histogram of durations in microseconds, in the spirit of HdrHistogram:
+/// every power of two is split into TICK_HISTOGRAM_SUB_BUCKETS buckets, so any recorded value
+/// is known within 1/8 of itself. Adding is lock free and may happen from several map threads.
+#define TICK_HISTOGRAM_SUB_BUCKET_BITS  3
+#define TICK_HISTOGRAM_SUB_BUCKETS      (1 << TICK_HISTOGRAM_SUB_BUCKET_BITS)
+#define TICK_HISTOGRAM_BUCKETS          (TICK_HISTOGRAM_SUB_BUCKETS * (32 - TICK_HISTOGRAM_SUB_BUCKET_BITS + 1))
+
+class TickHistogram
+{
+public:
+    TickHistogram() { Reset(); }
+
+    void Add(uint32 us);
+    void Reset();
+
+    uint32 GetCount() const { return _count.load(std::memory_order_relaxed); }
+    uint64 GetTotal() const { return _total.load(std::memory_order_relaxed); }
+    uint32 GetMax() const { return _max.load(std::memory_order_relaxed); }
+
+    /// upper bound of the bucket holding the given percentile, capped to the largest value seen
+    uint32 GetPercentile(float percent) const;
+
+private:
+    static uint32 GetBucket(uint32 us);
+    static uint32 GetBucketLimit(uint32 bucket);
+
+    std::atomic<uint32> _buckets[TICK_HISTOGRAM_BUCKETS];
+    std::atomic<uint32> _count;
+    std::atomic<uint64> _total;
+    std::atomic<uint32> _max;
+};
+
+/// Always-on timing of the world tick. Scoped timers feed one histogram per section, per map id
+/// and per client opcode; the world thread dumps and resets them every Profiler.DumpInterval.
+/// Besides the histograms the cost of the running tick is kept per section, map instance and
+/// opcode, and logged as a whole when the tick takes longer than Profiler.SlowTickThreshold.
+/// BeginTick() and EndTick() run on the world thread while no map is being updated.
+class TickProfiler
+{
+    friend class ACE_Singleton<TickProfiler, ACE_Null_Mutex>;
+
+public:
+    typedef std::chrono::steady_clock Clock;
+
+    bool IsEnabled() const { return _enabled.load(std::memory_order_relaxed); }
+
+    void BeginTick();
+    void EndTick(uint32 diff);
+
+    void Record(TickProfileSection section, uint32 id, uint32 instanceId, uint32 us);
+
+    /// Human readable tables of everything recorded since the last dump or reset
+    void BuildReport(std::vector<std::string>& lines, uint32 topCount);
+    /// Breakdown of the last tick that exceeded the slow tick threshold
+    void GetLastSlowTick(std::vector<std::string>& lines);
+    void Reset();
+
+private:
+    TickProfiler();
+    ~TickProfiler();
+
+    struct MapTickTime
+    {
+        MapTickTime(uint32 mapId, uint32 instanceId, uint32 us) : MapId(mapId), InstanceId(instanceId), Time(us) { }
+
+        uint32 MapId;
+        uint32 InstanceId;
+        uint32 Time;
+    };
+
+    void CaptureSlowTick(uint32 us);
+    void Dump();
+
+    std::atomic<bool> _enabled;
+    Clock::time_point _tickStart;
+    Clock::time_point _intervalStart;
+    uint32 _dumpTimer;
+    uint32 _ticks;
+
+    TickHistogram _sections[MAX_TICK_SECTIONS];
+    TickHistogram* _opcodes;                                // NUM_OPCODES entries
+
+    std::mutex _mapLock;
+    std::map<uint32, TickHistogram*> _maps;
+    std::vector<MapTickTime> _tickMaps;
+
+    // cost of the running tick
+    std::atomic<uint64> _tickSections[MAX_TICK_SECTIONS];
+    std::atomic<uint32>* _tickOpcodeTime;                   // NUM_OPCODES entries
+    std::atomic<uint32>* _tickOpcodeCount;                  // NUM_OPCODES entries
+
+    std::vector<std::string> _lastSlowTick;
+};
+
+#define sTickProfiler ACE_Singleton<TickProfiler, ACE_Null_Mutex>::instance()
+
+/// Adds the time spent between construction and destruction to a profiler section
+class TickProfileScope
+{
+public:
+    explicit TickProfileScope(TickProfileSection section, uint32 id = 0, uint32 instanceId = 0)
+        : _section(section), _id(id), _instanceId(instanceId), _active(sTickProfiler->IsEnabled())
+    {
+        if (_active)
+            _start = TickProfiler::Clock::now();
+    }
+
+    ~TickProfileScope()
+    {
+        if (_active)
+            sTickProfiler->Record(_section, _id, _instanceId,
+                uint32(std::chrono::duration_cast<std::chrono::microseconds>(TickProfiler::Clock::now() - _start).count()));
+    }
+
+private:
+    TickProfileScope(TickProfileScope const&);
+    TickProfileScope& operator=(TickProfileScope const&);
+
+    TickProfileSection _section;
+    uint32 _id;
+    uint32 _instanceId;
+    bool _active;
+    TickProfiler::Clock::time_point _start;
+};
+
+#endif
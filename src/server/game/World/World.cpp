@@ -10,6 +10,7 @@
 #include "AccountMgr.h"
 #include "AchievementMgr.h"
 #include "AddonMgr.h"
+#include "AllocatorMgr.h"
 #include "ArenaTeamMgr.h"
 #include "AuctionHouseMgr.h"
 #include "BattlefieldMgr.h"
@@ -47,18 +48,22 @@
 #include "Memory.h"
 #include "MMapFactory.h"
 #include "ObjectMgr.h"
+#include "OpcodeMonitor.h"
 #include "Opcodes.h"
 #include "OutdoorPvPMgr.h"
 #include "Player.h"
 #include "PoolMgr.h"
+#include "QueryResponseCache.h"
 #include "ScriptMgr.h"
 #include "ScriptMgr.h"
 #include "SkillDiscovery.h"
 #include "SkillExtraItems.h"
 #include "SmartAI.h"
 #include "SpellMgr.h"
+#include "StartupLoader.h"
 #include "SystemConfig.h"
 #include "TemporarySummon.h"
+#include "TickProfiler.h"
 #include "TicketMgr.h"
 #include "Transport.h"
 #include "TransportMgr.h"
@@ -972,6 +977,7 @@ void World::LoadConfigSettings(bool reload)
     }
 
     SetBoolConfig(WorldBoolConfigs::CONFIG_SAVE_RESPAWN_TIME_IMMEDIATELY, sConfigMgr->GetBoolDefault("SaveRespawnTimeImmediately", true));
+    setIntConfig(WorldIntConfigs::CONFIG_RESPAWN_SAVE_INTERVAL, sConfigMgr->GetIntDefault("SaveRespawnTimeInterval", 0));
     SetBoolConfig(WorldBoolConfigs::CONFIG_WEATHER, sConfigMgr->GetBoolDefault("ActivateWeather", true));
 
     setIntConfig(WorldIntConfigs::CONFIG_DISABLE_BREATHING, sConfigMgr->GetIntDefault("DisableWaterBreath", uint8(AccountTypes::SEC_CONSOLE)));
@@ -1212,6 +1218,8 @@ void World::LoadConfigSettings(bool reload)
     }
 
     SetBoolConfig(WorldBoolConfigs::CONFIG_ENABLE_MMAPS, sConfigMgr->GetBoolDefault("mmap.enablePathFinding", false));
+    setIntConfig(WorldIntConfigs::CONFIG_PATH_CACHE_LIFETIME, sConfigMgr->GetIntDefault("mmap.PathCacheLifetime", 0));
+    setIntConfig(WorldIntConfigs::CONFIG_FLOW_FIELD_CHASERS, sConfigMgr->GetIntDefault("mmap.FlowFieldChasers", 0));
     SF_LOG_INFO("server.loading", "WORLD: MMap data directory is: %smmaps", m_dataPath.c_str());
 
     SetBoolConfig(WorldBoolConfigs::CONFIG_VMAP_INDOOR_CHECK, sConfigMgr->GetBoolDefault("vmap.enableIndoorCheck", 0));
@@ -1246,7 +1254,17 @@ void World::LoadConfigSettings(bool reload)
     SetBoolConfig(WorldBoolConfigs::CONFIG_SHOW_KICK_IN_WORLD, sConfigMgr->GetBoolDefault("ShowKickInWorld", false));
     setIntConfig(WorldIntConfigs::CONFIG_INTERVAL_LOG_UPDATE, sConfigMgr->GetIntDefault("RecordUpdateTimeDiffInterval", 60000));
     setIntConfig(WorldIntConfigs::CONFIG_MIN_LOG_UPDATE, sConfigMgr->GetIntDefault("MinRecordUpdateTimeDiff", 100));
+    SetBoolConfig(WorldBoolConfigs::CONFIG_PROFILER_ENABLED, sConfigMgr->GetBoolDefault("Profiler.Enable", true));
+    setIntConfig(WorldIntConfigs::CONFIG_PROFILER_SLOW_TICK_THRESHOLD, sConfigMgr->GetIntDefault("Profiler.SlowTickThreshold", 200));
+    setIntConfig(WorldIntConfigs::CONFIG_PROFILER_DUMP_INTERVAL, sConfigMgr->GetIntDefault("Profiler.DumpInterval", 0));
+    SetBoolConfig(WorldBoolConfigs::CONFIG_MEMORY_MAP_THREAD_ARENAS, sConfigMgr->GetBoolDefault("Memory.MapThreadArenas", false));
+    setIntConfig(WorldIntConfigs::CONFIG_MEMORY_PURGE_INTERVAL, sConfigMgr->GetIntDefault("Memory.PurgeInterval", 0));
+    setIntConfig(WorldIntConfigs::CONFIG_MEMORY_PURGE_MAX_UPDATE_DIFF, sConfigMgr->GetIntDefault("Memory.PurgeMaxUpdateDiff", 100));
     setIntConfig(WorldIntConfigs::CONFIG_NUMTHREADS, sConfigMgr->GetIntDefault("MapUpdate.Threads", 1));
+    setIntConfig(WorldIntConfigs::CONFIG_STARTUP_LOADER_THREADS, sConfigMgr->GetIntDefault("Startup.LoaderThreads", 1));
+    setIntConfig(WorldIntConfigs::CONFIG_LOGIN_QUERY_PARALLELISM, sConfigMgr->GetIntDefault("CharacterDatabase.LoginQueryParallelism", 1));
+    SetBoolConfig(WorldBoolConfigs::CONFIG_MOVEMENT_BROADCAST_AGGREGATE, sConfigMgr->GetBoolDefault("Movement.Broadcast.Aggregate", false));
+    setIntConfig(WorldIntConfigs::CONFIG_MOVEMENT_BROADCAST_MAX_DELAY, sConfigMgr->GetIntDefault("Movement.Broadcast.MaxDelay", 0));
     setIntConfig(WorldIntConfigs::CONFIG_MAX_RESULTS_LOOKUP_COMMANDS, sConfigMgr->GetIntDefault("Command.LookupMaxResults", 0));
 
     // chat logging
@@ -1321,6 +1339,7 @@ void World::LoadConfigSettings(bool reload)
     SetBoolConfig(WorldBoolConfigs::CONFIG_PDUMP_NO_PATHS, sConfigMgr->GetBoolDefault("PlayerDump.DisallowPaths", true));
     SetBoolConfig(WorldBoolConfigs::CONFIG_PDUMP_NO_OVERWRITE, sConfigMgr->GetBoolDefault("PlayerDump.DisallowOverwrite", true));
     SetBoolConfig(WorldBoolConfigs::CONFIG_UI_QUESTLEVELS_IN_DIALOGS, sConfigMgr->GetBoolDefault("UI.ShowQuestLevelsInDialogs", false));
+    sQueryResponseCache->Invalidate(QUERY_RESPONSE_QUEST);  // quest titles depend on it
 
     // Wintergrasp battlefield
     SetBoolConfig(WorldBoolConfigs::CONFIG_WINTERGRASP_ENABLE, sConfigMgr->GetBoolDefault("Wintergrasp.Enable", false));
@@ -1346,6 +1365,11 @@ void World::LoadConfigSettings(bool reload)
 
     setIntConfig(WorldIntConfigs::CONFIG_PACKET_SPOOF_BANDURATION, sConfigMgr->GetIntDefault("PacketSpoof.BanDuration", 86400));
 
+    // per opcode packet rate limits, the opcode table is not there yet on startup
+    SetBoolConfig(WorldBoolConfigs::CONFIG_PACKET_RATE_LIMIT_KICK, sConfigMgr->GetBoolDefault("PacketRateLimit.Kick", false));
+    if (reload)
+        sOpcodeMonitor->LoadRateLimits();
+
     // call ScriptMgr if we're reloading the configuration
     if (reload)
         sScriptMgr->OnConfigLoad(reload);
@@ -1439,6 +1463,9 @@ void World::SetInitialWorldSettings()
     SF_LOG_INFO("server.loading", "Loading SpellInfo custom attributes...");
     sSpellMgr->LoadSpellInfoCustomAttributes();
 
+    SF_LOG_INFO("server.loading", "Loading SpellInfo hot data...");
+    sSpellMgr->LoadSpellInfoHotData();                          // must be after all SpellInfo corrections
+
     SF_LOG_INFO("server.loading", "Loading GameObject models...");
     LoadGameObjectModelList(m_dataPath);
 
@@ -1452,16 +1479,23 @@ void World::SetInitialWorldSettings()
     SF_LOG_INFO("server.loading", "Loading instances...");
     sInstanceSaveMgr->LoadInstances();
 
+    uint32 loaderThreads = getIntConfig(WorldIntConfigs::CONFIG_STARTUP_LOADER_THREADS);
+
     SF_LOG_INFO("server.loading", "Loading Localization strings...");
     uint32 oldMSTime = getMSTime();
-    sObjectMgr->LoadCreatureLocales();
-    sObjectMgr->LoadGameObjectLocales();
-    sObjectMgr->LoadItemLocales();
-    sObjectMgr->LoadQuestLocales();
-    sObjectMgr->LoadNpcTextLocales();
-    sObjectMgr->LoadPageTextLocales();
-    sObjectMgr->LoadGossipMenuItemsLocales();
-    sObjectMgr->LoadPointOfInterestLocales();
+    {
+        // every locale table has its own store
+        StartupLoader loader;
+        loader.AddTask("LoadCreatureLocales", sObjectMgr, &ObjectMgr::LoadCreatureLocales);
+        loader.AddTask("LoadGameObjectLocales", sObjectMgr, &ObjectMgr::LoadGameObjectLocales);
+        loader.AddTask("LoadItemLocales", sObjectMgr, &ObjectMgr::LoadItemLocales);
+        loader.AddTask("LoadQuestLocales", sObjectMgr, &ObjectMgr::LoadQuestLocales);
+        loader.AddTask("LoadNpcTextLocales", sObjectMgr, &ObjectMgr::LoadNpcTextLocales);
+        loader.AddTask("LoadPageTextLocales", sObjectMgr, &ObjectMgr::LoadPageTextLocales);
+        loader.AddTask("LoadGossipMenuItemsLocales", sObjectMgr, &ObjectMgr::LoadGossipMenuItemsLocales);
+        loader.AddTask("LoadPointOfInterestLocales", sObjectMgr, &ObjectMgr::LoadPointOfInterestLocales);
+        loader.Run(loaderThreads);
+    }
 
     sObjectMgr->SetDBCLocaleIndex(GetDefaultDbcLocale());        // Get once for all the locale index of DBC language (console/broadcasts)
     SF_LOG_INFO("server.loading", ">> Localization strings loaded in %u ms", GetMSTimeDiffToNow(oldMSTime));
@@ -1541,20 +1575,17 @@ void World::SetInitialWorldSettings()
     SF_LOG_INFO("server.loading", "Loading Creature template addons...");
     sObjectMgr->LoadCreatureTemplateAddons();
 
-    SF_LOG_INFO("server.loading", "Loading Reputation Reward Rates...");
-    sObjectMgr->LoadReputationRewardRate();
-
-    SF_LOG_INFO("server.loading", "Loading Creature Reputation OnKill Data...");
-    sObjectMgr->LoadReputationOnKill();
-
-    SF_LOG_INFO("server.loading", "Loading Reputation Spillover Data...");
-    sObjectMgr->LoadReputationSpilloverTemplate();
-
-    SF_LOG_INFO("server.loading", "Loading Points Of Interest Data...");
-    sObjectMgr->LoadPointsOfInterest();
-
-    SF_LOG_INFO("server.loading", "Loading Creature Base Stats...");
-    sObjectMgr->LoadCreatureClassLevelStats();
+    SF_LOG_INFO("server.loading", "Loading Reputation, Points Of Interest and Creature Base Stats...");
+    {
+        // only read creature templates and DBC stores besides their own tables
+        StartupLoader loader;
+        loader.AddTask("LoadReputationRewardRate", sObjectMgr, &ObjectMgr::LoadReputationRewardRate);
+        loader.AddTask("LoadReputationOnKill", sObjectMgr, &ObjectMgr::LoadReputationOnKill);
+        loader.AddTask("LoadReputationSpilloverTemplate", sObjectMgr, &ObjectMgr::LoadReputationSpilloverTemplate);
+        loader.AddTask("LoadPointsOfInterest", sObjectMgr, &ObjectMgr::LoadPointsOfInterest);
+        loader.AddTask("LoadCreatureClassLevelStats", sObjectMgr, &ObjectMgr::LoadCreatureClassLevelStats);
+        loader.Run(loaderThreads);
+    }
 
     SF_LOG_INFO("server.loading", "Loading Creature Data...");
     sObjectMgr->LoadCreatures();
@@ -1688,7 +1719,28 @@ void World::SetInitialWorldSettings()
     sObjectMgr->LoadMailLevelRewards();
 
     // Loot tables
-    LoadLootTables();
+    {
+        // reference loot is checked against all other loot stores
+        StartupLoader loader;
+        std::vector<uint32> lootTasks;
+        lootTasks.push_back(loader.AddTask("LoadLootTemplates_Creature", &LoadLootTemplates_Creature));
+        lootTasks.push_back(loader.AddTask("LoadLootTemplates_Fishing", &LoadLootTemplates_Fishing));
+        lootTasks.push_back(loader.AddTask("LoadLootTemplates_Gameobject", &LoadLootTemplates_Gameobject));
+        lootTasks.push_back(loader.AddTask("LoadLootTemplates_Item", &LoadLootTemplates_Item));
+        lootTasks.push_back(loader.AddTask("LoadLootTemplates_Mail", &LoadLootTemplates_Mail));
+        lootTasks.push_back(loader.AddTask("LoadLootTemplates_Milling", &LoadLootTemplates_Milling));
+        lootTasks.push_back(loader.AddTask("LoadLootTemplates_Pickpocketing", &LoadLootTemplates_Pickpocketing));
+        lootTasks.push_back(loader.AddTask("LoadLootTemplates_Skinning", &LoadLootTemplates_Skinning));
+        lootTasks.push_back(loader.AddTask("LoadLootTemplates_Disenchant", &LoadLootTemplates_Disenchant));
+        lootTasks.push_back(loader.AddTask("LoadLootTemplates_Prospecting", &LoadLootTemplates_Prospecting));
+        lootTasks.push_back(loader.AddTask("LoadLootTemplates_Spell", &LoadLootTemplates_Spell));
+
+        uint32 referenceTask = loader.AddTask("LoadLootTemplates_Reference", &LoadLootTemplates_Reference);
+        for (std::vector<uint32>::const_iterator itr = lootTasks.begin(); itr != lootTasks.end(); ++itr)
+            loader.AddDependency(referenceTask, *itr);
+
+        loader.Run(loaderThreads);
+    }
 
     SF_LOG_INFO("server.loading", "Loading Skill Discovery Table...");
     LoadSkillDiscoveryTable();
@@ -1980,6 +2032,7 @@ void World::SetInitialWorldSettings()
     SF_LOG_INFO("misc", "Initializing Opcodes...");
     serverOpcodeTable.InitializeServerTable();
     clientOpcodeTable.InitializeClientTable();
+    sOpcodeMonitor->LoadRateLimits();
 
     SF_LOG_INFO("misc", "Loading hotfix info...");
     sObjectMgr->LoadHotfixData();
@@ -1990,6 +2043,8 @@ void World::SetInitialWorldSettings()
     SF_LOG_INFO("server.loading", "Loading missing KeyChains...");
     sObjectMgr->LoadMissingKeyChains();
 
+    StartupLoader::LogTimings(10);
+
     uint32 startupDuration = GetMSTimeDiffToNow(startupBegin);
 
     SF_LOG_INFO("server.worldserver", "World initialized in %u minutes %u seconds", (startupDuration / 60000), ((startupDuration % 60000) / 1000));
@@ -2065,6 +2120,7 @@ void World::LoadAutobroadcasts()
 void World::Update(uint32 diff)
 {
     m_updateTime = diff;
+    sTickProfiler->BeginTick();
 
     if (getIntConfig(WorldIntConfigs::CONFIG_INTERVAL_LOG_UPDATE) && diff > getIntConfig(WorldIntConfigs::CONFIG_MIN_LOG_UPDATE))
     {
@@ -2153,7 +2209,10 @@ void World::Update(uint32 diff)
 
     /// <li> Handle session updates when the timer has passed
     RecordTimeDiff(NULL);
-    UpdateSessions(diff);
+    {
+        TickProfileScope profile(TICK_SECTION_SESSIONS);
+        UpdateSessions(diff);
+    }
     RecordTimeDiff("UpdateSessions");
 
     /// <li> Handle weather updates when the timer has passed
@@ -2203,7 +2262,10 @@ void World::Update(uint32 diff)
     /// <li> Handle all other objects
     ///- Update objects when the timer has passed (maps, transport, creatures, ...)
     RecordTimeDiff(NULL);
-    sMapMgr->Update(diff);
+    {
+        TickProfileScope profile(TICK_SECTION_MAP_MANAGER);
+        sMapMgr->Update(diff);
+    }
     RecordTimeDiff("UpdateMapMgr");
 
     if (sWorld->GetBoolConfig(WorldBoolConfigs::CONFIG_AUTOBROADCAST))
@@ -2215,13 +2277,22 @@ void World::Update(uint32 diff)
         }
     }
 
-    sBattlegroundMgr->Update(diff);
+    {
+        TickProfileScope profile(TICK_SECTION_BATTLEGROUNDS);
+        sBattlegroundMgr->Update(diff);
+    }
     RecordTimeDiff("UpdateBattlegroundMgr");
 
-    sOutdoorPvPMgr->Update(diff);
+    {
+        TickProfileScope profile(TICK_SECTION_OUTDOOR_PVP);
+        sOutdoorPvPMgr->Update(diff);
+    }
     RecordTimeDiff("UpdateOutdoorPvPMgr");
 
-    sBattlefieldMgr->Update(diff);
+    {
+        TickProfileScope profile(TICK_SECTION_BATTLEFIELDS);
+        sBattlefieldMgr->Update(diff);
+    }
     RecordTimeDiff("BattlefieldMgr");
 
     ///- Delete all characters which have been deleted X days before
@@ -2231,11 +2302,17 @@ void World::Update(uint32 diff)
         Player::DeleteOldCharacters();
     }
 
-    sLFGMgr->Update(diff);
+    {
+        TickProfileScope profile(TICK_SECTION_LFG);
+        sLFGMgr->Update(diff);
+    }
     RecordTimeDiff("UpdateLFGMgr");
 
     // execute callbacks from sql queries that were queued recently
-    ProcessQueryCallbacks();
+    {
+        TickProfileScope profile(TICK_SECTION_QUERY_CALLBACKS);
+        ProcessQueryCallbacks();
+    }
     RecordTimeDiff("ProcessQueryCallbacks");
 
     ///- Erase corpses once every 20 minutes
@@ -2273,10 +2350,15 @@ void World::Update(uint32 diff)
     // update the instance reset times
     sInstanceSaveMgr->Update();
 
+    // give dirty allocator pages back to the system while the server is quiet
+    sAllocatorMgr->Update(diff);
+
     // And last, but not least handle the issued cli commands
     ProcessCliCommands();
 
     sScriptMgr->OnWorldUpdate(diff);
+
+    sTickProfiler->EndTick(diff);
 }
 
 void World::ForceGameEventUpdate()
@@ -2602,14 +2684,9 @@ BanReturn World::BanCharacter(std::string const& name, std::string const& durati
     /// Pick a player to ban if not online
     if (!pBanned)
     {
-        PreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_SEL_GUID_BY_NAME);
-        stmt->setString(0, name);
-        PreparedQueryResult resultCharacter = CharacterDatabase.Query(stmt);
-
-        if (!resultCharacter)
+        guid = GetCharacterGuidByName(name);
+        if (!guid)
             return BAN_NOTFOUND;                                    // Nobody to ban
-
-        guid = (*resultCharacter)[0].GetUInt32();
     }
     else
         guid = pBanned->GetGUIDLow();
@@ -2641,14 +2718,9 @@ bool World::RemoveBanCharacter(std::string const& name)
     /// Pick a player to ban if not online
     if (!pBanned)
     {
-        PreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_SEL_GUID_BY_NAME);
-        stmt->setString(0, name);
-        PreparedQueryResult resultCharacter = CharacterDatabase.Query(stmt);
-
-        if (!resultCharacter)
+        guid = GetCharacterGuidByName(name);
+        if (!guid)
             return false;
-
-        guid = (*resultCharacter)[0].GetUInt32();
     }
     else
         guid = pBanned->GetGUIDLow();
@@ -3366,6 +3438,7 @@ void World::LoadCharacterNameData()
 void World::AddCharacterNameData(uint32 guid, std::string const& name, uint8 gender, uint8 race, uint8 playerClass, uint8 level, uint32 realm)
 {
     CharacterNameData& data = _characterNameDataMap[guid];
+    SetCharacterGuidByName(guid, data.m_name, name);
     data.m_realm = realm;
     data.m_name = name;
     data.m_race = race;
@@ -3380,6 +3453,7 @@ void World::UpdateCharacterNameData(uint32 guid, std::string const& name, uint8
     if (itr == _characterNameDataMap.end())
         return;
 
+    SetCharacterGuidByName(guid, itr->second.m_name, name);
     itr->second.m_realm = realm;
     itr->second.m_name = name;
 
@@ -3408,6 +3482,57 @@ CharacterNameData const* World::GetCharacterNameData(uint32 guid) const
         return NULL;
 }
 
+void World::DeleteCharacterNameData(uint32 guid)
+{
+    std::map<uint32, CharacterNameData>::iterator itr = _characterNameDataMap.find(guid);
+    if (itr == _characterNameDataMap.end())
+        return;
+
+    SetCharacterGuidByName(guid, itr->second.m_name, "");
+    _characterNameDataMap.erase(itr);
+}
+
+/**
+* Returns the low guid of the (not deleted) character with the given name, or 0.
+* Names are compared case insensitive, like the characters table does.
+**/
+uint32 World::GetCharacterGuidByName(std::string const& name) const
+{
+    UNORDERED_MAP<std::string, uint32>::const_iterator itr = _characterGuidByNameMap.find(GetCharacterNameKey(name));
+    if (itr != _characterGuidByNameMap.end())
+        return itr->second;
+
+    return 0;
+}
+
+std::string World::GetCharacterNameKey(std::string const& name)
+{
+    std::wstring wname;
+    if (!Utf8toWStr(name, wname))
+        return name;
+
+    wstrToLower(wname);
+
+    std::string key;
+    if (!WStrToUtf8(wname, key))
+        return name;
+
+    return key;
+}
+
+void World::SetCharacterGuidByName(uint32 guid, std::string const& oldName, std::string const& newName)
+{
+    if (!oldName.empty())
+    {
+        UNORDERED_MAP<std::string, uint32>::iterator itr = _characterGuidByNameMap.find(GetCharacterNameKey(oldName));
+        if (itr != _characterGuidByNameMap.end() && itr->second == guid)
+            _characterGuidByNameMap.erase(itr);
+    }
+
+    if (!newName.empty())
+        _characterGuidByNameMap[GetCharacterNameKey(newName)] = guid;
+}
+
 void World::ReloadRBAC()
 {
     // Passive reload, we mark the data as invalidated and next time a permission is checked it will be reloaded
@@ -166,6 +166,10 @@ enum class WorldBoolConfigs
     CONFIG_TICKETS_GM_ENABLED,
     CONFIG_TICKETS_FEEDBACK_SYSTEM_ENABLED,
     CONFIG_BOOST_NEW_ACCOUNT,
+    CONFIG_MOVEMENT_BROADCAST_AGGREGATE,
+    CONFIG_PROFILER_ENABLED,
+    CONFIG_PACKET_RATE_LIMIT_KICK,
+    CONFIG_MEMORY_MAP_THREAD_ARENAS,
     BOOL_CONFIG_VALUE_COUNT
 };
 
@@ -360,6 +364,16 @@ enum class WorldIntConfigs
     CONFIG_BLACK_MARKET_AUCTION_DELAY_MOD,
     CONFIG_BOOST_START_MONEY,
     CONFIG_BOOST_START_LEVEL,
+    CONFIG_MOVEMENT_BROADCAST_MAX_DELAY,
+    CONFIG_RESPAWN_SAVE_INTERVAL,
+    CONFIG_PATH_CACHE_LIFETIME,
+    CONFIG_FLOW_FIELD_CHASERS,
+    CONFIG_STARTUP_LOADER_THREADS,
+    CONFIG_LOGIN_QUERY_PARALLELISM,
+    CONFIG_PROFILER_SLOW_TICK_THRESHOLD,
+    CONFIG_PROFILER_DUMP_INTERVAL,
+    CONFIG_MEMORY_PURGE_INTERVAL,
+    CONFIG_MEMORY_PURGE_MAX_UPDATE_DIFF,
     INT_CONFIG_VALUE_COUNT
 };
 
@@ -784,8 +798,9 @@ public:
     void AddCharacterNameData(uint32 guid, std::string const& name, uint8 gender, uint8 race, uint8 playerClass, uint8 level, uint32 realm);
     void UpdateCharacterNameData(uint32 guid, std::string const& name, uint8 gender = GENDER_NONE, uint8 race = RACE_NONE, uint32 realm = -1);
     void UpdateCharacterNameDataLevel(uint32 guid, uint8 level);
-    void DeleteCharacterNameData(uint32 guid) { _characterNameDataMap.erase(guid); }
+    void DeleteCharacterNameData(uint32 guid);
     bool HasCharacterNameData(uint32 guid) { return _characterNameDataMap.find(guid) != _characterNameDataMap.end(); }
+    uint32 GetCharacterGuidByName(std::string const& name) const;
 
     uint32 GetCleaningFlags() const { return m_CleaningFlags; }
     void   SetCleaningFlags(uint32 flags) { m_CleaningFlags = flags; }
@@ -890,7 +905,10 @@ private:
     AutobroadcastsWeightMap m_AutobroadcastsWeights;
 
     std::map<uint32, CharacterNameData> _characterNameDataMap;
+    UNORDERED_MAP<std::string, uint32> _characterGuidByNameMap;   // lowercased name -> guid, kept in sync with _characterNameDataMap
     void LoadCharacterNameData();
+    static std::string GetCharacterNameKey(std::string const& name);
+    void SetCharacterGuidByName(uint32 guid, std::string const& oldName, std::string const& newName);
 
     void ProcessQueryCallbacks();
     ACE_Future_Set<PreparedQueryResult> m_realmCharCallbacks;
@@ -263,17 +263,12 @@ public:
 
         if (!target)
         {
-            PreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_SEL_GUID_BY_NAME);
-            stmt->setString(0, name);
-            PreparedQueryResult resultCharacter = CharacterDatabase.Query(stmt);
-
-            if (!resultCharacter)
+            targetGuid = sWorld->GetCharacterGuidByName(name);
+            if (!targetGuid)
             {
                 handler->PSendSysMessage(LANG_BANINFO_NOCHARACTER);
                 return false;
             }
-
-            targetGuid = (*resultCharacter)[0].GetUInt32();
         }
         else
             targetGuid = target->GetGUIDLow();
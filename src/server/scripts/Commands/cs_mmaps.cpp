@@ -18,6 +18,7 @@
 #include "Map.h"
 #include "MMapFactory.h"
 #include "ObjectMgr.h"
+#include "PathCache.h"
 #include "PathGenerator.h"
 #include "Player.h"
 #include "PointMovementGenerator.h"
@@ -199,6 +200,7 @@ public:
 
         MMAP::MMapManager* manager = MMAP::MMapFactory::createOrGetMMapManager();
         handler->PSendSysMessage(" %u maps loaded with %u tiles overall", manager->getLoadedMapsCount(), manager->getLoadedTilesCount());
+        handler->PSendSysMessage(" path cache: " UI64FMTD " hits, " UI64FMTD " misses since startup", PathCache::GetHits(), PathCache::GetMisses());
 
         dtNavMesh const* navmesh = manager->GetNavMesh(handler->GetSession()->GetPlayer()->GetMapId(), handler->GetSession()->GetPlayer()->GetTerrainSwaps());
         if (!navmesh)
@@ -21,6 +21,7 @@ EndScriptData */
 #include "LFGMgr.h"
 #include "MapManager.h"
 #include "ObjectMgr.h"
+#include "QueryResponseCache.h"
 #include "ScriptMgr.h"
 #include "SkillDiscovery.h"
 #include "SkillExtraItems.h"
@@ -515,6 +516,7 @@ public:
             sObjectMgr->CheckCreatureTemplate(cInfo);
         }
 
+        sQueryResponseCache->Invalidate(QUERY_RESPONSE_CREATURE);
         handler->SendGlobalGMSysMessage("Creature template reloaded.");
         return true;
     }
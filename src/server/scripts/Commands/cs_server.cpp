@@ -10,13 +10,18 @@ Comment: All server related commands
 Category: commandscripts
 EndScriptData */
 
+#include "AllocatorMgr.h"
 #include "Chat.h"
 #include "Config.h"
 #include "Language.h"
+#include "Map.h"
 #include "ObjectAccessor.h"
+#include "ObjectPool.h"
+#include "OpcodeMonitor.h"
 #include "Player.h"
 #include "ScriptMgr.h"
 #include "SystemConfig.h"
+#include "TickProfiler.h"
 
 class server_commandscript : public CommandScript
 {
@@ -37,6 +42,26 @@ public:
             { ""   ,    rbac::RBAC_PERM_COMMAND_SERVER_IDLESHUTDOWN,        true, &HandleServerIdleShutDownCommand,   "", },
         };
 
+        static std::vector<ChatCommand> serverMemoryCommandTable =
+        {
+            { "purge", rbac::RBAC_PERM_COMMAND_SERVER_MEMORY_PURGE, true, &HandleServerMemoryPurgeCommand, "", },
+            { "",      rbac::RBAC_PERM_COMMAND_SERVER_MEMORY,       true, &HandleServerMemoryCommand,      "", },
+        };
+
+        static std::vector<ChatCommand> serverOpcodesCommandTable =
+        {
+            { "player", rbac::RBAC_PERM_COMMAND_SERVER_OPCODES_PLAYER, true, &HandleServerOpcodesPlayerCommand, "", },
+            { "reset",  rbac::RBAC_PERM_COMMAND_SERVER_OPCODES_RESET,  true, &HandleServerOpcodesResetCommand,  "", },
+            { "",       rbac::RBAC_PERM_COMMAND_SERVER_OPCODES,        true, &HandleServerOpcodesCommand,       "", },
+        };
+
+        static std::vector<ChatCommand> serverProfileCommandTable =
+        {
+            { "reset", rbac::RBAC_PERM_COMMAND_SERVER_PROFILE_RESET, true, &HandleServerProfileResetCommand, "", },
+            { "slow",  rbac::RBAC_PERM_COMMAND_SERVER_PROFILE_SLOW,  true, &HandleServerProfileSlowCommand,  "", },
+            { "",      rbac::RBAC_PERM_COMMAND_SERVER_PROFILE,       true, &HandleServerProfileCommand,      "", },
+        };
+
         static std::vector<ChatCommand> serverRestartCommandTable =
         {
             { "cancel", rbac::RBAC_PERM_COMMAND_SERVER_RESTART_CANCEL, true, &HandleServerShutDownCancelCommand, "", },
@@ -64,8 +89,11 @@ public:
             { "idlerestart",  rbac::RBAC_PERM_COMMAND_SERVER_IDLERESTART,  true, NULL,                        "", serverIdleRestartCommandTable },
             { "idleshutdown", rbac::RBAC_PERM_COMMAND_SERVER_IDLESHUTDOWN, true, NULL,                        "", serverIdleShutdownCommandTable },
             { "info",         rbac::RBAC_PERM_COMMAND_SERVER_INFO,         true, &HandleServerInfoCommand,    "", },
+            { "memory",       rbac::RBAC_PERM_COMMAND_SERVER_MEMORY,       true, NULL,                        "", serverMemoryCommandTable },
             { "motd",         rbac::RBAC_PERM_COMMAND_SERVER_MOTD,         true, &HandleServerMotdCommand,    "", },
+            { "opcodes",      rbac::RBAC_PERM_COMMAND_SERVER_OPCODES,      true, NULL,                        "", serverOpcodesCommandTable },
             { "plimit",       rbac::RBAC_PERM_COMMAND_SERVER_PLIMIT,       true, &HandleServerPLimitCommand,  "", },
+            { "profile",      rbac::RBAC_PERM_COMMAND_SERVER_PROFILE,      true, NULL,                        "", serverProfileCommandTable },
             { "restart",      rbac::RBAC_PERM_COMMAND_SERVER_RESTART,      true, NULL,                        "", serverRestartCommandTable },
             { "shutdown",     rbac::RBAC_PERM_COMMAND_SERVER_SHUTDOWN,     true, NULL,                        "", serverShutdownCommandTable },
             { "set",          rbac::RBAC_PERM_COMMAND_SERVER_SET,          true, NULL,                        "", serverSetCommandTable },
@@ -104,6 +132,10 @@ public:
         handler->PSendSysMessage(LANG_UPTIME, uptime.c_str());
         handler->PSendSysMessage(LANG_UPDATE_DIFF, updateTime);
 
+        // only counted when respawn time saving is buffered, see SaveRespawnTimeInterval
+        if (sWorld->getIntConfig(WorldIntConfigs::CONFIG_RESPAWN_SAVE_INTERVAL))
+            handler->PSendSysMessage("Respawn time writes coalesced since startup: %u", Map::GetCoalescedRespawnWrites());
+
         // Can't use sWorld->ShutdownMsg here in case of console command
         if (sWorld->IsShuttingDown())
             handler->PSendSysMessage(LANG_SHUTDOWN_TIMELEFT, secsToTimeString(sWorld->GetShutDownTimeLeft()).c_str());
@@ -118,6 +150,139 @@ public:
         return true;
     }
 
+    static bool HandleServerProfileCommand(ChatHandler* handler, char const* args)
+    {
+        if (!sTickProfiler->IsEnabled())
+        {
+            handler->SendSysMessage("The tick profiler is disabled, see Profiler.Enable.");
+            return true;
+        }
+
+        uint32 count = 5;
+        if (*args)
+            count = std::max(1, atoi(args));
+
+        std::vector<std::string> lines;
+        sTickProfiler->BuildReport(lines, count);
+        for (size_t i = 0; i < lines.size(); ++i)
+            handler->SendSysMessage(lines[i].c_str());
+
+        return true;
+    }
+
+    static bool HandleServerProfileResetCommand(ChatHandler* handler, char const* /*args*/)
+    {
+        sTickProfiler->Reset();
+        handler->SendSysMessage("Tick profiler histograms reset.");
+        return true;
+    }
+
+    static bool HandleServerProfileSlowCommand(ChatHandler* handler, char const* /*args*/)
+    {
+        std::vector<std::string> lines;
+        sTickProfiler->GetLastSlowTick(lines);
+        if (lines.empty())
+        {
+            handler->SendSysMessage("No tick exceeded Profiler.SlowTickThreshold yet.");
+            return true;
+        }
+
+        for (size_t i = 0; i < lines.size(); ++i)
+            handler->SendSysMessage(lines[i].c_str());
+
+        return true;
+    }
+
+    static bool HandleServerOpcodesCommand(ChatHandler* handler, char const* args)
+    {
+        uint32 count = 10;
+        if (*args)
+            count = std::max(1, atoi(args));
+
+        OpcodeCostList costs;
+        sOpcodeMonitor->GetCosts(costs);
+
+        std::vector<std::string> lines;
+        OpcodeMonitor::BuildReport(costs, count, lines);
+        for (size_t i = 0; i < lines.size(); ++i)
+            handler->SendSysMessage(lines[i].c_str());
+
+        return true;
+    }
+
+    static bool HandleServerOpcodesPlayerCommand(ChatHandler* handler, char const* args)
+    {
+        char* nameStr = strtok((char*)args, " ");
+        char* countStr = strtok(NULL, " ");
+
+        Player* target;
+        if (!handler->extractPlayerTarget(nameStr, &target))
+            return false;
+
+        uint32 count = 10;
+        if (countStr)
+            count = std::max(1, atoi(countStr));
+
+        WorldSession::OpcodeCostMap const& sessionCosts = target->GetSession()->GetOpcodeCosts();
+        OpcodeCostList costs(sessionCosts.begin(), sessionCosts.end());
+
+        std::vector<std::string> lines;
+        OpcodeMonitor::BuildReport(costs, count, lines);
+        handler->PSendSysMessage("Packets of %s (account %u, %s):", target->GetName().c_str(), target->GetSession()->GetAccountId(),
+            target->GetSession()->GetRemoteAddress().c_str());
+        for (size_t i = 0; i < lines.size(); ++i)
+            handler->SendSysMessage(lines[i].c_str());
+
+        return true;
+    }
+
+    static bool HandleServerOpcodesResetCommand(ChatHandler* handler, char const* /*args*/)
+    {
+        sOpcodeMonitor->Reset();
+        handler->SendSysMessage("Server wide opcode costs reset.");
+        return true;
+    }
+
+    static bool HandleServerMemoryCommand(ChatHandler* handler, char const* /*args*/)
+    {
+        std::vector<ObjectPoolStats const*> pools;
+        ObjectPoolRegistry::GetStats(pools);
+
+        handler->SendSysMessage("pool                      allocations   reused %        live    cached");
+        for (size_t i = 0; i < pools.size(); ++i)
+        {
+            ObjectPoolStats const* pool = pools[i];
+            uint64 allocations = pool->Allocations.load(std::memory_order_relaxed);
+            uint64 reused = pool->Reused.load(std::memory_order_relaxed);
+            handler->PSendSysMessage("%-24s %12llu %10.1f %11lld %9lld", pool->Name.c_str(), (unsigned long long)allocations,
+                allocations ? double(reused) * 100.0 / double(allocations) : 0.0, (long long)pool->Live.load(std::memory_order_relaxed),
+                (long long)pool->Cached.load(std::memory_order_relaxed));
+        }
+
+        AllocatorStats stats;
+        sAllocatorMgr->GetStats(stats);
+
+        std::vector<std::string> lines;
+        AllocatorMgr::BuildReport(stats, true, lines);
+        for (size_t i = 0; i < lines.size(); ++i)
+            handler->SendSysMessage(lines[i].c_str());
+
+        return true;
+    }
+
+    static bool HandleServerMemoryPurgeCommand(ChatHandler* handler, char const* /*args*/)
+    {
+        AllocatorStats before;
+        sAllocatorMgr->GetStats(before);
+        sAllocatorMgr->Purge();
+        AllocatorStats after;
+        sAllocatorMgr->GetStats(after);
+
+        handler->PSendSysMessage("Allocator purged, resident %.1f MB -> %.1f MB.", double(before.Resident) / (1024.0 * 1024.0),
+            double(after.Resident) / (1024.0 * 1024.0));
+        return true;
+    }
+
     // Display the 'Message of the day' for the realm
     static bool HandleServerMotdCommand(ChatHandler* handler, char const* /*args*/)
     {
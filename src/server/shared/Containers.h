@@ -7,7 +7,9 @@
 #define SKYFIRE_CONTAINERS_H
 
 #include "Define.h"
+#include <algorithm>
 #include <list>
+#include <vector>
 
 //! Because circular includes are bad
 extern uint32 urand(uint32 min, uint32 max);
@@ -45,6 +47,20 @@ namespace Skyfire
             list = listCopy;
         }
 
+        /// Keeps size randomly chosen elements, unlike RandomResizeList the order of the kept ones is not preserved
+        template<class T>
+        void RandomResize(std::vector<T>& vector, uint32 size)
+        {
+            uint32 vectorSize = uint32(vector.size());
+            if (vectorSize <= size)
+                return;
+
+            for (uint32 i = 0; i < size; ++i)
+                std::swap(vector[i], vector[i + urand(0, vectorSize - i - 1)]);
+
+            vector.resize(size);
+        }
+
         /* Select a random element from a container. Note: make sure you explicitly empty check the container */
         template <class C> typename C::value_type const& SelectRandomContainerElement(C const& container)
         {
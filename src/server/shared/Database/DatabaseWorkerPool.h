@@ -326,11 +326,22 @@ public:
     //! return object as soon as the query is executed.
     //! The return value is then processed in ProcessQueryCallback methods.
     //! Any prepared statements added to this holder need to be prepared with the CONNECTION_ASYNC flag.
-    QueryResultHolderFuture DelayQueryHolder(SQLQueryHolder* holder)
+    //! With parallelism > 1 the queries are split into that many slices (at most one per async connection),
+    //! each queued as its own task so idle worker threads run them concurrently. The future is set once the
+    //! last slice is done. Only use this for holders whose queries don't depend on each other.
+    QueryResultHolderFuture DelayQueryHolder(SQLQueryHolder* holder, uint8 parallelism = 1)
     {
         QueryResultHolderFuture res;
-        SQLQueryHolderTask* task = new SQLQueryHolderTask(holder, res);
-        Enqueue(task);
+
+        size_t queryCount = holder->m_queries.size();
+        size_t slices = std::min<size_t>(std::max<uint8>(parallelism, 1), _connectionCount[IDX_ASYNC]);
+        slices = std::max<size_t>(std::min(slices, queryCount), 1);
+        size_t sliceSize = (queryCount + slices - 1) / slices;
+
+        holder->m_pendingTasks = uint32(slices);
+        for (size_t i = 0; i < slices; ++i)
+            Enqueue(new SQLQueryHolderTask(holder, res, i * sliceSize, (i + 1) * sliceSize));
+
         return res;     //! Fool compiler, has no use yet
     }
 
@@ -167,7 +167,9 @@ bool SQLQueryHolderTask::Execute()
     /// we can do this, we are friends
     std::vector<SQLQueryHolder::SQLResultPair>& queries = m_holder->m_queries;
 
-    for (size_t i = 0; i < queries.size(); i++)
+    /// each slice writes only its own result slots, the vector itself is never resized while tasks run
+    size_t last = std::min(m_last, queries.size());
+    for (size_t i = m_first; i < last; i++)
     {
         /// execute all queries in the holder and pass the results
         if (SQLElementData* data = &queries[i].first)
@@ -192,6 +194,8 @@ bool SQLQueryHolderTask::Execute()
         }
     }
 
-    m_result.set(m_holder);
+    /// holders queued as a single task have m_pendingTasks == 1
+    if (--m_holder->m_pendingTasks == 0)
+        m_result.set(m_holder);
     return true;
 }
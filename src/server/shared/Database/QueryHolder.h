@@ -7,15 +7,18 @@
 #define _QUERYHOLDER_H
 
 #include <ace/Future.h>
+#include <atomic>
 
 class SQLQueryHolder
 {
     friend class SQLQueryHolderTask;
+    template <class T> friend class DatabaseWorkerPool;
 private:
     typedef std::pair<SQLElementData, SQLResultSetUnion> SQLResultPair;
     std::vector<SQLResultPair> m_queries;
+    std::atomic<uint32> m_pendingTasks;                 // slices still running, the last one sets the future
 public:
-    SQLQueryHolder() { }
+    SQLQueryHolder() : m_pendingTasks(0) { }
     ~SQLQueryHolder();
     bool SetQuery(size_t index, const char* sql);
     bool SetPQuery(size_t index, const char* format, ...) ATTR_PRINTF(3, 4);
@@ -34,10 +37,12 @@ class SQLQueryHolderTask : public SQLOperation
 private:
     SQLQueryHolder* m_holder;
     QueryResultHolderFuture m_result;
+    size_t m_first;                                     // query range [m_first, m_last) run by this task
+    size_t m_last;
 
 public:
-    SQLQueryHolderTask(SQLQueryHolder* holder, QueryResultHolderFuture res)
-        : m_holder(holder), m_result(res) { };
+    SQLQueryHolderTask(SQLQueryHolder* holder, QueryResultHolderFuture res, size_t first = 0, size_t last = size_t(-1))
+        : m_holder(holder), m_result(res), m_first(first), m_last(last) { };
     bool Execute();
 };
 
@@ -69,8 +69,8 @@ void Appender::write(LogMessage& message)
         if (!message.prefix.empty())
             message.prefix.push_back(' ');
 
-        char text[MAX_QUERY_LEN];
-        snprintf(text, MAX_QUERY_LEN, "%-5s", Appender::getLogLevelString(message.level));
+        char text[8];
+        snprintf(text, sizeof(text), "%-5s", Appender::getLogLevelString(message.level));
         message.prefix.append(text);
     }
 
@@ -81,6 +81,7 @@ public:
 
     void setLogLevel(LogLevel);
     void write(LogMessage& message);
+    virtual void flush() { }
     static const char* getLogLevelString(LogLevel level);
 
 private:
@@ -13,6 +13,7 @@
 AppenderFile::AppenderFile(uint8 id, std::string const& name, LogLevel level, const char* _filename, const char* _logDir, const char* _mode, AppenderFlags _flags, uint64 fileSize) :
     Appender(id, name, AppenderType::APPENDER_FILE, level, _flags),
     logfile(NULL),
+    bufferSize(0),
     filename(_filename),
     logDir(_logDir),
     mode(_mode),
@@ -27,9 +28,34 @@ AppenderFile::AppenderFile(uint8 id, std::string const& name, LogLevel level, co
 
 AppenderFile::~AppenderFile()
 {
+    flush();
     CloseFile();
 }
 
+void AppenderFile::SetBufferSize(uint32 size)
+{
+    // file name depends on the message, every message may go to another file
+    if (dynamicName)
+        return;
+
+    bufferSize = size;
+    buffer.reserve(size);
+}
+
+void AppenderFile::flush()
+{
+    if (buffer.empty())
+        return;
+
+    if (logfile)
+    {
+        fwrite(buffer.data(), 1, buffer.size(), logfile);
+        fflush(logfile);
+    }
+
+    buffer.clear();
+}
+
 void AppenderFile::_write(LogMessage const& message)
 {
     bool exceedMaxSize = maxFileSize > 0 && (fileSize.value() + message.Size()) > maxFileSize;
@@ -41,11 +67,25 @@ void AppenderFile::_write(LogMessage const& message)
         logfile = OpenFile(namebuf, mode, backup || exceedMaxSize);
     }
     else if (exceedMaxSize)
+    {
+        flush();
         logfile = OpenFile(filename, "w", true);
+    }
 
     if (!logfile)
         return;
 
+    if (bufferSize)
+    {
+        buffer.append(message.prefix);
+        buffer.append(message.text);
+        fileSize += uint64(message.Size());
+
+        if (buffer.size() >= bufferSize)
+            flush();
+        return;
+    }
+
     fprintf(logfile, "%s%s", message.prefix.c_str(), message.text.c_str());
     fflush(logfile);
     fileSize += uint64(message.Size());
@@ -16,10 +16,16 @@ public:
     ~AppenderFile();
     FILE* OpenFile(std::string const& _name, std::string const& _mode, bool _backup);
 
+    /// Collect up to size bytes before writing, only safe when a single thread writes (async logging)
+    void SetBufferSize(uint32 size);
+    void flush();
+
 private:
     void CloseFile();
     void _write(LogMessage const& message);
     FILE* logfile;
+    std::string buffer;
+    uint32 bufferSize;
     std::string filename;
     std::string logDir;
     std::string mode;
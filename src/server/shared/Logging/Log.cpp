@@ -16,7 +16,7 @@
 #include <cstdio>
 #include <sstream>
 
-Log::Log() : worker(NULL)
+Log::Log() : m_fileBufferSize(0), worker(NULL)
 {
     m_logsTimestamp = "_" + GetTimestampStr();
     LoadFromConfig();
@@ -129,7 +129,10 @@ void Log::CreateAppenderFromConfig(std::string const& appenderName)
             maxFileSize = atoi(*iter++);
 
         uint8 id = NextAppenderId();
-        appenders[id] = new AppenderFile(id, name, level, filename.c_str(), m_logsDir.c_str(), mode.c_str(), flags, maxFileSize);
+        AppenderFile* appender = new AppenderFile(id, name, level, filename.c_str(), m_logsDir.c_str(), mode.c_str(), flags, maxFileSize);
+        if (m_fileBufferSize)
+            appender->SetBufferSize(m_fileBufferSize);
+        appenders[id] = appender;
         //fprintf(stdout, "Log::CreateAppenderFromConfig: Created Appender %s (%u), Type FILE, Mask %u, File %s, Mode %s\n", name.c_str(), id, level, filename.c_str(), mode.c_str());
         break;
     }
@@ -352,6 +355,13 @@ void Log::SetRealmId(uint32 id)
             ((AppenderDB*)it->second)->setRealmId(id);
 }
 
+void Log::Flush()
+{
+    for (AppenderMap::iterator it = appenders.begin(); it != appenders.end(); ++it)
+        if (it->second)
+            it->second->flush();
+}
+
 void Log::Close()
 {
     delete worker;
@@ -369,8 +379,9 @@ void Log::LoadFromConfig()
 {
     Close();
 
-    if (sConfigMgr->GetBoolDefault("Log.Async.Enable", false))
-        worker = new LogWorker();
+    // Buffered file appenders rely on the worker being the only writer
+    bool async = sConfigMgr->GetBoolDefault("Log.Async.Enable", false);
+    m_fileBufferSize = async ? uint32(std::max(sConfigMgr->GetIntDefault("Log.Async.BufferSize", 0), 0)) * 1024 : 0;
 
     AppenderId = 0;
     m_logsDir = sConfigMgr->GetStringDefault("LogsDir", "");
@@ -380,4 +391,9 @@ void Log::LoadFromConfig()
 
     ReadAppendersFromConfig();
     ReadLoggersFromConfig();
+
+    // Started last, the worker flushes the appenders
+    if (async)
+        worker = new LogWorker(this, m_fileBufferSize ? uint32(std::max(sConfigMgr->GetIntDefault("Log.Async.FlushInterval", 1000), 1)) : 0,
+            sConfigMgr->GetBoolDefault("Log.Async.DropOnFull", false));
 }
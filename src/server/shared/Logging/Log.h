@@ -40,6 +40,9 @@ public:
 
     void SetRealmId(uint32 id);
 
+    /// Writes out everything the file appenders hold back, called by the async worker
+    void Flush();
+
 private:
     static std::string GetTimestampStr();
     void vlog(std::string const& f, LogLevel level, char const* str, va_list argptr);
@@ -59,6 +62,7 @@ private:
 
     std::string m_logsDir;
     std::string m_logsTimestamp;
+    uint32 m_fileBufferSize;
 
     LogWorker* worker;
 };
@@ -3,10 +3,11 @@
 * See LICENSE.md file for Copyright information
 */
 
+#include "Log.h"
 #include "LogWorker.h"
 
-LogWorker::LogWorker()
-    : m_queue(HIGH_WATERMARK, LOW_WATERMARK)
+LogWorker::LogWorker(Log* owner, uint32 flushInterval, bool dropOnFull)
+    : m_queue(HIGH_WATERMARK, LOW_WATERMARK), m_log(owner), m_flushInterval(flushInterval), m_dropOnFull(dropOnFull), m_dropped(0)
 {
     ACE_Task_Base::activate(THR_NEW_LWP | THR_JOINABLE | THR_INHERIT_SCHED, 1);
 }
@@ -19,20 +20,57 @@ LogWorker::~LogWorker()
 
 int LogWorker::enqueue(LogOperation* op)
 {
-    return m_queue.enqueue(op);
+    if (!m_dropOnFull)
+        return m_queue.enqueue(op);
+
+    // absolute timeout in the past, fails at once instead of waiting for the writer
+    ACE_Time_Value noWait(ACE_Time_Value::zero);
+    if (m_queue.enqueue(op, &noWait) == -1)
+    {
+        delete op;
+        ++m_dropped;
+        return -1;
+    }
+
+    return 0;
 }
 
 int LogWorker::svc()
 {
+    ACE_Time_Value interval(0, m_flushInterval * 1000);
+    ACE_Time_Value nextFlush = ACE_OS::gettimeofday() + interval;
+    uint64 reportedDrops = 0;
+
     while (1)
     {
         LogOperation* request;
-        if (m_queue.dequeue(request) == -1)
-            break;
+        ACE_Time_Value timeout = nextFlush;
+        if (m_queue.dequeue(request, m_flushInterval ? &timeout : NULL) == -1)
+        {
+            if (errno != EWOULDBLOCK)
+                break;
+        }
+        else
+        {
+            request->call();
+            delete request;
+        }
+
+        if (!m_flushInterval || ACE_OS::gettimeofday() < nextFlush)
+            continue;
+
+        m_log->Flush();
+        nextFlush = ACE_OS::gettimeofday() + interval;
 
-        request->call();
-        delete request;
+        uint64 dropped = m_dropped;
+        if (dropped != reportedDrops)
+        {
+            if (m_log->ShouldLog("server", LogLevel::LOG_LEVEL_WARN))
+                m_log->outMessage("server", LogLevel::LOG_LEVEL_WARN, "LogWorker: queue full, " UI64FMTD " messages dropped so far", dropped);
+            reportedDrops = dropped;
+        }
     }
 
+    m_log->Flush();
     return 0;
 }
@@ -10,11 +10,16 @@
 
 #include <ace/Activation_Queue.h>
 #include <ace/Task.h>
+#include <atomic>
+
+class Log;
 
 class LogWorker : protected ACE_Task_Base
 {
 public:
-    LogWorker();
+    /// flushInterval - ms between Log::Flush calls, 0 disables them
+    /// dropOnFull - discard messages instead of blocking the caller when the queue is full
+    LogWorker(Log* owner, uint32 flushInterval, bool dropOnFull);
     ~LogWorker();
 
     typedef ACE_Message_Queue_Ex<LogOperation, ACE_MT_SYNCH> LogMessageQueueType;
@@ -30,6 +35,10 @@ public:
 private:
     virtual int svc();
     LogMessageQueueType m_queue;
+    Log* m_log;
+    uint32 m_flushInterval;
+    bool m_dropOnFull;
+    std::atomic<uint64> m_dropped;
 };
 
 #endif
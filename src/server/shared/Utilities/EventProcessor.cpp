@@ -5,18 +5,31 @@
 
 #include "EventProcessor.h"
 
+#include <algorithm>
+
+struct EventQueueOrder
+{
+    // std heap functions build a max-heap, so invert the order to keep the earliest event on top
+    bool operator()(EventQueueEntry const& left, EventQueueEntry const& right) const
+    {
+        if (left.ExecTime != right.ExecTime)
+            return left.ExecTime > right.ExecTime;
+        return left.Sequence > right.Sequence;
+    }
+};
+
 void EventProcessor::Update(uint32 p_time)
 {
     // update time
     m_time += p_time;
 
     // main event loop
-    EventList::iterator i;
-    while (((i = m_events.begin()) != m_events.end()) && i->first <= m_time)
+    while (!m_events.empty() && m_events.front().ExecTime <= m_time)
     {
         // get and remove event from queue
-        BasicEvent* Event = i->second;
-        m_events.erase(i);
+        BasicEvent* Event = m_events.front().Event;
+        std::pop_heap(m_events.begin(), m_events.end(), EventQueueOrder());
+        m_events.pop_back();
 
         if (!Event->to_Abort)
         {
@@ -39,37 +52,39 @@ void EventProcessor::KillAllEvents(bool force)
     // prevent event insertions
     m_aborting = true;
 
-    // first, abort all existing events
-    for (EventList::iterator i = m_events.begin(); i != m_events.end();)
-    {
-        EventList::iterator i_old = i;
-        ++i;
+    // Abort() may schedule new events, so walk a detached queue
+    EventList events;
+    events.swap(m_events);
 
-        i_old->second->to_Abort = true;
-        i_old->second->Abort(m_time);
-        if (force || i_old->second->IsDeletable())
-        {
-            delete i_old->second;
-
-            if (!force)                                      // need per-element cleanup
-                m_events.erase(i_old);
-        }
+    // first, abort all existing events, non deletable ones are kept and deleted by Update
+    EventList::iterator kept = events.begin();
+    for (EventList::iterator i = events.begin(); i != events.end(); ++i)
+    {
+        i->Event->to_Abort = true;
+        i->Event->Abort(m_time);
+        if (force || i->Event->IsDeletable())
+            delete i->Event;
+        else
+            *kept++ = *i;
     }
 
-    // fast clear event list (in force case)
-    if (force)
-        m_events.clear();
+    events.erase(kept, events.end());
+    events.insert(events.end(), m_events.begin(), m_events.end());
+    m_events.swap(events);
+
+    // removal breaks the heap order of the remaining events
+    std::make_heap(m_events.begin(), m_events.end(), EventQueueOrder());
 }
 
 void EventProcessor::AddEvent(BasicEvent* Event, uint64 e_time, bool set_addtime)
 {
     if (set_addtime) Event->m_addTime = m_time;
     Event->m_execTime = e_time;
-    m_events.insert(std::pair<uint64, BasicEvent*>(e_time, Event));
+    m_events.push_back(EventQueueEntry(e_time, m_sequence++, Event));
+    std::push_heap(m_events.begin(), m_events.end(), EventQueueOrder());
 }
 
 uint64 EventProcessor::CalculateTime(uint64 t_offset) const
 {
     return(m_time + t_offset);
 }
-
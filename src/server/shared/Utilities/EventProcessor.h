@@ -8,7 +8,7 @@
 
 #include "Define.h"
 
-#include <map>
+#include <vector>
 
 // Note. All times are in milliseconds here.
 
@@ -35,12 +35,22 @@ public:
     uint64 m_execTime;                                  // planned time of next execution, filled by event handler
 };
 
-typedef std::multimap<uint64, BasicEvent*> EventList;
+struct EventQueueEntry
+{
+    EventQueueEntry(uint64 execTime, uint64 sequence, BasicEvent* event) : ExecTime(execTime), Sequence(sequence), Event(event) { }
+
+    uint64 ExecTime;
+    uint64 Sequence;                                    // insertion order, events planned for the same time run FIFO
+    BasicEvent* Event;
+};
+
+// binary min-heap ordered by execution time, the storage is kept between updates so scheduling does not allocate
+typedef std::vector<EventQueueEntry> EventList;
 
 class EventProcessor
 {
 public:
-    EventProcessor() : m_time(0), m_aborting(false) { }
+    EventProcessor() : m_time(0), m_sequence(0), m_aborting(false) { }
     ~EventProcessor() { KillAllEvents(true); }
 
     void Update(uint32 p_time);
@@ -49,6 +59,7 @@ public:
     uint64 CalculateTime(uint64 t_offset) const;
 protected:
     uint64 m_time;
+    uint64 m_sequence;
     EventList m_events;
     bool m_aborting;
 };
@@ -0,0 +1,130 @@
+/*
+* This file is part of Project SkyFire https://www.projectskyfire.org.
+* See LICENSE.md file for Copyright information
+*/
+
+#ifndef SKYFIRE_INLINEVECTOR_H
+#define SKYFIRE_INLINEVECTOR_H
+
+#include "Define.h"
+#include "Errors.h"
+
+#include <cstdlib>
+#include <cstring>
+#include <iterator>
+#include <type_traits>
+
+/// Vector keeping its first N elements inside the object, for short lists that are built and
+/// thrown away at a high rate (spell targets). Only grows to the heap past N elements.
+/// Elements are moved with memcpy, so T must be trivially copyable.
+/// Like std::vector, push_back and erase invalidate iterators.
+template<class T, uint32 N>
+class InlineVector
+{
+    static_assert(std::is_trivially_copyable<T>::value, "InlineVector only holds trivially copyable types");
+
+public:
+    typedef T value_type;
+    typedef T* iterator;
+    typedef T const* const_iterator;
+    typedef std::reverse_iterator<iterator> reverse_iterator;
+    typedef std::reverse_iterator<const_iterator> const_reverse_iterator;
+
+    InlineVector() : _data(GetInlineData()), _size(0), _capacity(N) { }
+
+    InlineVector(InlineVector const& right) : _data(GetInlineData()), _size(0), _capacity(N)
+    {
+        *this = right;
+    }
+
+    ~InlineVector()
+    {
+        if (!IsInline())
+            free(_data);
+    }
+
+    InlineVector& operator=(InlineVector const& right)
+    {
+        if (this != &right)
+        {
+            clear();
+            reserve(right._size);
+            if (right._size)
+                memcpy(_data, right._data, right._size * sizeof(T));
+            _size = right._size;
+        }
+
+        return *this;
+    }
+
+    iterator begin() { return _data; }
+    iterator end() { return _data + _size; }
+    const_iterator begin() const { return _data; }
+    const_iterator end() const { return _data + _size; }
+    reverse_iterator rbegin() { return reverse_iterator(end()); }
+    reverse_iterator rend() { return reverse_iterator(begin()); }
+    const_reverse_iterator rbegin() const { return const_reverse_iterator(end()); }
+    const_reverse_iterator rend() const { return const_reverse_iterator(begin()); }
+
+    uint32 size() const { return _size; }
+    bool empty() const { return _size == 0; }
+
+    T& operator[](uint32 index) { ASSERT(index < _size); return _data[index]; }
+    T const& operator[](uint32 index) const { ASSERT(index < _size); return _data[index]; }
+    T& front() { return (*this)[0]; }
+    T const& front() const { return (*this)[0]; }
+    T& back() { return (*this)[_size - 1]; }
+    T const& back() const { return (*this)[_size - 1]; }
+
+    void push_back(T const& value)
+    {
+        if (_size == _capacity)
+        {
+            T copy = value;                                 // value may live in the storage being replaced
+            reserve(_capacity * 2);
+            _data[_size++] = copy;
+            return;
+        }
+
+        _data[_size++] = value;
+    }
+
+    /// keeps the order of the remaining elements, returns the element following the erased one
+    iterator erase(iterator itr)
+    {
+        ASSERT(itr >= begin() && itr < end());
+        memmove(itr, itr + 1, (end() - itr - 1) * sizeof(T));
+        --_size;
+        return itr;
+    }
+
+    void clear() { _size = 0; }
+
+    void reserve(uint32 capacity)
+    {
+        if (capacity <= _capacity)
+            return;
+
+        T* data = static_cast<T*>(malloc(capacity * sizeof(T)));
+        ASSERT(data);
+        if (_size)
+            memcpy(data, _data, _size * sizeof(T));
+
+        if (!IsInline())
+            free(_data);
+
+        _data = data;
+        _capacity = capacity;
+    }
+
+private:
+    T* GetInlineData() { return reinterpret_cast<T*>(_inline); }
+    bool IsInline() const { return _data == reinterpret_cast<T const*>(_inline); }
+
+    alignas(T) unsigned char _inline[sizeof(T) * N];
+    T* _data;
+    uint32 _size;
+    uint32 _capacity;
+};
+
+#endif
@@ -0,0 +1,56 @@
+/*
+* This file is part of Project SkyFire https://www.projectskyfire.org.
+* See LICENSE.md file for Copyright information
+*/
+
+#include "ObjectPool.h"
+
+#include <cctype>
+#include <cstring>
+#include <mutex>
+
+namespace
+{
+    std::mutex& GetRegistryLock()
+    {
+        static std::mutex lock;
+        return lock;
+    }
+
+    std::vector<ObjectPoolStats*>& GetRegistry()
+    {
+        static std::vector<ObjectPoolStats*> registry;
+        return registry;
+    }
+
+    // "5Spell" with gcc and clang, "class Spell" with msvc
+    std::string GetReadableTypeName(char const* typeName)
+    {
+        if (strncmp(typeName, "class ", 6) == 0)
+            typeName += 6;
+        else if (strncmp(typeName, "struct ", 7) == 0)
+            typeName += 7;
+        else
+            while (isdigit(static_cast<unsigned char>(*typeName)))
+                ++typeName;
+
+        return typeName;
+    }
+}
+
+ObjectPoolStats::ObjectPoolStats(char const* typeName) : Name(GetReadableTypeName(typeName)),
+    Allocations(0), Reused(0), Live(0), Cached(0)
+{
+}
+
+void ObjectPoolRegistry::Register(ObjectPoolStats* stats)
+{
+    std::lock_guard<std::mutex> guard(GetRegistryLock());
+    GetRegistry().push_back(stats);
+}
+
+void ObjectPoolRegistry::GetStats(std::vector<ObjectPoolStats const*>& stats)
+{
+    std::lock_guard<std::mutex> guard(GetRegistryLock());
+    stats.assign(GetRegistry().begin(), GetRegistry().end());
+}
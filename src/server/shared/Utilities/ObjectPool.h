@@ -0,0 +1,136 @@
+/*
+* This file is part of Project SkyFire https://www.projectskyfire.org.
+* See LICENSE.md file for Copyright information
+*/
+
+#ifndef SKYFIRE_OBJECTPOOL_H
+#define SKYFIRE_OBJECTPOOL_H
+
+#include "Define.h"
+
+#include <atomic>
+#include <cstddef>
+#include <new>
+#include <string>
+#include <typeinfo>
+#include <vector>
+
+/// Counters of one pooled type, shown by .server memory
+struct ObjectPoolStats
+{
+    explicit ObjectPoolStats(char const* typeName);
+
+    std::string Name;
+    std::atomic<uint64> Allocations;                        // every operator new
+    std::atomic<uint64> Reused;                             // served from a thread cache instead of the heap
+    std::atomic<int64> Live;
+    std::atomic<int64> Cached;                              // free blocks held by all thread caches
+};
+
+namespace ObjectPoolRegistry
+{
+    void Register(ObjectPoolStats* stats);
+    void GetStats(std::vector<ObjectPoolStats const*>& stats);
+}
+
+/// Base for objects created and destroyed at a high rate from several map threads.
+/// Freed blocks of exactly sizeof(T) go to a cache of the freeing thread and are handed out again
+/// by the next allocation on that thread, so the hot path never touches the shared heap.
+/// Derive the most derived class from it: with a virtual destructor deleting through a base
+/// pointer still ends up here. Other sizes, e.g. classes deriving further, use the global heap.
+template<class T, size_t MaxCached = 1024>
+class PooledObject
+{
+public:
+    static void* operator new(size_t size)
+    {
+        ObjectPoolStats& stats = GetPoolStats();
+        stats.Allocations.fetch_add(1, std::memory_order_relaxed);
+        stats.Live.fetch_add(1, std::memory_order_relaxed);
+
+        FreeList& freeList = GetFreeList();
+        if (size == sizeof(T) && freeList.Head)
+        {
+            FreeNode* node = freeList.Head;
+            freeList.Head = node->Next;
+            --freeList.Count;
+
+            stats.Reused.fetch_add(1, std::memory_order_relaxed);
+            stats.Cached.fetch_sub(1, std::memory_order_relaxed);
+            return node;
+        }
+
+        return ::operator new(size);
+    }
+
+    static void operator delete(void* ptr, size_t size)
+    {
+        if (!ptr)
+            return;
+
+        ObjectPoolStats& stats = GetPoolStats();
+        stats.Live.fetch_sub(1, std::memory_order_relaxed);
+
+        FreeList& freeList = GetFreeList();
+        if (size == sizeof(T) && freeList.Count < MaxCached)
+        {
+            FreeNode* node = static_cast<FreeNode*>(ptr);
+            node->Next = freeList.Head;
+            freeList.Head = node;
+            ++freeList.Count;
+
+            stats.Cached.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+
+        ::operator delete(ptr);
+    }
+
+    static ObjectPoolStats const& GetStats() { return GetPoolStats(); }
+
+private:
+    struct FreeNode
+    {
+        FreeNode* Next;
+    };
+
+    struct FreeList
+    {
+        FreeList() : Head(NULL), Count(0) { }
+
+        ~FreeList()
+        {
+            GetPoolStats().Cached.fetch_sub(int64(Count), std::memory_order_relaxed);
+            while (FreeNode* node = Head)
+            {
+                Head = node->Next;
+                ::operator delete(node);
+            }
+        }
+
+        FreeNode* Head;
+        size_t Count;
+    };
+
+    static FreeList& GetFreeList()
+    {
+        static thread_local FreeList freeList;
+        return freeList;
+    }
+
+    static ObjectPoolStats& GetPoolStats()
+    {
+        static ObjectPoolStats* stats = CreatePoolStats();
+        return *stats;
+    }
+
+    static ObjectPoolStats* CreatePoolStats()
+    {
+        // never freed, thread caches may still report into it while static objects are destroyed
+        ObjectPoolStats* stats = new ObjectPoolStats(typeid(T).name());
+        ObjectPoolRegistry::Register(stats);
+        return stats;
+    }
+};
+
+#endif
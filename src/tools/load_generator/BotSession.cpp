@@ -0,0 +1,968 @@
+/*
+* This file is part of Project SkyFire https://www.projectskyfire.org.
+* See LICENSE.md file for Copyright information
+*/
+
+#include "BigNumber.h"
+#include "BotSession.h"
+#include "CryptoHash.h"
+#include "Errors.h"
+#include "HMAC.h"
+#include "LatencyStats.h"
+#include "Timer.h"
+#include <ace/INET_Addr.h>
+#include <ace/SOCK_Connector.h>
+#include <algorithm>
+#include <cerrno>
+#include <cmath>
+#include <cstdio>
+#include <functional>
+#include <netinet/tcp.h>
+
+using SHA1 = SkyFire::Crypto::SHA1;
+
+namespace
+{
+    enum AuthCommand
+    {
+        AUTH_LOGON_CHALLENGE            = 0x00,
+        AUTH_LOGON_PROOF                = 0x01
+    };
+
+    uint16 const CLIENT_BUILD           = 18414;
+    uint32 const PING_INTERVAL          = 30000;            // WorldSocket::HandlePing counts anything below 27s as overspeed
+    float const MOVE_SPEED              = 7.0f;             // run speed, yards per second
+    float const MOVE_RADIUS             = 20.0f;            // keep the crowd around the login position
+
+    SessionKey SHA1Interleave(std::array<uint8, 32> const& S)
+    {
+        // same as SRP6::SHA1Interleave on the authserver side
+        std::array<uint8, 16> buf0, buf1;
+        for (size_t i = 0; i < 16; ++i)
+        {
+            buf0[i] = S[2 * i + 0];
+            buf1[i] = S[2 * i + 1];
+        }
+
+        size_t p = 0;
+        while (p < S.size() && !S[p])
+            ++p;
+        if (p & 1)
+            ++p;
+        p /= 2;
+
+        SHA1::Digest const hash0 = SHA1::GetDigestOf(buf0.data() + p, 16 - p);
+        SHA1::Digest const hash1 = SHA1::GetDigestOf(buf1.data() + p, 16 - p);
+
+        SessionKey K;
+        for (size_t i = 0; i < SHA1::DIGEST_LENGTH; ++i)
+        {
+            K[2 * i + 0] = hash0[i];
+            K[2 * i + 1] = hash1[i];
+        }
+        return K;
+    }
+
+    float RandomFloat(float min, float max)
+    {
+        return min + (max - min) * (float(rand()) / float(RAND_MAX));
+    }
+
+    uint32 RandomTime(uint32 max)
+    {
+        return uint32(rand()) % (max + 1);
+    }
+}
+
+BotSession::BotSession(BotConfig const& config, std::string const& account, LatencyStats& stats) : _config(config), _account(account),
+    _stats(stats), _state(BOT_STATE_DISCONNECTED), _stateTimer(0), _cryptInitialized(false), _headerRead(false), _recvOpcode(0),
+    _recvSize(0), _homeX(0.0f), _homeY(0.0f), _homeZ(0.0f), _posX(0.0f), _posY(0.0f), _posZ(0.0f), _orientation(0.0f), _moveTimer(0),
+    _chatTimer(0), _probeTimer(0), _pingTimer(0), _castTimer(0), _auctionTimer(0), _pingSentTime(0), _playedTimeSentTime(0),
+    _loginSentTime(0), _auctionSentTime(0), _pingSequence(0), _castCount(0)
+{
+    std::transform(_account.begin(), _account.end(), _account.begin(), ::toupper);
+    _sessionKey.fill(0);
+}
+
+BotSession::~BotSession()
+{
+    Disconnect();
+}
+
+bool BotSession::ReceiveAll(ACE_SOCK_Stream& stream, void* buffer, size_t length)
+{
+    ACE_Time_Value timeout(_config.Timeout / 1000, (_config.Timeout % 1000) * 1000);
+    return stream.recv_n(buffer, length, &timeout) == ssize_t(length);
+}
+
+bool BotSession::AuthLogon()
+{
+    ACE_SOCK_Stream stream;
+    ACE_SOCK_Connector connector;
+    ACE_INET_Addr address(_config.AuthPort, _config.AuthHost.c_str());
+    ACE_Time_Value timeout(_config.Timeout / 1000, (_config.Timeout % 1000) * 1000);
+
+    uint32 startTime = getMSTime();
+    if (connector.connect(stream, address, &timeout) == -1)
+    {
+        printf("[%s] cannot connect to authserver %s:%u\n", _account.c_str(), _config.AuthHost.c_str(), _config.AuthPort);
+        return false;
+    }
+
+    // logon challenge, layout of sAuthLogonChallenge_C
+    ByteBuffer challenge;
+    challenge << uint8(AUTH_LOGON_CHALLENGE);
+    challenge << uint8(8);
+    challenge << uint16(30 + _account.length());
+    challenge.append("WoW", 4);
+    challenge << uint8(5) << uint8(4) << uint8(8);
+    challenge << uint16(CLIENT_BUILD);
+    challenge.append("68x", 4);                             // platform, byte order reversed
+    challenge.append("niW", 4);                             // os
+    challenge.append("SUne", 4);                            // country
+    challenge << uint32(0);                                 // timezone bias
+    challenge << uint32(0x0100007F);                        // ip
+    challenge << uint8(_account.length());
+    challenge.append(_account.c_str(), _account.length());
+
+    bool success = false;
+    do
+    {
+        if (stream.send_n(challenge.contents(), challenge.size(), &timeout) != ssize_t(challenge.size()))
+            break;
+
+        uint8 header[3];
+        if (!ReceiveAll(stream, header, sizeof(header)))
+            break;
+
+        if (header[0] != AUTH_LOGON_CHALLENGE || header[2] != 0)
+        {
+            printf("[%s] logon challenge failed, result %u\n", _account.c_str(), uint32(header[2]));
+            break;
+        }
+
+        std::array<uint8, 32> B, N, salt;
+        std::array<uint8, 1> g;
+        uint8 length;
+        uint8 unk[16];
+        uint8 securityFlags;
+        if (!ReceiveAll(stream, B.data(), B.size()) || !ReceiveAll(stream, &length, 1) || length != g.size() ||
+            !ReceiveAll(stream, g.data(), g.size()) || !ReceiveAll(stream, &length, 1) || length != N.size() ||
+            !ReceiveAll(stream, N.data(), N.size()) || !ReceiveAll(stream, salt.data(), salt.size()) ||
+            !ReceiveAll(stream, unk, sizeof(unk)) || !ReceiveAll(stream, &securityFlags, 1))
+            break;
+
+        if (securityFlags)
+        {
+            printf("[%s] account needs a pin or token, not supported\n", _account.c_str());
+            break;
+        }
+
+        // client side of SRP6, the authserver does the mirror image in SRP6::VerifyChallengeResponse
+        std::string password = _config.Password;
+        std::transform(password.begin(), password.end(), password.begin(), ::toupper);
+
+        BigNumber const bnG(g);
+        BigNumber const bnN(N);
+        BigNumber const bnB(B);
+        BigNumber a;
+        a.SetRand(19 * 8);
+
+        std::array<uint8, 32> const A = bnG.ModExp(a, bnN).ToByteArray<32>();
+        BigNumber const x(SHA1::GetDigestOf(salt, SHA1::GetDigestOf(_account, ":", password)));
+        BigNumber const u(SHA1::GetDigestOf(A, B));
+        BigNumber const v = bnG.ModExp(x, bnN);
+
+        // S = (B - 3v) ^ (a + ux), 3N is added so the base stays positive
+        std::array<uint8, 32> const S = ((bnB + bnN * 3 - v * 3) % bnN).ModExp(a + u * x, bnN).ToByteArray<32>();
+        _sessionKey = SHA1Interleave(S);
+
+        SHA1::Digest const NHash = SHA1::GetDigestOf(N);
+        SHA1::Digest const gHash = SHA1::GetDigestOf(g);
+        SHA1::Digest NgHash;
+        std::transform(NHash.begin(), NHash.end(), gHash.begin(), NgHash.begin(), std::bit_xor<>());
+
+        SHA1::Digest const M1 = SHA1::GetDigestOf(NgHash, SHA1::GetDigestOf(_account), salt, A, B, _sessionKey);
+
+        // logon proof, layout of sAuthLogonProof_C
+        ByteBuffer proof;
+        proof << uint8(AUTH_LOGON_PROOF);
+        proof.append(A);
+        proof.append(M1);
+        proof.append(SHA1::Digest());                       // crc hash, not checked
+        proof << uint8(0);                                  // number of keys
+        proof << uint8(0);                                  // security flags
+
+        if (stream.send_n(proof.contents(), proof.size(), &timeout) != ssize_t(proof.size()))
+            break;
+
+        if (!ReceiveAll(stream, header, 2))
+            break;
+
+        if (header[0] != AUTH_LOGON_PROOF || header[1] != 0)
+        {
+            printf("[%s] logon proof rejected, wrong password?\n", _account.c_str());
+            break;
+        }
+
+        // M2, account flags, survey id, unk
+        uint8 proofResponse[20 + 4 + 4 + 2];
+        if (!ReceiveAll(stream, proofResponse, sizeof(proofResponse)))
+            break;
+
+        SHA1::Digest const M2 = SHA1::GetDigestOf(A, M1, _sessionKey);
+        if (memcmp(M2.data(), proofResponse, M2.size()) != 0)
+        {
+            printf("[%s] authserver proof does not match\n", _account.c_str());
+            break;
+        }
+
+        success = true;
+    }
+    while (false);
+
+    stream.close();
+
+    if (success)
+        _stats.Add(LATENCY_AUTH, GetMSTimeDiffToNow(startTime));
+
+    return success;
+}
+
+bool BotSession::Connect()
+{
+    if (!AuthLogon())
+        return false;
+
+    ACE_SOCK_Connector connector;
+    ACE_INET_Addr address(_config.WorldPort, _config.WorldHost.c_str());
+    ACE_Time_Value timeout(_config.Timeout / 1000, (_config.Timeout % 1000) * 1000);
+    if (connector.connect(_socket, address, &timeout) == -1)
+    {
+        printf("[%s] cannot connect to worldserver %s:%u\n", _account.c_str(), _config.WorldHost.c_str(), _config.WorldPort);
+        return false;
+    }
+
+    int noDelay = 1;
+    _socket.set_option(ACE_IPPROTO_TCP, TCP_NODELAY, &noDelay, sizeof(noDelay));
+    _socket.enable(ACE_NONBLOCK);
+
+    _cryptInitialized = false;
+    _headerRead = false;
+    _recvBuffer.clear();
+
+    // "WORLD OF WARCRAFT CONNECTION - CLIENT TO SERVER", the first 4 bytes end up as opcode on the server
+    static char const connectionString[] = "WORLD OF WARCRAFT CONNECTION - CLIENT TO SERVER";
+    ByteBuffer hello;
+    hello << uint16(sizeof(connectionString));
+    hello.append(connectionString, sizeof(connectionString));
+
+    _state = BOT_STATE_WAIT_AUTH_CHALLENGE;
+    _stateTimer = 0;
+    SendRaw(hello.contents(), hello.size());
+
+    return _state != BOT_STATE_DISCONNECTED;
+}
+
+void BotSession::Disconnect()
+{
+    _socket.close();
+    _state = BOT_STATE_DISCONNECTED;
+}
+
+void BotSession::InitCrypt()
+{
+    // reverse of AuthCrypt::Init, we encrypt with the key the server decrypts with
+    uint8 ServerEncryptionKey[] = { 0x08, 0xF1, 0x95, 0x9F, 0x47, 0xE5, 0xD2, 0xDB, 0xA1, 0x3D, 0x77, 0x8F, 0x3F, 0x3E, 0xE7, 0x00 };
+    uint8 ServerDecryptionKey[] = { 0x40, 0xAA, 0xD3, 0x92, 0x26, 0x71, 0x43, 0x47, 0x3A, 0x31, 0x08, 0xA6, 0xE7, 0xDC, 0x98, 0x2A };
+    _decrypt.Init(SkyFire::Crypto::HMAC_SHA1::GetDigestOf(ServerEncryptionKey, _sessionKey));
+    _encrypt.Init(SkyFire::Crypto::HMAC_SHA1::GetDigestOf(ServerDecryptionKey, _sessionKey));
+
+    std::array<uint8, 1024> syncBuf;
+    _decrypt.UpdateData(syncBuf);
+    _encrypt.UpdateData(syncBuf);
+
+    _cryptInitialized = true;
+}
+
+void BotSession::SendRaw(uint8 const* data, size_t length)
+{
+    if (_state == BOT_STATE_DISCONNECTED)
+        return;
+
+    // packets are small, wait for the kernel buffer instead of keeping an output queue
+    ACE_Time_Value timeout(_config.Timeout / 1000, (_config.Timeout % 1000) * 1000);
+    if (_socket.send_n(data, length, &timeout) != ssize_t(length))
+        Disconnect();
+}
+
+void BotSession::SendPacket(Opcodes opcode, ByteBuffer const& payload)
+{
+    // wire number from the same table the worldserver reads client packets with
+    OpcodeHandler const* handler = clientOpcodeTable[opcode];
+    ASSERT(handler);
+    uint16 opcodeNumber = handler->OpcodeNumber;
+
+    ByteBuffer packet(payload.size() + 6);
+    if (_cryptInitialized)
+    {
+        // same packing as WorldSocket::handle_input_header expects
+        uint8 header[4];
+        uint32 value = (uint32(payload.size()) << 13) | (opcodeNumber & MAX_OPCODE);
+        EndianConvert(value);
+        memcpy(header, &value, 4);
+        _encrypt.UpdateData(header, 4);
+        packet.append(header, 4);
+    }
+    else
+    {
+        packet << uint16(payload.size() + 4);
+        packet << uint32(opcodeNumber);
+    }
+
+    if (!payload.empty())
+        packet.append(payload.contents(), payload.size());
+
+    SendRaw(packet.contents(), packet.size());
+}
+
+bool BotSession::ReadPackets()
+{
+    uint8 buffer[4096];
+    for (;;)
+    {
+        ssize_t n = _socket.recv(buffer, sizeof(buffer));
+        if (n > 0)
+        {
+            _recvBuffer.insert(_recvBuffer.end(), buffer, buffer + n);
+            continue;
+        }
+
+        if (n == 0 || (errno != EWOULDBLOCK && errno != EAGAIN))
+        {
+            Disconnect();
+            return false;
+        }
+
+        break;
+    }
+
+    size_t pos = 0;
+    while (_state != BOT_STATE_DISCONNECTED)
+    {
+        if (!_headerRead)
+        {
+            if (_recvBuffer.size() - pos < 4)
+                break;
+
+            uint8* header = &_recvBuffer[pos];
+            if (_cryptInitialized)
+            {
+                // see ServerPktHeader
+                _decrypt.UpdateData(header, 4);
+                uint32 value;
+                memcpy(&value, header, 4);
+                EndianConvert(value);
+                _recvOpcode = value & MAX_OPCODE;
+                _recvSize = value >> 13;
+            }
+            else
+            {
+                uint16 size, opcode;
+                memcpy(&size, header, 2);
+                memcpy(&opcode, header + 2, 2);
+                EndianConvert(size);
+                EndianConvert(opcode);
+                _recvOpcode = opcode;
+                _recvSize = size >= 2 ? size - 2 : 0;
+            }
+
+            pos += 4;
+            _headerRead = true;
+        }
+
+        if (_recvBuffer.size() - pos < _recvSize)
+            break;
+
+        ByteBuffer packet(_recvSize);
+        if (_recvSize)
+            packet.append(&_recvBuffer[pos], _recvSize);
+
+        pos += _recvSize;
+        _headerRead = false;
+
+        try
+        {
+            HandlePacket(_recvOpcode < NUM_OPCODE_HANDLERS ? serverOpcodeTable.GetOpcodeByNumber(_recvOpcode) : NULL_OPCODE, packet);
+        }
+        catch (ByteBufferException const&)
+        {
+            printf("[%s] malformed packet 0x%04X (%u bytes)\n", _account.c_str(), uint32(_recvOpcode), _recvSize);
+            Disconnect();
+        }
+    }
+
+    if (pos)
+        _recvBuffer.erase(_recvBuffer.begin(), _recvBuffer.begin() + std::min(pos, _recvBuffer.size()));
+
+    return _state != BOT_STATE_DISCONNECTED;
+}
+
+void BotSession::HandlePacket(Opcodes opcode, ByteBuffer& packet)
+{
+    switch (opcode)
+    {
+        case SMSG_AUTH_CHALLENGE:
+            if (_state == BOT_STATE_WAIT_AUTH_CHALLENGE)
+                HandleAuthChallenge(packet);
+            break;
+        case SMSG_AUTH_RESPONSE:
+            if (_state == BOT_STATE_WAIT_AUTH_RESPONSE)
+            {
+                // a failed session is closed by the server, so any response means we are in (or queued)
+                SendPacket(CMSG_ENUM_CHARACTERS, ByteBuffer(0));
+                _state = BOT_STATE_WAIT_ENUM_CHARACTERS;
+                _stateTimer = 0;
+            }
+            break;
+        case SMSG_ENUM_CHARACTERS_RESULT:
+            if (_state == BOT_STATE_WAIT_ENUM_CHARACTERS)
+                HandleEnumCharactersResult(packet);
+            break;
+        case SMSG_LOGIN_VERIFY_WORLD:
+            if (_state == BOT_STATE_WAIT_LOGIN)
+            {
+                packet >> _posX >> _orientation >> _posY;
+                packet.read_skip<uint32>();                 // map
+                packet >> _posZ;
+                HandleLoginVerifyWorld();
+            }
+            break;
+        case SMSG_PONG:
+            HandlePong();
+            break;
+        case SMSG_PLAYED_TIME:
+            HandlePlayedTime();
+            break;
+        case SMSG_AUCTION_LIST_RESULT:
+            HandleAuctionListResult();
+            break;
+        default:
+            // everything else (update objects, spells, chat...) is only received to load the network
+            break;
+    }
+}
+
+void BotSession::HandleAuthChallenge(ByteBuffer& packet)
+{
+    std::array<uint8, 4> serverSeed;
+    packet.read_skip<uint16>();
+    packet.read_skip(32);                                   // encryption seeds
+    packet.read_skip<uint8>();
+    packet.read(serverSeed);
+
+    std::array<uint8, 4> clientSeed;
+    for (uint8 i = 0; i < 4; ++i)
+        clientSeed[i] = uint8(rand());
+
+    uint8 t[4] = { 0x00, 0x00, 0x00, 0x00 };
+    SHA1 sha;
+    sha.UpdateData(_account);
+    sha.UpdateData(t);
+    sha.UpdateData(clientSeed);
+    sha.UpdateData(serverSeed);
+    sha.UpdateData(_sessionKey);
+    sha.Finalize();
+    SHA1::Digest const digest = sha.GetDigest();
+
+    // read back in this exact order by WorldSocket::HandleAuthSession
+    ByteBuffer data(200);
+    data << uint32(0);
+    data << uint32(0);
+    data << digest[18] << digest[14] << digest[3] << digest[4] << digest[0];
+    data << uint32(_config.RealmId);
+    data << digest[11];
+    data.append(clientSeed);
+    data << digest[19];
+    data << uint8(0);
+    data << uint8(0);
+    data << digest[2] << digest[9] << digest[12];
+    data << uint64(0);
+    data << uint32(0);
+    data << digest[16] << digest[5] << digest[6] << digest[8];
+    data << uint16(CLIENT_BUILD);
+    data << digest[17] << digest[7] << digest[13] << digest[15] << digest[1] << digest[10];
+    data << uint32(4);                                      // addon data size
+    data << uint32(0);                                      // no addons
+    data.WriteBit(0);
+    data.WriteBits(_account.length(), 11);
+    data.FlushBits();
+    data.WriteString(_account);
+
+    SendPacket(CMSG_AUTH_SESSION, data);
+
+    // the server initializes its crypt right after reading the session, everything that follows is encrypted
+    InitCrypt();
+    _state = BOT_STATE_WAIT_AUTH_RESPONSE;
+    _stateTimer = 0;
+}
+
+void BotSession::HandleEnumCharactersResult(ByteBuffer& packet)
+{
+    packet.ReadBits(21);                                    // faction change restrictions
+    uint32 count = packet.ReadBits(16);
+    if (!count)
+    {
+        printf("[%s] account has no character on realm %u\n", _account.c_str(), _config.RealmId);
+        Disconnect();
+        return;
+    }
+
+    // bit layout of Player::BuildEnumData, only the first character is used
+    ObjectGuid guid;
+    ObjectGuid guildGuid;
+    uint32 nameLength = 0;
+    for (uint32 i = 0; i < count; ++i)
+    {
+        ObjectGuid charGuid;
+        ObjectGuid charGuildGuid;
+        charGuildGuid[4] = packet.ReadBit();
+        charGuid[0] = packet.ReadBit();
+        charGuildGuid[3] = packet.ReadBit();
+        charGuid[3] = packet.ReadBit();
+        charGuid[7] = packet.ReadBit();
+        packet.ReadBit();                                   // boosted
+        packet.ReadBit();                                   // first login
+        charGuid[6] = packet.ReadBit();
+        charGuildGuid[6] = packet.ReadBit();
+        uint32 charNameLength = packet.ReadBits(6);
+        charGuid[1] = packet.ReadBit();
+        charGuildGuid[1] = packet.ReadBit();
+        charGuildGuid[0] = packet.ReadBit();
+        charGuid[4] = packet.ReadBit();
+        charGuildGuid[7] = packet.ReadBit();
+        charGuid[2] = packet.ReadBit();
+        charGuid[5] = packet.ReadBit();
+        charGuildGuid[2] = packet.ReadBit();
+        charGuildGuid[5] = packet.ReadBit();
+
+        if (!i)
+        {
+            guid = charGuid;
+            guildGuid = charGuildGuid;
+            nameLength = charNameLength;
+        }
+    }
+    packet.ReadBit();                                       // success
+
+    packet.read_skip<uint32>();
+    packet.ReadByteSeq(guid[1]);
+    packet.read_skip<uint8>();                              // slot
+    packet.read_skip<uint8>();                              // hair style
+    packet.ReadByteSeq(guildGuid[2]);
+    packet.ReadByteSeq(guildGuid[0]);
+    packet.ReadByteSeq(guildGuid[6]);
+    packet.read_skip(nameLength);
+    packet.ReadByteSeq(guildGuid[3]);
+    packet.read_skip<float>();                              // x
+    packet.read_skip<uint32>();
+    packet.read_skip<uint8>();                              // face
+    packet.read_skip<uint8>();                              // class
+    packet.ReadByteSeq(guildGuid[5]);
+    packet.read_skip(23 * (4 + 1 + 4));                     // equipment
+    packet.read_skip<uint32>();                             // customization flags
+    packet.ReadByteSeq(guid[3]);
+    packet.ReadByteSeq(guid[5]);
+    packet.read_skip<uint32>();                             // pet family
+    packet.ReadByteSeq(guildGuid[4]);
+    packet.read_skip<uint32>();                             // map
+    packet.read_skip<uint8>();                              // race
+    packet.read_skip<uint8>();                              // skin
+    packet.ReadByteSeq(guildGuid[1]);
+    packet.read_skip<uint8>();                              // level
+    packet.ReadByteSeq(guid[0]);
+    packet.ReadByteSeq(guid[2]);
+    packet.read_skip<uint8>();                              // hair color
+    packet.read_skip<uint8>();                              // gender
+    packet.read_skip<uint8>();                              // facial hair
+    packet.read_skip<uint32>();                             // pet level
+    packet.ReadByteSeq(guid[4]);
+    packet.ReadByteSeq(guid[7]);
+    packet.read_skip<float>();                              // y
+    packet.read_skip<uint32>();                             // pet display id
+    packet.read_skip<uint32>();
+    packet.ReadByteSeq(guid[6]);
+
+    _playerGuid = guid;
+    SendPlayerLogin();
+}
+
+void BotSession::SendPlayerLogin()
+{
+    // read by WorldSession::HandlePlayerLoginOpcode
+    ByteBuffer data(4 + 1 + 8);
+    data << float(0.0f);
+    data.WriteBit(_playerGuid[1]);
+    data.WriteBit(_playerGuid[4]);
+    data.WriteBit(_playerGuid[7]);
+    data.WriteBit(_playerGuid[3]);
+    data.WriteBit(_playerGuid[2]);
+    data.WriteBit(_playerGuid[6]);
+    data.WriteBit(_playerGuid[5]);
+    data.WriteBit(_playerGuid[0]);
+    data.FlushBits();
+    data.WriteByteSeq(_playerGuid[5]);
+    data.WriteByteSeq(_playerGuid[1]);
+    data.WriteByteSeq(_playerGuid[0]);
+    data.WriteByteSeq(_playerGuid[6]);
+    data.WriteByteSeq(_playerGuid[2]);
+    data.WriteByteSeq(_playerGuid[4]);
+    data.WriteByteSeq(_playerGuid[7]);
+    data.WriteByteSeq(_playerGuid[3]);
+
+    SendPacket(CMSG_PLAYER_LOGIN, data);
+
+    _loginSentTime = getMSTime();
+    _state = BOT_STATE_WAIT_LOGIN;
+    _stateTimer = 0;
+}
+
+void BotSession::HandleLoginVerifyWorld()
+{
+    _stats.Add(LATENCY_WORLD_LOGIN, GetMSTimeDiffToNow(_loginSentTime));
+
+    _homeX = _posX;
+    _homeY = _posY;
+    _homeZ = _posZ;
+    _state = BOT_STATE_IN_WORLD;
+
+    // spread the periodic packets of all bots over the interval
+    _moveTimer = RandomTime(_config.MoveInterval);
+    _chatTimer = RandomTime(_config.ChatInterval);
+    _probeTimer = RandomTime(_config.ProbeInterval);
+    _pingTimer = RandomTime(PING_INTERVAL);
+    _castTimer = RandomTime(_config.CastInterval);
+    _auctionTimer = RandomTime(_config.AuctionInterval);
+
+    if (_config.Behaviours & BOT_BEHAVIOUR_CHANNEL)
+        SendJoinChannel();
+
+    if ((_config.Behaviours & BOT_BEHAVIOUR_LFG) && _config.LfgDungeon)
+        SendLfgJoin();
+}
+
+void BotSession::HandlePong()
+{
+    if (!_pingSentTime)
+        return;
+
+    _stats.Add(LATENCY_PING, GetMSTimeDiffToNow(_pingSentTime));
+    _pingSentTime = 0;
+}
+
+void BotSession::HandlePlayedTime()
+{
+    if (!_playedTimeSentTime)
+        return;
+
+    _stats.Add(LATENCY_WORLD_ROUNDTRIP, GetMSTimeDiffToNow(_playedTimeSentTime));
+    _playedTimeSentTime = 0;
+}
+
+void BotSession::HandleAuctionListResult()
+{
+    if (!_auctionSentTime)
+        return;
+
+    _stats.Add(LATENCY_AUCTION_SEARCH, GetMSTimeDiffToNow(_auctionSentTime));
+    _auctionSentTime = 0;
+}
+
+void BotSession::SendHeartbeat()
+{
+    // MovementHeartBeat sequence of MovementStructures.cpp: position and orientation, no flags, no transport
+    ByteBuffer data(4 * 3 + 5 + 8 + 4 + 4);
+    data << _posZ;
+    data << _posX;
+    data << _posY;
+    data.WriteBits(0, 22);                                  // forces count
+    data.WriteBit(1);                                       // no movement flags
+    data.WriteBit(0);
+    data.WriteBit(1);                                       // no counter
+    data.WriteBit(_playerGuid[3]);
+    data.WriteBit(_playerGuid[6]);
+    data.WriteBit(1);                                       // no pitch
+    data.WriteBit(0);
+    data.WriteBit(0);
+    data.WriteBit(_playerGuid[7]);
+    data.WriteBit(_playerGuid[2]);
+    data.WriteBit(_playerGuid[4]);
+    data.WriteBit(1);                                       // no movement flags2
+    data.WriteBit(0);                                       // has orientation
+    data.WriteBit(0);                                       // has timestamp
+    data.WriteBit(0);                                       // no transport
+    data.WriteBit(0);                                       // no fall data
+    data.WriteBit(_playerGuid[5]);
+    data.WriteBit(1);                                       // no spline elevation
+    data.WriteBit(_playerGuid[1]);
+    data.WriteBit(_playerGuid[0]);
+    data.FlushBits();
+    data.WriteByteSeq(_playerGuid[2]);
+    data.WriteByteSeq(_playerGuid[3]);
+    data.WriteByteSeq(_playerGuid[6]);
+    data.WriteByteSeq(_playerGuid[1]);
+    data.WriteByteSeq(_playerGuid[4]);
+    data.WriteByteSeq(_playerGuid[7]);
+    data.WriteByteSeq(_playerGuid[5]);
+    data.WriteByteSeq(_playerGuid[0]);
+    data << _orientation;
+    data << uint32(getMSTime());
+
+    SendPacket(MSG_MOVE_HEARTBEAT, data);
+}
+
+void BotSession::SendSay(std::string const& text)
+{
+    ByteBuffer data(4 + 1 + text.length());
+    data << uint32(0);                                      // LANG_UNIVERSAL
+    data.WriteBits(text.length(), 8);
+    data.FlushBits();
+    data.WriteString(text);
+
+    SendPacket(CMSG_MESSAGECHAT_SAY, data);
+}
+
+void BotSession::SendJoinChannel()
+{
+    ByteBuffer data(4 + 3 + _config.Channel.length());
+    data << uint32(0);                                      // custom channel
+    data.WriteBit(0);
+    data.WriteBits(_config.Channel.length(), 7);
+    data.WriteBits(0, 7);                                   // no password
+    data.WriteBit(0);
+    data.FlushBits();
+    data.WriteString(_config.Channel);
+
+    SendPacket(CMSG_CHAT_JOIN_CHANNEL, data);
+}
+
+void BotSession::SendChannelMessage(std::string const& text)
+{
+    ByteBuffer data(4 + 3 + text.length() + _config.Channel.length());
+    data << uint32(0);                                      // LANG_UNIVERSAL
+    data.WriteBits(_config.Channel.length(), 9);
+    data.WriteBits(text.length(), 8);
+    data.FlushBits();
+    data.WriteString(text);
+    data.WriteString(_config.Channel);
+
+    SendPacket(CMSG_MESSAGECHAT_CHANNEL, data);
+}
+
+void BotSession::SendLfgJoin()
+{
+    ByteBuffer data(1 + 4 * 4 + 4 + 4);
+    data << uint8(0);                                       // party index
+    for (uint8 i = 0; i < 3; ++i)
+        data << uint32(0);                                  // needs
+    data << uint32(0x08);                                   // PLAYER_ROLE_DAMAGE
+    data.WriteBits(1, 22);                                  // dungeon count
+    data.WriteBits(0, 8);                                   // comment length
+    data.WriteBit(0);                                       // queue as group
+    data.FlushBits();
+    data << uint32(_config.LfgDungeon);
+
+    SendPacket(CMSG_LFD_JOIN, data);
+}
+
+void BotSession::SendPing()
+{
+    ByteBuffer data(8);
+    data << uint32(0);                                      // latency
+    data << uint32(++_pingSequence);
+
+    SendPacket(CMSG_PING, data);
+    _pingSentTime = getMSTime();
+}
+
+void BotSession::SendPlayedTimeRequest()
+{
+    ByteBuffer data(1);
+    data << uint8(0);                                       // don't print in chat frame
+
+    SendPacket(CMSG_REQUEST_PLAYED_TIME, data);
+    _playedTimeSentTime = getMSTime();
+}
+
+void BotSession::SendCastSpell()
+{
+    // read by WorldSession::HandleCastSpellOpcode, no target mask and no guids make the caster the target
+    ByteBuffer data(2 + 1 + 4);
+    data.WriteBit(0);
+    data.WriteBit(1);                                       // no target string
+    data.WriteBit(0);
+    data.WriteBit(0);                                       // has cast count
+    data.WriteBit(0);                                       // no source location
+    data.WriteBit(0);                                       // no destination location
+    data.WriteBit(0);                                       // has spell id
+    data.WriteBits(0, 2);                                   // research data count
+    data.WriteBit(1);                                       // no target mask
+    data.WriteBit(1);                                       // no missile speed
+    data.WriteBit(1);                                       // no glyph index
+    data.WriteBit(0);                                       // no movement
+    data.WriteBit(1);                                       // no elevation
+    data.WriteBit(1);                                       // no cast flags
+    data.WriteBits(0, 8);                                   // target guid
+    data.WriteBits(0, 8);                                   // item target guid
+    data.FlushBits();
+    data << uint8(++_castCount);
+    data << uint32(_config.CastSpell);
+
+    SendPacket(CMSG_CAST_SPELL, data);
+}
+
+void BotSession::SendAuctionListItems()
+{
+    // read by WorldSession::HandleAuctionListItems, an unfiltered search of the first page
+    ObjectGuid auctioneer = _config.Auctioneer;
+    ByteBuffer data(4 * 3 + 1 + 2 + 4 * 3 + 2 + 8);
+    data << uint32(0xFFFFFFFF);                             // any inventory slot
+    data << uint32(0);                                      // list from
+    data << uint32(0xFFFFFFFF);                             // any item class
+    data << uint8(0);
+    data << uint8(0);                                       // level max
+    data << uint8(0);                                       // level min
+    data << uint32(0xFFFFFFFF);                             // any quality
+    data << uint32(0xFFFFFFFF);                             // any item subclass
+    data << uint32(0);                                      // sort count
+    data.WriteBit(auctioneer[3]);
+    data.WriteBit(auctioneer[4]);
+    data.WriteBit(auctioneer[5]);
+    data.WriteBit(auctioneer[2]);
+    data.WriteBit(0);                                       // exact match
+    data.WriteBit(0);                                       // usable items
+    data.WriteBit(auctioneer[7]);
+    data.WriteBit(auctioneer[0]);
+    data.WriteBits(0, 8);                                   // search string length
+    data.WriteBit(auctioneer[1]);
+    data.WriteBit(auctioneer[6]);
+    data.FlushBits();
+    data.WriteByteSeq(auctioneer[6]);
+    data.WriteByteSeq(auctioneer[3]);
+    data.WriteByteSeq(auctioneer[4]);
+    data.WriteByteSeq(auctioneer[0]);
+    data.WriteByteSeq(auctioneer[7]);
+    data.WriteByteSeq(auctioneer[2]);
+    data.WriteByteSeq(auctioneer[1]);
+    data.WriteByteSeq(auctioneer[5]);
+
+    SendPacket(CMSG_AUCTION_LIST_ITEMS, data);
+    _auctionSentTime = getMSTime();
+}
+
+bool BotSession::Update(uint32 diff)
+{
+    if (_state == BOT_STATE_DISCONNECTED)
+        return false;
+
+    if (!ReadPackets())
+        return false;
+
+    if (_state != BOT_STATE_IN_WORLD)
+    {
+        _stateTimer += diff;
+        if (_stateTimer > _config.Timeout)
+        {
+            printf("[%s] login timed out in state %u\n", _account.c_str(), uint32(_state));
+            Disconnect();
+            return false;
+        }
+        return true;
+    }
+
+    if (_config.Behaviours & BOT_BEHAVIOUR_MOVE)
+    {
+        _moveTimer += diff;
+        if (_moveTimer >= _config.MoveInterval)
+        {
+            float dx = _posX - _homeX;
+            float dy = _posY - _homeY;
+            if (dx * dx + dy * dy > MOVE_RADIUS * MOVE_RADIUS)
+                _orientation = std::atan2(-dy, -dx);
+            else
+                _orientation += RandomFloat(-0.5f, 0.5f);
+
+            if (_orientation < 0.0f)
+                _orientation += float(2 * M_PI);
+            else if (_orientation > float(2 * M_PI))
+                _orientation -= float(2 * M_PI);
+
+            float step = MOVE_SPEED * _moveTimer / 1000.0f;
+            _posX += step * std::cos(_orientation);
+            _posY += step * std::sin(_orientation);
+            _moveTimer = 0;
+
+            SendHeartbeat();
+        }
+    }
+
+    if (_config.Behaviours & (BOT_BEHAVIOUR_SAY | BOT_BEHAVIOUR_CHANNEL))
+    {
+        _chatTimer += diff;
+        if (_chatTimer >= _config.ChatInterval)
+        {
+            char text[64];
+            snprintf(text, sizeof(text), "load test message %u", RandomTime(100000));
+
+            if (_config.Behaviours & BOT_BEHAVIOUR_SAY)
+                SendSay(text);
+            if (_config.Behaviours & BOT_BEHAVIOUR_CHANNEL)
+                SendChannelMessage(text);
+
+            _chatTimer = 0;
+        }
+    }
+
+    if (_config.Behaviours & BOT_BEHAVIOUR_CAST)
+    {
+        _castTimer += diff;
+        if (_castTimer >= _config.CastInterval)
+        {
+            SendCastSpell();
+            _castTimer = 0;
+        }
+    }
+
+    if (_config.Behaviours & BOT_BEHAVIOUR_AUCTION)
+    {
+        // the server drops the search silently when the auctioneer is out of reach
+        if (_auctionSentTime && GetMSTimeDiffToNow(_auctionSentTime) > _config.Timeout)
+        {
+            printf("[%s] auction search not answered, is the character standing at the auctioneer?\n", _account.c_str());
+            _auctionSentTime = 0;
+        }
+
+        _auctionTimer += diff;
+        if (_auctionTimer >= _config.AuctionInterval && !_auctionSentTime)
+        {
+            SendAuctionListItems();
+            _auctionTimer = 0;
+        }
+    }
+
+    _probeTimer += diff;
+    if (_probeTimer >= _config.ProbeInterval && !_playedTimeSentTime)
+    {
+        SendPlayedTimeRequest();
+        _probeTimer = 0;
+    }
+
+    _pingTimer += diff;
+    if (_pingTimer >= PING_INTERVAL && !_pingSentTime)
+    {
+        SendPing();
+        _pingTimer = 0;
+    }
+
+    return _state != BOT_STATE_DISCONNECTED;
+}
@@ -0,0 +1,146 @@
+/*
+* This file is part of Project SkyFire https://www.projectskyfire.org.
+* See LICENSE.md file for Copyright information
+*/
+
+#ifndef _LOAD_GENERATOR_BOT_SESSION_H
+#define _LOAD_GENERATOR_BOT_SESSION_H
+
+#include "ARC4.h"
+#include "AuthDefines.h"
+#include "ByteBuffer.h"
+#include "Define.h"
+#include "Opcodes.h"
+#include <ace/SOCK_Stream.h>
+#include <string>
+#include <vector>
+
+class LatencyStats;
+
+enum BotBehaviour
+{
+    BOT_BEHAVIOUR_MOVE      = 0x01,                         // random walk around the login position
+    BOT_BEHAVIOUR_SAY       = 0x02,                         // /say in the open world
+    BOT_BEHAVIOUR_CHANNEL   = 0x04,                         // join a custom channel and talk in it
+    BOT_BEHAVIOUR_LFG       = 0x08,                         // queue for a dungeon finder entry once in world
+    BOT_BEHAVIOUR_CAST      = 0x10,                         // cast a known spell on the own character
+    BOT_BEHAVIOUR_AUCTION   = 0x20                          // browse the auction house, the character has to stand at the auctioneer
+};
+
+struct BotConfig
+{
+    BotConfig() : AuthPort(3724), WorldPort(8085), RealmId(1), Behaviours(BOT_BEHAVIOUR_MOVE), MoveInterval(500),
+        ChatInterval(10000), ProbeInterval(1000), LfgDungeon(0), CastSpell(0), CastInterval(5000), Auctioneer(0),
+        AuctionInterval(5000), Timeout(30000) { }
+
+    std::string AuthHost;
+    uint16 AuthPort;
+    std::string WorldHost;
+    uint16 WorldPort;
+    uint32 RealmId;
+    std::string Password;
+    std::string Channel;
+    uint32 Behaviours;
+    uint32 MoveInterval;
+    uint32 ChatInterval;
+    uint32 ProbeInterval;                                   // CMSG_REQUEST_PLAYED_TIME, CMSG_PING is sent every 30s because of the overspeed check
+    uint32 LfgDungeon;
+    uint32 CastSpell;
+    uint32 CastInterval;
+    uint64 Auctioneer;                                      // full creature guid
+    uint32 AuctionInterval;
+    uint32 Timeout;
+};
+
+enum BotState
+{
+    BOT_STATE_DISCONNECTED,
+    BOT_STATE_WAIT_AUTH_CHALLENGE,                          // connection string sent
+    BOT_STATE_WAIT_AUTH_RESPONSE,                           // CMSG_AUTH_SESSION sent, header crypt is active from now on
+    BOT_STATE_WAIT_ENUM_CHARACTERS,
+    BOT_STATE_WAIT_LOGIN,                                   // CMSG_PLAYER_LOGIN sent
+    BOT_STATE_IN_WORLD
+};
+
+/// One simulated client: SRP6 logon against the authserver, then the world protocol on a non blocking socket.
+class BotSession
+{
+public:
+    BotSession(BotConfig const& config, std::string const& account, LatencyStats& stats);
+    ~BotSession();
+
+    /// Blocking authserver logon followed by the world connection, the rest of the login is driven by Update().
+    bool Connect();
+    void Disconnect();
+
+    /// Reads and handles pending packets and runs the behaviours, returns false once the connection is gone.
+    bool Update(uint32 diff);
+
+    BotState GetState() const { return _state; }
+    std::string const& GetAccount() const { return _account; }
+
+private:
+    bool AuthLogon();
+    bool ReceiveAll(ACE_SOCK_Stream& stream, void* buffer, size_t length);
+
+    void InitCrypt();
+    void SendPacket(Opcodes opcode, ByteBuffer const& payload);
+    void SendRaw(uint8 const* data, size_t length);
+    bool ReadPackets();
+    void HandlePacket(Opcodes opcode, ByteBuffer& packet);
+
+    void HandleAuthChallenge(ByteBuffer& packet);
+    void HandleEnumCharactersResult(ByteBuffer& packet);
+    void HandleLoginVerifyWorld();
+    void HandlePong();
+    void HandlePlayedTime();
+    void HandleAuctionListResult();
+
+    void SendPlayerLogin();
+    void SendHeartbeat();
+    void SendSay(std::string const& text);
+    void SendJoinChannel();
+    void SendChannelMessage(std::string const& text);
+    void SendLfgJoin();
+    void SendPing();
+    void SendPlayedTimeRequest();
+    void SendCastSpell();
+    void SendAuctionListItems();
+
+    BotConfig const& _config;
+    std::string _account;                                   // upper case, as the client sends it
+    LatencyStats& _stats;
+
+    ACE_SOCK_Stream _socket;
+    BotState _state;
+    uint32 _stateTimer;
+    SessionKey _sessionKey;
+
+    bool _cryptInitialized;
+    SkyFire::Crypto::ARC4 _encrypt;                         // the server's decrypt key
+    SkyFire::Crypto::ARC4 _decrypt;                         // the server's encrypt key
+
+    std::vector<uint8> _recvBuffer;
+    bool _headerRead;                                       // header of the next packet is decrypted and parsed already
+    uint16 _recvOpcode;
+    uint32 _recvSize;
+
+    ObjectGuid _playerGuid;
+    float _homeX, _homeY, _homeZ;
+    float _posX, _posY, _posZ, _orientation;
+
+    uint32 _moveTimer;
+    uint32 _chatTimer;
+    uint32 _probeTimer;
+    uint32 _pingTimer;
+    uint32 _castTimer;
+    uint32 _auctionTimer;
+    uint32 _pingSentTime;
+    uint32 _playedTimeSentTime;
+    uint32 _loginSentTime;
+    uint32 _auctionSentTime;
+    uint32 _pingSequence;
+    uint8 _castCount;
+};
+
+#endif
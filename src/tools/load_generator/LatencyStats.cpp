@@ -0,0 +1,45 @@
+/*
+* This file is part of Project SkyFire https://www.projectskyfire.org.
+* See LICENSE.md file for Copyright information
+*/
+
+#include "LatencyStats.h"
+#include <cstdio>
+
+namespace
+{
+    char const* const LatencyTypeNames[MAX_LATENCY_TYPES] =
+    {
+        "auth",
+        "world login",
+        "ping",
+        "world roundtrip",
+        "auction search"
+    };
+}
+
+void LatencyStats::Add(LatencyType type, uint32 ms)
+{
+    // the histograms are lock free, the lock only keeps a sample from slipping between report and reset
+    std::lock_guard<std::mutex> lock(_lock);
+    _interval[type].Add(ms);
+    _total[type].Add(ms);
+}
+
+void LatencyStats::Report(bool total)
+{
+    std::lock_guard<std::mutex> lock(_lock);
+
+    printf("%s latency (ms)        count      p50      p90      p99      max\n", total ? "Total   " : "Interval");
+    for (uint8 i = 0; i < MAX_LATENCY_TYPES; ++i)
+    {
+        TickHistogram& histogram = total ? _total[i] : _interval[i];
+        printf("  %-26s %8u %8u %8u %8u %8u\n", LatencyTypeNames[i], histogram.GetCount(),
+            histogram.GetPercentile(50.0f), histogram.GetPercentile(90.0f), histogram.GetPercentile(99.0f), histogram.GetMax());
+
+        if (!total)
+            histogram.Reset();
+    }
+
+    fflush(stdout);
+}
@@ -0,0 +1,40 @@
+/*
+* This file is part of Project SkyFire https://www.projectskyfire.org.
+* See LICENSE.md file for Copyright information
+*/
+
+#ifndef _LOAD_GENERATOR_LATENCY_STATS_H
+#define _LOAD_GENERATOR_LATENCY_STATS_H
+
+#include "Define.h"
+#include "TickProfiler.h"
+#include <mutex>
+
+enum LatencyType
+{
+    LATENCY_AUTH,               // logon challenge sent -> logon proof accepted by the authserver
+    LATENCY_WORLD_LOGIN,        // CMSG_PLAYER_LOGIN sent -> SMSG_LOGIN_VERIFY_WORLD received
+    LATENCY_PING,               // CMSG_PING -> SMSG_PONG, answered by the network threads
+    LATENCY_WORLD_ROUNDTRIP,    // CMSG_REQUEST_PLAYED_TIME -> SMSG_PLAYED_TIME, answered by the world thread
+    LATENCY_AUCTION_SEARCH,     // CMSG_AUCTION_LIST_ITEMS -> SMSG_AUCTION_LIST_RESULT, a search over the auction house
+    MAX_LATENCY_TYPES
+};
+
+/// Latency samples of all bots, reported as percentiles per interval and for the whole run.
+/// Samples go to the log-linear TickHistogram of the tick profiler, in milliseconds instead of
+/// microseconds, so memory stays fixed however long the run is.
+class LatencyStats
+{
+public:
+    void Add(LatencyType type, uint32 ms);
+
+    /// Prints interval percentiles and clears them, or the whole run with total set.
+    void Report(bool total);
+
+private:
+    std::mutex _lock;
+    TickHistogram _interval[MAX_LATENCY_TYPES];
+    TickHistogram _total[MAX_LATENCY_TYPES];
+};
+
+#endif
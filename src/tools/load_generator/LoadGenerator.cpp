@@ -0,0 +1,349 @@
+/*
+* This file is part of Project SkyFire https://www.projectskyfire.org.
+* See LICENSE.md file for Copyright information
+*/
+
+#include "BotSession.h"
+#include "Common.h"
+#include "LatencyStats.h"
+#include "ObjectDefines.h"
+#include "Opcodes.h"
+#include "Timer.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <csignal>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <thread>
+
+namespace
+{
+    std::atomic<bool> stopRequested(false);
+    std::atomic<uint32> nextBot(0);
+    std::atomic<uint32> botsInWorld(0);
+    std::atomic<uint32> botsFailed(0);
+
+    void OnSignal(int /*signal*/)
+    {
+        stopRequested = true;
+    }
+
+    void PrintUsage(char const* name)
+    {
+        printf("Usage: %s [options]\n", name);
+        printf("Logs in <count> accounts named <prefix><first>..<prefix><first + count - 1>, all sharing one password.\n");
+        printf("Every account needs a character on the realm, the first one returned by the character list is used.\n\n");
+        printf("  --auth <host[:port]>          authserver address (127.0.0.1:3724)\n");
+        printf("  --world <host[:port]>         worldserver address (127.0.0.1:8085)\n");
+        printf("  --realm <id>                  realm id sent in CMSG_AUTH_SESSION (1)\n");
+        printf("  --accounts <prefix>           account name prefix (BOT)\n");
+        printf("  --first <n>                   number of the first account (1)\n");
+        printf("  --count <n>                   number of bots (10)\n");
+        printf("  --password <password>         password of all bot accounts\n");
+        printf("  --threads <n>                 client threads, bots are spread over them (1)\n");
+        printf("  --login-interval <ms>         delay between two logins of one thread (100)\n");
+        printf("  --duration <s>                stop after this many seconds, 0 runs until interrupted (0)\n");
+        printf("  --report <s>                  seconds between two interval reports (10)\n");
+        printf("  --behaviours <list>           comma separated: move, say, channel, lfg, cast, auction (move)\n");
+        printf("  --channel <name>              custom channel of the channel behaviour (loadtest)\n");
+        printf("  --lfg-dungeon <id>            LfgDungeons.dbc entry the lfg behaviour queues for\n");
+        printf("  --cast-spell <id>             spell the cast behaviour casts on the own character, all characters must know it\n");
+        printf("  --auctioneer <guid>:<entry>   auctioneer the auction behaviour searches at, guid and entry as shown by .npc info\n");
+        printf("  --move-interval <ms>          time between two movement heartbeats (500)\n");
+        printf("  --chat-interval <ms>          time between two chat messages (10000)\n");
+        printf("  --probe-interval <ms>         time between two world roundtrip probes (1000)\n");
+        printf("  --cast-interval <ms>          time between two casts (5000)\n");
+        printf("  --auction-interval <ms>       time between two auction searches (5000)\n");
+        printf("\nThe world roundtrip is answered from WorldSession::Update, so it follows the world tick time.\n");
+        printf("The auction behaviour needs the characters parked within interaction range of the auctioneer and\n");
+        printf("the move behaviour left out, the server ignores searches from further away.\n");
+        printf("Disable Warden on the worldserver, the bots don't answer its requests.\n");
+    }
+
+    void ParseAddress(char const* arg, std::string& host, uint16& port)
+    {
+        host = arg;
+        size_t pos = host.find(':');
+        if (pos == std::string::npos)
+            return;
+
+        port = uint16(atoi(host.c_str() + pos + 1));
+        host.resize(pos);
+    }
+
+    uint32 ParseBehaviours(char const* arg)
+    {
+        uint32 behaviours = 0;
+        std::string list = arg;
+        size_t start = 0;
+        while (start <= list.length())
+        {
+            size_t end = list.find(',', start);
+            if (end == std::string::npos)
+                end = list.length();
+
+            std::string name = list.substr(start, end - start);
+            if (name == "move")
+                behaviours |= BOT_BEHAVIOUR_MOVE;
+            else if (name == "say")
+                behaviours |= BOT_BEHAVIOUR_SAY;
+            else if (name == "channel")
+                behaviours |= BOT_BEHAVIOUR_CHANNEL;
+            else if (name == "lfg")
+                behaviours |= BOT_BEHAVIOUR_LFG;
+            else if (name == "cast")
+                behaviours |= BOT_BEHAVIOUR_CAST;
+            else if (name == "auction")
+                behaviours |= BOT_BEHAVIOUR_AUCTION;
+            else if (!name.empty())
+                printf("unknown behaviour '%s' ignored\n", name.c_str());
+
+            start = end + 1;
+        }
+
+        return behaviours;
+    }
+
+    uint64 ParseAuctioneer(char const* arg)
+    {
+        uint32 guid = 0;
+        uint32 entry = 0;
+        if (sscanf(arg, "%u:%u", &guid, &entry) != 2 || !guid || !entry)
+            return 0;
+
+        return MAKE_NEW_GUID(guid, entry, HIGHGUID_UNIT);
+    }
+
+    struct LoadConfig
+    {
+        LoadConfig() : First(1), Count(10), Threads(1), LoginInterval(100), Duration(0), ReportInterval(10) { }
+
+        BotConfig Bot;
+        std::string AccountPrefix;
+        uint32 First;
+        uint32 Count;
+        uint32 Threads;
+        uint32 LoginInterval;
+        uint32 Duration;
+        uint32 ReportInterval;
+    };
+
+    bool HandleArgs(int argc, char** argv, LoadConfig& config)
+    {
+        for (int i = 1; i < argc; ++i)
+        {
+            char const* param = i + 1 < argc ? argv[i + 1] : NULL;
+            if (strcmp(argv[i], "--help") == 0 || strcmp(argv[i], "-h") == 0)
+                return false;
+
+            if (!param)
+            {
+                printf("missing value for '%s'\n", argv[i]);
+                return false;
+            }
+
+            if (strcmp(argv[i], "--auth") == 0)
+                ParseAddress(param, config.Bot.AuthHost, config.Bot.AuthPort);
+            else if (strcmp(argv[i], "--world") == 0)
+                ParseAddress(param, config.Bot.WorldHost, config.Bot.WorldPort);
+            else if (strcmp(argv[i], "--realm") == 0)
+                config.Bot.RealmId = uint32(atoi(param));
+            else if (strcmp(argv[i], "--accounts") == 0)
+                config.AccountPrefix = param;
+            else if (strcmp(argv[i], "--first") == 0)
+                config.First = uint32(atoi(param));
+            else if (strcmp(argv[i], "--count") == 0)
+                config.Count = uint32(atoi(param));
+            else if (strcmp(argv[i], "--password") == 0)
+                config.Bot.Password = param;
+            else if (strcmp(argv[i], "--threads") == 0)
+                config.Threads = std::max(1, atoi(param));
+            else if (strcmp(argv[i], "--login-interval") == 0)
+                config.LoginInterval = uint32(atoi(param));
+            else if (strcmp(argv[i], "--duration") == 0)
+                config.Duration = uint32(atoi(param));
+            else if (strcmp(argv[i], "--report") == 0)
+                config.ReportInterval = std::max(1, atoi(param));
+            else if (strcmp(argv[i], "--behaviours") == 0)
+                config.Bot.Behaviours = ParseBehaviours(param);
+            else if (strcmp(argv[i], "--channel") == 0)
+                config.Bot.Channel = param;
+            else if (strcmp(argv[i], "--lfg-dungeon") == 0)
+                config.Bot.LfgDungeon = uint32(atoi(param));
+            else if (strcmp(argv[i], "--cast-spell") == 0)
+                config.Bot.CastSpell = uint32(atoi(param));
+            else if (strcmp(argv[i], "--auctioneer") == 0)
+                config.Bot.Auctioneer = ParseAuctioneer(param);
+            else if (strcmp(argv[i], "--move-interval") == 0)
+                config.Bot.MoveInterval = std::max(50, atoi(param));
+            else if (strcmp(argv[i], "--chat-interval") == 0)
+                config.Bot.ChatInterval = std::max(100, atoi(param));
+            else if (strcmp(argv[i], "--probe-interval") == 0)
+                config.Bot.ProbeInterval = std::max(50, atoi(param));
+            else if (strcmp(argv[i], "--cast-interval") == 0)
+                config.Bot.CastInterval = std::max(100, atoi(param));
+            else if (strcmp(argv[i], "--auction-interval") == 0)
+                config.Bot.AuctionInterval = std::max(100, atoi(param));
+            else
+            {
+                printf("unknown option '%s'\n", argv[i]);
+                return false;
+            }
+
+            ++i;
+        }
+
+        if (config.Bot.Password.empty())
+        {
+            printf("--password is required\n");
+            return false;
+        }
+
+        if ((config.Bot.Behaviours & BOT_BEHAVIOUR_LFG) && !config.Bot.LfgDungeon)
+        {
+            printf("the lfg behaviour needs --lfg-dungeon\n");
+            return false;
+        }
+
+        if ((config.Bot.Behaviours & BOT_BEHAVIOUR_CAST) && !config.Bot.CastSpell)
+        {
+            printf("the cast behaviour needs --cast-spell\n");
+            return false;
+        }
+
+        if ((config.Bot.Behaviours & BOT_BEHAVIOUR_AUCTION) && !config.Bot.Auctioneer)
+        {
+            printf("the auction behaviour needs --auctioneer <guid>:<entry>\n");
+            return false;
+        }
+
+        return true;
+    }
+
+    /// Owns a share of the bots: logs them in one by one and updates all connected ones every few milliseconds.
+    void RunClientThread(LoadConfig const& config, LatencyStats& stats)
+    {
+        std::vector<BotSession*> bots;
+        std::vector<bool> inWorld;
+        uint32 loginTimer = config.LoginInterval;
+        uint32 lastTime = getMSTime();
+
+        while (!stopRequested)
+        {
+            uint32 now = getMSTime();
+            uint32 diff = getMSTimeDiff(lastTime, now);
+            lastTime = now;
+
+            loginTimer += diff;
+            if (loginTimer >= config.LoginInterval)
+            {
+                uint32 index = nextBot++;
+                if (index < config.Count)
+                {
+                    char account[64];
+                    snprintf(account, sizeof(account), "%s%u", config.AccountPrefix.c_str(), config.First + index);
+
+                    BotSession* bot = new BotSession(config.Bot, account, stats);
+                    bots.push_back(bot);
+                    inWorld.push_back(false);
+                    if (!bot->Connect())
+                        ++botsFailed;
+                }
+
+                loginTimer = 0;
+            }
+
+            for (size_t i = 0; i < bots.size(); ++i)
+            {
+                BotSession* bot = bots[i];
+                if (bot->GetState() == BOT_STATE_DISCONNECTED)
+                    continue;
+
+                if (!bot->Update(diff))
+                {
+                    if (inWorld[i])
+                        --botsInWorld;
+                    else
+                        ++botsFailed;
+
+                    printf("[%s] disconnected\n", bot->GetAccount().c_str());
+                    inWorld[i] = false;
+                    continue;
+                }
+
+                if (!inWorld[i] && bot->GetState() == BOT_STATE_IN_WORLD)
+                {
+                    inWorld[i] = true;
+                    ++botsInWorld;
+                }
+            }
+
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        }
+
+        for (size_t i = 0; i < bots.size(); ++i)
+            delete bots[i];
+    }
+}
+
+int main(int argc, char** argv)
+{
+    LoadConfig config;
+    config.Bot.AuthHost = "127.0.0.1";
+    config.Bot.WorldHost = "127.0.0.1";
+    config.Bot.Channel = "loadtest";
+    config.AccountPrefix = "BOT";
+
+    if (!HandleArgs(argc, argv, config))
+    {
+        PrintUsage(argv[0]);
+        return 1;
+    }
+
+    // wire numbers of the opcodes the bots send and receive
+    serverOpcodeTable.InitializeServerTable();
+    clientOpcodeTable.InitializeClientTable();
+
+    srand(uint32(time(NULL)));
+    signal(SIGINT, OnSignal);
+    signal(SIGTERM, OnSignal);
+#ifdef SIGPIPE
+    signal(SIGPIPE, SIG_IGN);
+#endif
+
+    printf("Starting %u bots on %u threads against %s:%u / %s:%u\n", config.Count, config.Threads,
+        config.Bot.AuthHost.c_str(), config.Bot.AuthPort, config.Bot.WorldHost.c_str(), config.Bot.WorldPort);
+
+    LatencyStats stats;
+    std::vector<std::thread> threads;
+    for (uint32 i = 0; i < config.Threads; ++i)
+        threads.push_back(std::thread(RunClientThread, std::cref(config), std::ref(stats)));
+
+    uint32 startTime = getMSTime();
+    uint32 reportTimer = 0;
+    while (!stopRequested)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(100));
+
+        uint32 elapsed = GetMSTimeDiffToNow(startTime);
+        if (config.Duration && elapsed >= config.Duration * IN_MILLISECONDS)
+            stopRequested = true;
+
+        if (elapsed - reportTimer >= config.ReportInterval * IN_MILLISECONDS)
+        {
+            reportTimer = elapsed;
+            printf("\n[%u s] bots in world: %u, failed or disconnected: %u, started: %u/%u\n", elapsed / IN_MILLISECONDS,
+                uint32(botsInWorld), uint32(botsFailed), std::min(uint32(nextBot), config.Count), config.Count);
+            stats.Report(false);
+        }
+    }
+
+    for (size_t i = 0; i < threads.size(); ++i)
+        threads[i].join();
+
+    printf("\nRun finished after %u s, bots failed or disconnected: %u\n", GetMSTimeDiffToNow(startTime) / IN_MILLISECONDS, uint32(botsFailed));
+    stats.Report(true);
+    return 0;
+}